@@ -118,6 +118,34 @@ extern "C" void QCALLTYPE ObjectNative_AllocateUninitializedClone(QCall::ObjectH
     END_QCALL;
 }
 
+// Replaces the object with a copy on a frozen segment, which the GC never marks,
+// sweeps or compacts. Only objects without GC references can be frozen; the caller
+// is expected to publish the copy and drop the original.
+extern "C" BOOL QCALLTYPE ObjectNative_TryFreeze(QCall::ObjectHandleOnStack objHandle)
+{
+    QCALL_CONTRACT;
+
+    BOOL retVal = FALSE;
+
+    BEGIN_QCALL;
+
+    GCX_COOP();
+
+    OBJECTREF refObj = objHandle.Get();
+    _ASSERTE(refObj != NULL); // Should be handled at managed side
+
+    OBJECTREF refFrozen = TryAllocateFrozenCopy(refObj);
+    if (refFrozen != NULL)
+    {
+        objHandle.Set(refFrozen);
+        retVal = TRUE;
+    }
+
+    END_QCALL;
+
+    return retVal;
+}
+
 extern "C" BOOL QCALLTYPE Monitor_Wait(QCall::ObjectHandleOnStack pThis, INT32 Timeout)
 {
     QCALL_CONTRACT;
@@ -168,6 +168,17 @@ DumpWriter::WriteDump()
 
     TRACE("Writing %" PRIu64 " memory regions to core file\n", phnum - 1);
 
+    // Copying the regions through a large buffer keeps the number of read and write system calls low for
+    // big processes. If it can't be allocated when memory is scarce, fall back to the small fixed buffer.
+    ArrayHolder<BYTE> copyBufferHolder = new (std::nothrow) BYTE[MEMORY_COPY_BUFFER_SIZE];
+    BYTE* copyBuffer = copyBufferHolder;
+    size_t copyBufferSize = MEMORY_COPY_BUFFER_SIZE;
+    if (copyBuffer == nullptr)
+    {
+        copyBuffer = m_tempBuffer;
+        copyBufferSize = sizeof(m_tempBuffer);
+    }
+
     // Read from target process and write memory regions to core
     uint64_t total = 0;
     for (const MemoryRegion& memoryRegion : m_crashInfo.MemoryRegions())
@@ -186,10 +197,10 @@ DumpWriter::WriteDump()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
+                size_t bytesToRead = std::min(size, copyBufferSize);
                 size_t read = 0;
 
-                if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
+                if (!m_crashInfo.ReadProcessMemory(address, copyBuffer, bytesToRead, &read)) {
                     printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%d)\n", address, bytesToRead, strerror(g_readProcessMemoryErrno), g_readProcessMemoryErrno);
                     return false;
                 }
@@ -200,7 +211,7 @@ DumpWriter::WriteDump()
                     return false;
                 }
 
-                if (!WriteData(m_tempBuffer, read)) {
+                if (!WriteData(copyBuffer, read)) {
                     return false;
                 }
 
@@ -37,6 +37,9 @@
 #define NT_SIGINFO	0x53494749
 #endif
 
+// Size of the buffer the memory regions are copied through
+#define MEMORY_COPY_BUFFER_SIZE (1024 * 1024)
+
 class DumpWriter
 {
 private:
@@ -211,6 +211,17 @@ DumpWriter::WriteSegments()
 {
     TRACE("Writing %" PRIu64 " memory regions to core file\n", m_segmentLoadCommands.size());
 
+    // Copying the regions through a large buffer keeps the number of read and write system calls low for
+    // big processes. If it can't be allocated when memory is scarce, fall back to the small fixed buffer.
+    ArrayHolder<BYTE> copyBufferHolder = new (std::nothrow) BYTE[MEMORY_COPY_BUFFER_SIZE];
+    BYTE* copyBuffer = copyBufferHolder;
+    size_t copyBufferSize = MEMORY_COPY_BUFFER_SIZE;
+    if (copyBuffer == nullptr)
+    {
+        copyBuffer = m_tempBuffer;
+        copyBufferSize = sizeof(m_tempBuffer);
+    }
+
     // Read from target process and write memory regions to core
     uint64_t total = 0;
     for (const segment_command_64& segment : m_segmentLoadCommands)
@@ -265,10 +276,10 @@ DumpWriter::WriteSegments()
         {
             while (size > 0)
             {
-                size_t bytesToRead = std::min(size, sizeof(m_tempBuffer));
+                size_t bytesToRead = std::min(size, copyBufferSize);
                 size_t read = 0;
 
-                if (!m_crashInfo.ReadProcessMemory(address, m_tempBuffer, bytesToRead, &read)) {
+                if (!m_crashInfo.ReadProcessMemory(address, copyBuffer, bytesToRead, &read)) {
                     printf_error("Error reading memory at %" PRIA PRIx64 " size %08zx FAILED %s (%x)\n", address, bytesToRead, mach_error_string(g_readProcessMemoryResult), g_readProcessMemoryResult);
                     return false;
                 }
@@ -279,7 +290,7 @@ DumpWriter::WriteSegments()
                     return false;
                 }
 
-                if (!WriteData(m_tempBuffer, read)) {
+                if (!WriteData(copyBuffer, read)) {
                     return false;
                 }
 
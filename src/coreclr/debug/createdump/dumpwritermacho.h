@@ -20,6 +20,9 @@ struct ThreadCommand
 #endif
 };
 
+// Size of the buffer the memory regions are copied through
+#define MEMORY_COPY_BUFFER_SIZE (1024 * 1024)
+
 class DumpWriter
 {
 private:
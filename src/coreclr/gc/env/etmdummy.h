@@ -32,6 +32,7 @@
 #define FireEtwGCTerminateConcurrentThread_V1(ClrInstanceID) 0
 #define FireEtwGCFinalizersEnd(Count) 0
 #define FireEtwGCFinalizersEnd_V1(Count, ClrInstanceID) 0
+#define FireEtwGCFinalizersEnd_V2(Count, ClrInstanceID, QueueLength, HelperCount, HelperFinalizedCount, DurationMSec) 0
 #define FireEtwGCFinalizersBegin() 0
 #define FireEtwGCFinalizersBegin_V1(ClrInstanceID) 0
 #define FireEtwBulkType(Count, ClrInstanceID, Values_Len_, Values) 0
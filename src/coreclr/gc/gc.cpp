@@ -114,6 +114,9 @@ BOOL bgc_heap_walk_for_etw_p = FALSE;
 // If the survived due to cards from old generations / region_size is 90+%,
 // we don't compact this region, also we immediately promote it to gen2.
 #define sip_old_card_surv_ratio_th (90)
+// If the survived / region_size of a gen2 region is below 25% after a BGC sweep
+// we consider it sparse - it's a region worth evacuating instead of sweeping.
+#define bgc_sparse_region_surv_ratio_th (25)
 #else
 #define demotion_plug_len_th (6*1024*1024)
 #endif //USE_REGIONS
@@ -1957,6 +1960,18 @@ uint8_t* gc_heap::pad_for_alignment_large (uint8_t* newAlloc, int requiredAlignm
 #define CLR_SIZE ((size_t)(8*1024+32))
 #endif //SERVER_GC
 
+// An allocation context's quantum is allocation_quantum scaled by a power of 2 in this range,
+// see gc_heap::update_allocation_quantum_scale.
+#define MIN_ALLOC_QUANTUM_SCALE (-2)
+#define MAX_ALLOC_QUANTUM_SCALE 2
+// A context refilled at least this many times during a GC cycle gets a larger quantum.
+#define ALLOC_QUANTUM_GROW_REFILLS 16
+
+#ifndef MULTIPLE_HEAPS
+// A nursery chunk is this many allocation quantums, see gc_heap::allocate_from_nursery_slot.
+#define NURSERY_CHUNK_QUANTA 16
+#endif //!MULTIPLE_HEAPS
+
 #define END_SPACE_AFTER_GC (loh_size_threshold + MAX_STRUCTALIGN)
 // When we fit into the free list we need an extra of a min obj
 #define END_SPACE_AFTER_GC_FL (END_SPACE_AFTER_GC + Align (min_obj_size))
@@ -2013,7 +2028,9 @@ const size_t low_latency_alloc = 256*1024;
 const size_t fgn_check_quantum = 2*1024*1024;
 
 #ifdef MH_SC_MARK
-const int max_snoop_level = 128;
+// Only offer mark work to other heaps when we have at least this many entries on
+// our own mark stack, otherwise it's cheaper to just mark them ourselves.
+const ptrdiff_t mark_steal_share_th = 64;
 #endif //MH_SC_MARK
 
 #ifdef CARD_BUNDLE
@@ -2323,7 +2340,7 @@ size_t*     gc_heap::g_promoted;
 #endif //!USE_REGIONS || _DEBUG
 
 #ifdef MH_SC_MARK
-int*        gc_heap::g_mark_stack_busy;
+VOLATILE(int32_t) gc_heap::mark_steal_idle_count;
 #endif //MH_SC_MARK
 
 #ifdef BACKGROUND_GC
@@ -2415,7 +2432,14 @@ double      gc_heap::short_plugs_pad_ratio = 0;
 
 int         gc_heap::generation_skip_ratio_threshold = 0;
 int         gc_heap::conserve_mem_setting = 0;
+size_t      gc_heap::pause_goal = 0;
+float       gc_heap::gen0_budget_pause_ratio = 1.0f;
 bool        gc_heap::spin_count_unit_config_p = false;
+bool        gc_heap::adaptive_allocation_quantum_p = false;
+#ifndef MULTIPLE_HEAPS
+nursery_slot* gc_heap::nursery_slots = nullptr;
+int         gc_heap::n_nursery_slots = 0;
+#endif //!MULTIPLE_HEAPS
 
 uint64_t    gc_heap::suspended_start_time = 0;
 uint64_t    gc_heap::end_gc_time = 0;
@@ -2653,6 +2677,10 @@ region_free_list gc_heap::free_regions[count_free_region_kinds];
 
 int         gc_heap::num_regions_freed_in_sweep = 0;
 
+int         gc_heap::num_pinned_regions_demoted = 0;
+
+int         gc_heap::num_pinned_regions_long_lived = 0;
+
 int         gc_heap::regions_per_gen[max_generation + 1];
 
 int         gc_heap::planned_regions_per_gen[max_generation + 1];
@@ -2878,6 +2906,7 @@ size_t        gc_heap::last_gc_end_time_us = 0;
 #endif //HEAP_BALANCE_INSTRUMENTATION
 #ifdef USE_REGIONS
 bool          gc_heap::enable_special_regions_p = false;
+int           gc_heap::long_lived_pin_gc_count = 0;
 #else //USE_REGIONS
 size_t        gc_heap::min_segment_size = 0;
 size_t        gc_heap::min_uoh_segment_size = 0;
@@ -2892,6 +2921,9 @@ size_t gc_heap::compact_or_sweep_gcs[2];
 
 #ifdef FEATURE_LOH_COMPACTION
 BOOL                   gc_heap::loh_compaction_always_p = FALSE;
+#ifdef USE_REGIONS
+int                    gc_heap::loh_compaction_dense_region_percent = 0;
+#endif //USE_REGIONS
 gc_loh_compaction_mode gc_heap::loh_compaction_mode = loh_compaction_default;
 #endif //FEATURE_LOH_COMPACTION
 
@@ -8019,6 +8051,15 @@ void void_allocation (gc_alloc_context* acontext, void*)
 void gc_heap::repair_allocation_contexts (BOOL repair_p)
 {
     GCToEEInterface::GcEnumAllocContexts (repair_p ? repair_allocation : void_allocation, NULL);
+
+#ifndef MULTIPLE_HEAPS
+    // The unused part of a nursery chunk is supposed to stay a free object so there's nothing to
+    // repair, but the chunks need to be voided just like the thread contexts.
+    if (!repair_p)
+    {
+        void_nursery_slots();
+    }
+#endif //!MULTIPLE_HEAPS
 }
 
 struct fix_alloc_context_args
@@ -8040,9 +8081,142 @@ void gc_heap::fix_allocation_contexts (BOOL for_gc_p)
     args.heap = __this;
 
     GCToEEInterface::GcEnumAllocContexts(fix_alloc_context, &args);
+#ifndef MULTIPLE_HEAPS
+    fix_nursery_slots (for_gc_p);
+#endif //!MULTIPLE_HEAPS
     fix_youngest_allocation_area();
 }
 
+#ifndef MULTIPLE_HEAPS
+void gc_heap::init_nursery_slots()
+{
+    if (!GCConfig::GetGCNurseryPerCore() || (g_num_processors <= 1) ||
+        !GCToOSInterface::CanGetCurrentProcessorNumber())
+    {
+        return;
+    }
+
+    // If we can't get the slots we simply allocate the normal way.
+    nursery_slot* slots = new (nothrow) nursery_slot[g_num_processors];
+    if (!slots)
+    {
+        return;
+    }
+
+    for (int i = 0; i < (int)g_num_processors; i++)
+    {
+        slots[i].lock = lock_free;
+        slots[i].chunk.init();
+        slots[i].free_obj_space = 0;
+        slots[i].unused_alloc_bytes = 0;
+    }
+
+    nursery_slots = slots;
+    n_nursery_slots = (int)g_num_processors;
+    dprintf (1, ("using %d nursery slots", n_nursery_slots));
+}
+
+void gc_heap::fix_nursery_slots (BOOL for_gc_p)
+{
+    for (int i = 0; i < n_nursery_slots; i++)
+    {
+        nursery_slot* slot = &nursery_slots[i];
+        fix_allocation_context (&slot->chunk, for_gc_p, FALSE);
+
+        if (for_gc_p)
+        {
+            generation_free_obj_space (generation_of (0)) += slot->free_obj_space;
+            total_alloc_bytes_soh -= slot->unused_alloc_bytes;
+            slot->free_obj_space = 0;
+            slot->unused_alloc_bytes = 0;
+        }
+    }
+}
+
+void gc_heap::void_nursery_slots()
+{
+    for (int i = 0; i < n_nursery_slots; i++)
+    {
+        void_allocation (&nursery_slots[i].chunk, NULL);
+    }
+}
+
+// Refills acontext with a piece of the current core's nursery chunk, refilling the chunk itself from the
+// msl when it runs out. Returns FALSE if the caller needs to go through the regular msl path instead.
+//
+// The slot lock is only ever held while running in cooperative mode and is taken before the msl, so a
+// thread that needs to trigger a GC while refilling a chunk is no different from one that triggers it
+// while holding the msl - other threads waiting on the slot switch to preemptive mode while they wait.
+BOOL gc_heap::allocate_from_nursery_slot (alloc_context* acontext, size_t size)
+{
+    int align_const = get_alignment_constant (TRUE);
+    size_t aligned_min_obj_size = Align (min_obj_size, align_const);
+    size_t chunk_size = allocation_quantum * NURSERY_CHUNK_QUANTA;
+    size_t carve_size = Align (max (get_allocation_quantum (acontext), size + aligned_min_obj_size), align_const);
+
+    // Large requests would use up a chunk too quickly to be worth it.
+    if (gc_heap::gc_started || (carve_size > (chunk_size / 2)))
+    {
+        return FALSE;
+    }
+
+    nursery_slot* slot = &nursery_slots[GCToOSInterface::GetCurrentProcessorNumber() % n_nursery_slots];
+    enter_spin_lock_noinstru (&slot->lock);
+
+    alloc_context* chunk = &slot->chunk;
+    if ((chunk->alloc_ptr == 0) || ((size_t)(chunk->alloc_limit - chunk->alloc_ptr) < carve_size))
+    {
+        allocation_state status = a_state_start;
+        do
+        {
+            status = try_allocate_more_space (chunk, chunk_size, 0, 0);
+        } while (status == a_state_retry_allocate);
+
+        // Whether or not we got a new chunk, what's left of the chunk needs to be formatted as a free object.
+        if (chunk->alloc_ptr != 0)
+        {
+            make_unused_array (chunk->alloc_ptr, (chunk->alloc_limit - chunk->alloc_ptr) + aligned_min_obj_size);
+        }
+
+        if ((status != a_state_can_allocate) || ((size_t)(chunk->alloc_limit - chunk->alloc_ptr) < carve_size))
+        {
+            leave_spin_lock_noinstru (&slot->lock);
+            return FALSE;
+        }
+    }
+
+    uint8_t* start = chunk->alloc_ptr;
+    size_t tail_size = (chunk->alloc_limit - start) + aligned_min_obj_size;
+    clear_unused_array (start, tail_size);
+    chunk->alloc_ptr += carve_size;
+    make_unused_array (chunk->alloc_ptr, tail_size - carve_size);
+
+    // Same as what adjust_limit_clr does with the rest of a non contiguous context.
+    if (acontext->alloc_ptr != 0)
+    {
+        size_t ac_size = (acontext->alloc_limit - acontext->alloc_ptr);
+        acontext->alloc_bytes -= ac_size;
+        slot->unused_alloc_bytes += ac_size;
+        size_t free_obj_size = ac_size + aligned_min_obj_size;
+        make_unused_array (acontext->alloc_ptr, free_obj_size);
+        slot->free_obj_space += free_obj_size;
+    }
+
+    // The chunk was already counted as allocated, except for the min obj gap at its end. We don't
+    // use the one at the end of each piece.
+    acontext->alloc_ptr = start;
+    acontext->alloc_limit = start + carve_size - aligned_min_obj_size;
+    acontext->alloc_bytes += carve_size - aligned_min_obj_size;
+    slot->unused_alloc_bytes += aligned_min_obj_size;
+
+    leave_spin_lock_noinstru (&slot->lock);
+
+    dprintf (3, ("nursery slot %zd gave [%zx, %zx[ for %zd bytes", (size_t)(slot - nursery_slots),
+        (size_t)start, (size_t)acontext->alloc_limit, size));
+    return TRUE;
+}
+#endif //!MULTIPLE_HEAPS
+
 void gc_heap::fix_older_allocation_area (generation* older_gen)
 {
     heap_segment* older_gen_seg = generation_allocation_segment (older_gen);
@@ -8491,22 +8665,11 @@ bool gc_heap::should_check_brick_for_reloc (uint8_t* o)
 }
 #endif //USE_REGIONS
 
-#ifdef MH_SC_MARK
-inline
-int& gc_heap::mark_stack_busy()
-{
-    return  g_mark_stack_busy [(heap_number+2)*HS_CACHE_LINE_SIZE/sizeof(int)];
-}
-#endif //MH_SC_MARK
-
 void gc_heap::make_mark_stack (mark* arr)
 {
     reset_pinned_queue();
     mark_stack_array = arr;
     mark_stack_array_length = MARK_STACK_INITIAL_LENGTH;
-#ifdef MH_SC_MARK
-    mark_stack_busy() = 0;
-#endif //MH_SC_MARK
 }
 
 #ifdef BACKGROUND_GC
@@ -10482,6 +10645,96 @@ private:
 
 #endif //defined(USE_INTROSORT) || defined(USE_VXSORT)
 
+#if defined(USE_INTROSORT) && defined(MULTIPLE_HEAPS)
+// Used to sort big mark lists where we don't have vxsort. Mark list entries are
+// object addresses within [range_low, range_high] so we only need to sort by the
+// bits of their offset from range_low, and since objects are pointer aligned
+// the low bits of the offset are always 0. This means a few LSD radix passes
+// sort the whole list, which is much faster than introsort for big lists.
+class radix_sort
+{
+private:
+    static const int digit_bits = 11;
+    static const size_t digit_count = (size_t)1 << digit_bits;
+    static const int max_passes = 4;
+
+#ifdef HOST_64BIT
+    static const int alignment_bits = 3;
+#else
+    static const int alignment_bits = 2;
+#endif //HOST_64BIT
+
+public:
+    // above this threshold, radix sort will likely pay off
+    static const ptrdiff_t threshold_size = 8 * 1024;
+
+    // Returns false if the range is too large to sort with max_passes passes, in which
+    // case the items are left untouched. scratch must have room for item_count items.
+    static bool sort (uint8_t** items, ptrdiff_t item_count, uint8_t** scratch, uint8_t* range_low, uint8_t* range_high)
+    {
+        size_t span = (size_t)(range_high - range_low) >> alignment_bits;
+        int passes = 0;
+        while (span != 0)
+        {
+            passes++;
+            span >>= digit_bits;
+        }
+
+        if (passes > max_passes)
+        {
+            return false;
+        }
+
+        uint8_t** src = items;
+        uint8_t** dst = scratch;
+
+        for (int pass = 0; pass < passes; pass++)
+        {
+            int shift = alignment_bits + pass * digit_bits;
+
+            uint32_t counts[digit_count];
+            memset (counts, 0, sizeof (counts));
+            for (ptrdiff_t i = 0; i < item_count; i++)
+            {
+                counts[digit_of (src[i], range_low, shift)]++;
+            }
+
+            // turn the counts into the start index for each digit
+            uint32_t start = 0;
+            for (size_t d = 0; d < digit_count; d++)
+            {
+                uint32_t count = counts[d];
+                counts[d] = start;
+                start += count;
+            }
+
+            for (ptrdiff_t i = 0; i < item_count; i++)
+            {
+                uint8_t* item = src[i];
+                dst[counts[digit_of (item, range_low, shift)]++] = item;
+            }
+
+            uint8_t** tmp = src;
+            src = dst;
+            dst = tmp;
+        }
+
+        if (src != items)
+        {
+            memcpy (items, src, item_count * sizeof (items[0]));
+        }
+
+        return true;
+    }
+
+private:
+    static size_t digit_of (uint8_t* item, uint8_t* range_low, int shift)
+    {
+        return ((size_t)(item - range_low) >> shift) & (digit_count - 1);
+    }
+};
+#endif //USE_INTROSORT && MULTIPLE_HEAPS
+
 #ifdef USE_VXSORT
 static void do_vxsort (uint8_t** item_array, ptrdiff_t item_count, uint8_t* range_low, uint8_t* range_high)
 {
@@ -10749,9 +11002,23 @@ size_t gc_heap::sort_mark_list()
 
 #else //USE_VXSORT
     dprintf (3, ("Sorting mark lists"));
-    if (local_mark_list_index > mark_list)
+    ptrdiff_t item_count = local_mark_list_index - mark_list;
+    if (item_count > 1)
     {
-        introsort::sort (mark_list, local_mark_list_index - 1, 0);
+        // this heap's part of g_mark_list_copy is not used until merge_mark_lists
+        // so we can use it as the scratch buffer for radix sort
+        uint8_t** scratch = &g_mark_list_copy[heap_number * mark_list_size];
+        if ((item_count <= radix_sort::threshold_size) ||
+            !radix_sort::sort (mark_list, item_count, scratch, low, high))
+        {
+            introsort::sort (mark_list, local_mark_list_index - 1, 0);
+        }
+#ifdef _DEBUG
+        for (ptrdiff_t i = 0; i < item_count - 1; i++)
+        {
+            assert (mark_list[i] <= mark_list[i + 1]);
+        }
+#endif //_DEBUG
     }
 #endif //USE_VXSORT
 
@@ -12462,6 +12729,15 @@ void gc_heap::init_heap_segment (heap_segment* seg, gc_heap* hp
     set_region_gen_num (seg, gen_num_for_region);
     heap_segment_plan_gen_num (seg) = gen_num_for_region;
     heap_segment_swept_in_plan (seg) = false;
+    heap_segment_pinned_demoted_count (seg) = 0;
+#ifdef MULTIPLE_HEAPS
+    // An existing region keeps the node it was created on since that's where its
+    // committed pages are.
+    if (!existing_region_p)
+    {
+        heap_segment_numa_node (seg) = heap_select::find_numa_node_from_heap_no (hp->heap_number);
+    }
+#endif //MULTIPLE_HEAPS
 #endif //USE_REGIONS
 
 #ifdef USE_REGIONS
@@ -12837,6 +13113,29 @@ static int64_t grow_region_list (region_free_list* dest, region_free_list* src,
     return added_count;
 }
 
+#ifdef MULTIPLE_HEAPS
+// like grow_region_list, but first takes the regions created on numa_node
+static int64_t grow_region_list_numa (region_free_list* dest, region_free_list* src, size_t target_count, uint16_t numa_node)
+{
+    int64_t added_count = 0;
+    heap_segment* next_region = nullptr;
+    for (heap_segment* region = src->get_first_free_region();
+         (region != nullptr) && (dest->get_num_free_regions() < target_count);
+         region = next_region)
+    {
+        next_region = heap_segment_next (region);
+        if (heap_segment_numa_node (region) == numa_node)
+        {
+            region_free_list::unlink_region (region);
+            dest->add_region_front (region);
+            added_count++;
+        }
+    }
+
+    return (added_count + grow_region_list (dest, src, target_count));
+}
+#endif //MULTIPLE_HEAPS
+
 region_free_list::region_free_list() : num_free_regions (0),
                                        size_free_regions (0),
                                        size_committed_in_free_regions (0),
@@ -13670,7 +13969,12 @@ void gc_heap::distribute_free_regions()
             // second pass: fill all the regions having less than budget
             if (hp->free_regions[kind].get_num_free_regions() < heap_budget_in_region_units[kind][i])
             {
+#ifdef MULTIPLE_HEAPS
+                int64_t num_added_regions = grow_region_list_numa (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[kind][i],
+                                                                   heap_select::find_numa_node_from_heap_no (i));
+#else //MULTIPLE_HEAPS
                 int64_t num_added_regions = grow_region_list (&hp->free_regions[kind], &surplus_regions[kind], heap_budget_in_region_units[kind][i]);
+#endif //MULTIPLE_HEAPS
                 dprintf (REGIONS_LOG, ("added %zd %s regions to heap %d - now has %zd, budget is %zd",
                     (size_t)num_added_regions,
                     free_region_kind_name[kind],
@@ -14450,6 +14754,11 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 
     conserve_mem_setting = (int)GCConfig::GetGCConserveMem();
 
+    pause_goal = (size_t)max ((int64_t)0, (int64_t)GCConfig::GetGCPauseGoal());
+    gen0_budget_pause_ratio = 1.0f;
+
+    adaptive_allocation_quantum_p = GCConfig::GetGCAdaptiveAllocQuantum();
+
 #ifdef DYNAMIC_HEAP_COUNT
     dynamic_adaptation_mode = (int)GCConfig::GetGCDynamicAdaptationMode();
     if (GCConfig::GetHeapCount() != 0)
@@ -14533,6 +14842,16 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
         // on the whole range. This can be committed as needed.
         size_t reserve_size = regions_range;
         uint8_t* reserve_range = (uint8_t*)virtual_alloc (reserve_size, use_large_pages_p);
+        if (!reserve_range && use_large_pages_p)
+        {
+            // Large pages need to be set up on the machine beforehand and there may not be
+            // enough of them for the whole range. Rather than failing to start we fall back
+            // to normal pages - nothing has been committed with large pages at this point.
+            dprintf (1, ("failed to reserve %zd bytes with large pages, falling back to normal pages", reserve_size));
+            use_large_pages_p = false;
+            GCConfig::SetGCLargePages (false);
+            reserve_range = (uint8_t*)virtual_alloc (reserve_size, use_large_pages_p);
+        }
         if (!reserve_range)
             return E_OUTOFMEMORY;
 
@@ -14633,18 +14952,10 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
         return E_OUTOFMEMORY;
 #endif
 
-#ifdef MH_SC_MARK
-    g_mark_stack_busy = new (nothrow) int[(number_of_heaps+2)*HS_CACHE_LINE_SIZE/sizeof(int)];
-#endif //MH_SC_MARK
 #ifdef _PREFAST_
 #pragma warning(pop)
 #endif // _PREFAST_
 
-#ifdef MH_SC_MARK
-    if (!g_mark_stack_busy)
-        return E_OUTOFMEMORY;
-#endif //MH_SC_MARK
-
     if (!create_thread_support (number_of_heaps))
         return E_OUTOFMEMORY;
 
@@ -14653,7 +14964,9 @@ HRESULT gc_heap::initialize_gc (size_t soh_segment_size,
 #ifdef MULTIPLE_HEAPS
     yp_spin_count_unit = 32 * number_of_heaps;
 #else
-    yp_spin_count_unit = 32 * g_num_processors;
+    // Scale by the CPUs this process may actually use rather than all of the machine's; under a
+    // container CPU quota the extra spinning only burns quota and gets the process throttled.
+    yp_spin_count_unit = 32 * min (GCToEEInterface::GetCurrentProcessCpuCount(), g_num_processors);
 #endif //MULTIPLE_HEAPS
 
     // Check if the values are valid for the spin count if provided by the user
@@ -14790,6 +15103,9 @@ gc_heap::init_semi_shared()
 #ifdef FEATURE_LOH_COMPACTION
     loh_compaction_always_p = GCConfig::GetLOHCompactionMode() != 0;
     loh_compaction_mode = loh_compaction_default;
+#ifdef USE_REGIONS
+    loh_compaction_dense_region_percent = (int)min ((int64_t)100, max ((int64_t)0, (int64_t)GCConfig::GetLOHCompactionDenseRegionPercent()));
+#endif //USE_REGIONS
 #endif //FEATURE_LOH_COMPACTION
 
 #ifdef BGC_SERVO_TUNING
@@ -14924,6 +15240,10 @@ gc_heap::init_semi_shared()
 
     reset_mm_p = TRUE;
 
+#ifndef MULTIPLE_HEAPS
+    init_nursery_slots();
+#endif //!MULTIPLE_HEAPS
+
     ret = 1;
 
 cleanup:
@@ -17042,6 +17362,11 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     }
 #endif //MULTIPLE_HEAPS
 
+    if (gen_number == 0)
+    {
+        update_allocation_quantum_scale (acontext);
+    }
+
     dprintf (3, ("Expanding segment allocation [%zx, %zx[", (size_t)start,
                (size_t)start + limit_size - aligned_min_obj_size));
 
@@ -17225,6 +17550,15 @@ void gc_heap::adjust_limit_clr (uint8_t* start, size_t limit_size, size_t size,
     if (fire_event_p)
     {
         fire_etw_allocation_event (etw_allocation_amount, gen_number, acontext->alloc_ptr, size);
+
+        if (gen_number == 0)
+        {
+            GCEventFireAllocationQuantum_V1 (
+                (uint32_t)heap_number,
+                (uint64_t)allocation_quantum,
+                (uint64_t)get_allocation_quantum (acontext),
+                (uint32_t)acontext->get_quantum_refill_count());
+        }
     }
 #endif //FEATURE_EVENT_TRACE
 
@@ -17272,8 +17606,72 @@ size_t gc_heap::new_allocation_limit (size_t size, size_t physical_limit, int ge
     return limit;
 }
 
+size_t gc_heap::get_allocation_quantum (alloc_context* acontext)
+{
+    if (!adaptive_allocation_quantum_p)
+    {
+        return allocation_quantum;
+    }
+
+    int scale = acontext->get_quantum_scale();
+    size_t quantum = ((scale >= 0) ? (allocation_quantum << scale) : (allocation_quantum >> -scale));
+    return Align (max (quantum, (size_t)1024), get_alignment_constant (TRUE));
+}
+
+// Called when acontext is refilled from gen0. Contexts that keep coming back within the same GC
+// cycle get a larger quantum so they take the msl less often, while contexts that are barely
+// refilled get a smaller one so they don't leave large unused chunks behind at each GC.
+void gc_heap::update_allocation_quantum_scale (alloc_context* acontext)
+{
+    if (!adaptive_allocation_quantum_p)
+    {
+        return;
+    }
+
+    int scale = acontext->get_quantum_scale();
+    uint8_t last_gc_index = acontext->get_quantum_gc_index();
+    uint16_t refill_count = acontext->get_quantum_refill_count();
+    uint8_t current_gc_index = (uint8_t)VolatileLoad (&settings.gc_index);
+
+    if (current_gc_index != last_gc_index)
+    {
+        // A context that hasn't been refilled yet has no history to go by.
+        if (refill_count != 0)
+        {
+            size_t gcs_elapsed = (uint8_t)(current_gc_index - last_gc_index);
+            size_t refills_per_gc = refill_count / gcs_elapsed;
+            int new_scale = scale;
+
+            if (refills_per_gc >= ALLOC_QUANTUM_GROW_REFILLS)
+            {
+                new_scale = min (scale + 1, MAX_ALLOC_QUANTUM_SCALE);
+            }
+            else if (refills_per_gc <= 1)
+            {
+                new_scale = max (scale - 1, MIN_ALLOC_QUANTUM_SCALE);
+            }
+
+            if (new_scale != scale)
+            {
+                dprintf (3, ("h%d ac %p: %zd refills per gc, quantum scale %d->%d",
+                    heap_number, acontext, refills_per_gc, scale, new_scale));
+                scale = new_scale;
+            }
+        }
+
+        refill_count = 0;
+    }
+
+    if (refill_count < UINT16_MAX)
+    {
+        refill_count++;
+    }
+
+    acontext->set_quantum_state (scale, current_gc_index, refill_count);
+}
+
 size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_limit, int gen_number,
-                                 int align_const)
+                                 alloc_context* acontext, int align_const)
 {
     size_t padded_size = size + Align (min_obj_size, align_const);
     // for LOH this is not true...we could select a physical_limit that's exactly the same
@@ -17282,7 +17680,7 @@ size_t gc_heap::limit_from_size (size_t size, uint32_t flags, size_t physical_li
 
     // For SOH if the size asked for is very small, we want to allocate more than just what's asked for if possible.
     // Unless we were told not to clean, then we will not force it.
-    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? allocation_quantum : 0);
+    size_t min_size_to_allocate = ((gen_number == 0 && !(flags & GC_ALLOC_ZEROING_OPTIONAL)) ? get_allocation_quantum (acontext) : 0);
 
     size_t desired_size_to_allocate  = max (padded_size, min_size_to_allocate);
     size_t new_physical_limit = min (physical_limit, desired_size_to_allocate);
@@ -17644,7 +18042,7 @@ BOOL gc_heap::a_fit_free_list_p (int gen_number,
                 // We ask for more Align (min_obj_size)
                 // to make sure that we can insert a free object
                 // in adjust_limit will set the limit lower
-                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, align_const);
+                size_t limit = limit_from_size (size, flags, free_list_size, gen_number, acontext, align_const);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 uint8_t*  remain = (free_list + limit);
@@ -17839,7 +18237,7 @@ BOOL gc_heap::a_fit_free_list_uoh_p (size_t size,
 
                 // Subtract min obj size because limit_from_size adds it. Not needed for LOH
                 size_t limit = limit_from_size (size - Align(min_obj_size, align_const), flags, free_list_size,
-                                                gen_number, align_const);
+                                                gen_number, acontext, align_const);
                 dd_new_allocation (dynamic_data_of (gen_number)) -= limit;
 
                 size_t saved_free_list_size = free_list_size;
@@ -17936,7 +18334,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, acontext, align_const);
         goto found_fit;
     }
 
@@ -17947,7 +18345,7 @@ BOOL gc_heap::a_fit_segment_end_p (int gen_number,
         limit = limit_from_size (size,
                                  flags,
                                  (end - allocated),
-                                 gen_number, align_const);
+                                 gen_number, acontext, align_const);
 
         if (grow_heap_segment (seg, (allocated + limit), &hard_limit_short_seg_end_p))
         {
@@ -19826,6 +20224,12 @@ BOOL gc_heap::allocate_more_space(alloc_context* acontext, size_t size,
             }
         }
 #else
+        if ((alloc_generation_number == 0) && nursery_slots &&
+            allocate_from_nursery_slot (acontext, size))
+        {
+            return TRUE;
+        }
+
         status = try_allocate_more_space (acontext, size, flags, alloc_generation_number);
 #endif //MULTIPLE_HEAPS
     }
@@ -24310,6 +24714,8 @@ void gc_heap::init_records()
     gen0_pinned_free_space = 0;
     gen0_large_chunk_found = false;
     num_regions_freed_in_sweep = 0;
+    num_pinned_regions_demoted = 0;
+    num_pinned_regions_long_lived = 0;
 #endif //USE_REGIONS
 
     sufficient_gen0_space_p = FALSE;
@@ -26163,6 +26569,19 @@ void gc_heap::calculate_new_heap_count ()
         }
     }
 
+    int min_heap_count_limit = VolatileLoadWithoutBarrier (&dynamic_heap_count_data.min_heap_count_limit);
+    int max_heap_count_limit = VolatileLoadWithoutBarrier (&dynamic_heap_count_data.max_heap_count_limit);
+    if ((min_heap_count_limit != 0) && (new_n_heaps < min_heap_count_limit))
+    {
+        dprintf (6666, ("HC %d is below the min limit %d", new_n_heaps, min_heap_count_limit));
+        new_n_heaps = min (min_heap_count_limit, actual_n_max_heaps);
+    }
+    if ((max_heap_count_limit != 0) && (new_n_heaps > max_heap_count_limit))
+    {
+        dprintf (6666, ("HC %d is above the max limit %d", new_n_heaps, max_heap_count_limit));
+        new_n_heaps = max_heap_count_limit;
+    }
+
     assert (new_n_heaps >= 1);
     assert (new_n_heaps <= actual_n_max_heaps);
 
@@ -27590,53 +28009,18 @@ inline void Prefetch (void* addr)
     UNREFERENCED_PARAMETER(addr);
 }
 #endif //PREFETCH
-#ifdef MH_SC_MARK
-inline
-VOLATILE(uint8_t*)& gc_heap::ref_mark_stack (gc_heap* hp, int index)
-{
-    return ((VOLATILE(uint8_t*)*)(hp->mark_stack_array))[index];
-}
-
-#endif //MH_SC_MARK
-
 #define stolen 2
 #define partial 1
-#define partial_object 3
 inline
 uint8_t* ref_from_slot (uint8_t* r)
 {
     return (uint8_t*)((size_t)r & ~(stolen | partial));
 }
 inline
-BOOL stolen_p (uint8_t* r)
-{
-    return (((size_t)r&2) && !((size_t)r&1));
-}
-inline
-BOOL ready_p (uint8_t* r)
-{
-    return ((size_t)r != 1);
-}
-inline
 BOOL partial_p (uint8_t* r)
 {
     return (((size_t)r&1) && !((size_t)r&2));
 }
-inline
-BOOL straight_ref_p (uint8_t* r)
-{
-    return (!stolen_p (r) && !partial_p (r));
-}
-inline
-BOOL partial_object_p (uint8_t* r)
-{
-    return (((size_t)r & partial_object) == partial_object);
-}
-inline
-BOOL ref_p (uint8_t* r)
-{
-    return (straight_ref_p (r) || partial_object_p (r));
-}
 
 mark_queue_t::mark_queue_t()
 #ifdef MARK_PHASE_PREFETCH
@@ -27759,13 +28143,122 @@ void mark_queue_t::verify_empty()
 #endif //MARK_PHASE_PREFETCH
 }
 
+#ifdef MH_SC_MARK
+mark_steal_deque_t::mark_steal_deque_t()
+{
+    init();
+}
+
+void mark_steal_deque_t::init()
+{
+    top = 0;
+    bottom = 0;
+}
+
+// Other heaps may be stealing while we look so this is only a snapshot.
+inline
+ptrdiff_t mark_steal_deque_t::get_count()
+{
+    ptrdiff_t b = bottom;
+    ptrdiff_t t = top;
+    return ((b > t) ? (b - t) : 0);
+}
+
+// Only called by the owner.
+inline
+ptrdiff_t mark_steal_deque_t::get_space()
+{
+    return (slot_count - get_count());
+}
+
+// Only called by the owner. Returns false if the deque is full.
+inline
+bool mark_steal_deque_t::push (uint8_t* o)
+{
+    int32_t b = bottom.LoadWithoutBarrier();
+    int32_t t = top;
+    // The indices only grow during a mark phase; rather than wrapping them we
+    // just stop accepting work in the unlikely case we get close to the limit.
+    if (((b - t) >= slot_count) || (b >= (INT32_MAX - slot_count)))
+    {
+        return false;
+    }
+
+    slot_table[b & (slot_count - 1)] = o;
+    // This is a release so a thief that sees the new bottom also sees the entry.
+    bottom = b + 1;
+    return true;
+}
+
+// Only called by the owner. Takes the newest entry.
+inline
+uint8_t* mark_steal_deque_t::pop()
+{
+    int32_t b = bottom.LoadWithoutBarrier();
+    if (b <= top)
+    {
+        // Only the owner adds entries so this can't become non empty under us.
+        return nullptr;
+    }
+
+    b--;
+    bottom = b;
+    // The store to bottom must be visible before we read top, otherwise a thief
+    // could take the same entry.
+    MemoryBarrier();
+    int32_t t = top;
+
+    uint8_t* o = nullptr;
+    if (t <= b)
+    {
+        o = slot_table[b & (slot_count - 1)];
+        if (t == b)
+        {
+            // This is the last entry so we race with thieves for it.
+            if (Interlocked::CompareExchange (&top, (t + 1), t) != t)
+            {
+                o = nullptr;
+            }
+            bottom = b + 1;
+        }
+    }
+    else
+    {
+        bottom = b + 1;
+    }
+
+    return o;
+}
+
+// Called by other heaps. Takes the oldest entry, returns nullptr if the deque is
+// empty or we lost the race for the entry.
+inline
+uint8_t* mark_steal_deque_t::steal()
+{
+    int32_t t = top;
+    MemoryBarrier();
+    int32_t b = bottom;
+
+    if (t < b)
+    {
+        uint8_t* o = slot_table[t & (slot_count - 1)];
+        if (Interlocked::CompareExchange (&top, (t + 1), t) == t)
+        {
+            return o;
+        }
+    }
+
+    return nullptr;
+}
+#endif //MH_SC_MARK
+
 void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL)
 {
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_tos = (SERVER_SC_MARK_VOLATILE(uint8_t*)*)mark_stack_array;
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_limit = (SERVER_SC_MARK_VOLATILE(uint8_t*)*)&mark_stack_array[mark_stack_array_length];
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* mark_stack_base = mark_stack_tos;
+    uint8_t** mark_stack_tos = (uint8_t**)mark_stack_array;
+    uint8_t** mark_stack_limit = (uint8_t**)&mark_stack_array[mark_stack_array_length];
+    uint8_t** mark_stack_base = mark_stack_tos;
 #ifdef SORT_MARK_STACK
-    SERVER_SC_MARK_VOLATILE(uint8_t*)* sorted_tos = mark_stack_base;
+    uint8_t** sorted_tos = mark_stack_base;
 #endif //SORT_MARK_STACK
 
     // If we are doing a full GC we don't use mark list anyway so use m_boundary_fullgc that doesn't
@@ -27780,9 +28273,7 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
 
     assert ((start >= oo) && (start < oo+size(oo)));
 
-#ifndef MH_SC_MARK
     *mark_stack_tos = oo;
-#endif //!MH_SC_MARK
 
     while (1)
     {
@@ -27791,15 +28282,10 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
         const int thread = 0;
 #endif //MULTIPLE_HEAPS
 
-        if (oo && ((size_t)oo != 4))
+        if (oo)
         {
             size_t s = 0;
-            if (stolen_p (oo))
-            {
-                --mark_stack_tos;
-                goto next_level;
-            }
-            else if (!partial_p (oo) && ((s = size (oo)) < (partial_size_th*sizeof (uint8_t*))))
+            if (!partial_p (oo) && ((s = size (oo)) < (partial_size_th*sizeof (uint8_t*))))
             {
                 BOOL overflow_p = FALSE;
 
@@ -27838,6 +28324,14 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                                           }
                         );
                 }
+#ifdef MH_SC_MARK
+                // Rather than going through the overflow processing later, give the
+                // object to the mark steal deque so we or an idle heap can mark it.
+                else if (mark_steal_p && mark_steal_deque.push (oo))
+                {
+                    dprintf(3,("mark stack overflow for object %zx, pushed to the mark steal deque", (size_t)oo));
+                }
+#endif //MH_SC_MARK
                 else
                 {
                     dprintf(3,("mark stack overflow for object %zx ", (size_t)oo));
@@ -27903,12 +28397,8 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                     dprintf(3,("pushing mark for %zx ", (size_t)oo));
 
                     //push the object and its current
-                    SERVER_SC_MARK_VOLATILE(uint8_t*)* place = ++mark_stack_tos;
+                    uint8_t** place = ++mark_stack_tos;
                     mark_stack_tos++;
-#ifdef MH_SC_MARK
-                    *(place-1) = 0;
-                    *(place) = (uint8_t*)partial;
-#endif //MH_SC_MARK
                     int i = num_partial_refs;
                     uint8_t* ref_to_continue = 0;
 
@@ -27943,11 +28433,7 @@ void gc_heap::mark_object_simple1 (uint8_t* oo, uint8_t* start THREAD_NUMBER_DCL
                         );
                     //we are finished with this object
                     assert (ref_to_continue == 0);
-#ifdef MH_SC_MARK
-                    assert ((*(place-1)) == (uint8_t*)0);
-#else //MH_SC_MARK
                     *(place-1) = 0;
-#endif //MH_SC_MARK
                     *place = 0;
                     // shouldn't we decrease tos by 2 here??
 
@@ -27955,14 +28441,17 @@ more_to_do:
                     if (ref_to_continue)
                     {
                         //update the start
-#ifdef MH_SC_MARK
-                        assert ((*(place-1)) == (uint8_t*)0);
-                        *(place-1) = (uint8_t*)((size_t)oo | partial_object);
-                        assert (((*place) == (uint8_t*)1) || ((*place) == (uint8_t*)2));
-#endif //MH_SC_MARK
                         *place = ref_to_continue;
                     }
                 }
+#ifdef MH_SC_MARK
+                // Rather than going through the overflow processing later, give the
+                // object to the mark steal deque so we or an idle heap can mark it.
+                else if (mark_steal_p && mark_steal_deque.push (oo))
+                {
+                    dprintf(3,("mark stack overflow for object %zx, pushed to the mark steal deque", (size_t)oo));
+                }
+#endif //MH_SC_MARK
                 else
                 {
                     dprintf(3,("mark stack overflow for object %zx ", (size_t)oo));
@@ -27979,6 +28468,20 @@ more_to_do:
 #endif //SORT_MARK_STACK
         }
     next_level:
+#ifdef MH_SC_MARK
+        // If other heaps are waiting for work and they've taken everything we
+        // offered so far, offer them the older half of our mark stack.
+        if (mark_steal_p && (mark_steal_idle_count > 0) &&
+            ((mark_stack_tos - mark_stack_base) >= mark_steal_share_th) &&
+            (mark_steal_deque.get_count() == 0))
+        {
+            mark_stack_tos = share_mark_stack (mark_stack_base, mark_stack_tos);
+#ifdef SORT_MARK_STACK
+            sorted_tos = mark_stack_base;
+#endif //SORT_MARK_STACK
+        }
+#endif //MH_SC_MARK
+
         if (!(mark_stack_empty_p()))
         {
             oo = *(--mark_stack_tos);
@@ -27988,11 +28491,61 @@ more_to_do:
             sorted_tos = min ((size_t)sorted_tos, (size_t)mark_stack_tos);
 #endif //SORT_MARK_STACK
         }
+#ifdef MH_SC_MARK
+        else if (mark_steal_p && ((oo = mark_steal_deque.pop()) != nullptr))
+        {
+            // The partial mark code expects the object to still be in the slot
+            // it was popped from.
+            *mark_stack_tos = oo;
+            start = oo;
+        }
+#endif //MH_SC_MARK
         else
             break;
     }
 }
 
+#ifdef MH_SC_MARK
+// Moves the whole objects in the older half of the mark stack [base, tos) to
+// our mark steal deque, as much as it has room for, and compacts what's left.
+// Partial mark tuples stay on the mark stack. Returns the new tos.
+uint8_t** gc_heap::share_mark_stack (uint8_t** mark_stack_base, uint8_t** mark_stack_tos)
+{
+    uint8_t** half = mark_stack_base + (mark_stack_tos - mark_stack_base) / 2;
+    uint8_t** src = mark_stack_base;
+    uint8_t** dest = mark_stack_base;
+
+    while (src < half)
+    {
+        uint8_t* o = *src;
+        if ((src + 1 < mark_stack_tos) && partial_p (*(src + 1)))
+        {
+            // The object and where to continue marking it from.
+            *dest++ = o;
+            *dest++ = *(src + 1);
+            src += 2;
+        }
+        else
+        {
+            // A 0 is a finished partial mark tuple, just drop it.
+            if ((o != 0) && !mark_steal_deque.push (o))
+            {
+                break;
+            }
+            src++;
+        }
+    }
+
+    while (src < mark_stack_tos)
+    {
+        *dest++ = *src++;
+    }
+
+    dprintf (3, ("h%d took %zd entries off its mark stack to share", heap_number, (size_t)(mark_stack_tos - dest)));
+    return dest;
+}
+#endif //MH_SC_MARK
+
 #ifdef MH_SC_MARK
 BOOL same_numa_node_p (int hn1, int hn2)
 {
@@ -28011,212 +28564,162 @@ int find_next_buddy_heap (int this_heap_number, int current_buddy, int n_heaps)
     return current_buddy;
 }
 
-void
-gc_heap::mark_steal()
+// Steals up to half of the objects in the victim's mark steal deque. They go to
+// our own deque so other idle heaps can in turn steal from us while we mark them.
+// Returns how many objects we stole.
+ptrdiff_t gc_heap::steal_mark_work (gc_heap* victim)
 {
-    mark_stack_busy() = 0;
-    //clear the mark stack in the snooping range
-    for (int i = 0; i < max_snoop_level; i++)
-    {
-        ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
-    }
-
-    //pick the next heap as our buddy
-    int thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
+    ptrdiff_t steal_count = min (((victim->mark_steal_deque.get_count() + 1) / 2), mark_steal_deque.get_space());
+    ptrdiff_t stolen_count = 0;
 
+    while (stolen_count < steal_count)
+    {
+        uint8_t* o = victim->mark_steal_deque.steal();
 #ifdef SNOOP_STATS
-        dprintf (SNOOP_LOG, ("(GC%d)heap%d: start snooping %d", settings.gc_index, heap_number, (heap_number+1)%n_heaps));
-        uint64_t begin_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
+        snoop_stat.interlocked_count++;
 #endif //SNOOP_STATS
+        if (o == nullptr)
+        {
+            break;
+        }
 
-    int idle_loop_count = 0;
-    int first_not_ready_level = 0;
+        stolen_count++;
+        if (!mark_steal_deque.push (o))
+        {
+            mark_object_simple1 (o, o, heap_number);
+            break;
+        }
+    }
 
-    while (1)
+    if (stolen_count > 0)
     {
-        gc_heap* hp = g_heaps [thpn];
-        int level = first_not_ready_level;
-        first_not_ready_level = 0;
-
-        while (check_next_mark_stack (hp) && (level < (max_snoop_level-1)))
-        {
-            idle_loop_count = 0;
 #ifdef SNOOP_STATS
-            snoop_stat.busy_count++;
-            dprintf (SNOOP_LOG, ("heap%d: looking at next heap level %d stack contents: %zx",
-                                 heap_number, level, (int)((uint8_t**)(hp->mark_stack_array))[level]));
+        snoop_stat.normal_count += stolen_count;
 #endif //SNOOP_STATS
+        mark_steal_count += stolen_count;
+        Interlocked::ExchangeAdd (&(victim->mark_stolen_from_count), (int32_t)stolen_count);
+    }
 
-            uint8_t* o = ref_mark_stack (hp, level);
+    return stolen_count;
+}
 
-            uint8_t* start = o;
-            if (ref_p (o))
-            {
-                mark_stack_busy() = 1;
+// Called by each heap once it's done marking from its own roots. Steals work from
+// heaps that still have some till all heaps are idle.
+void
+gc_heap::mark_steal()
+{
+    // Our mark stack is empty and mark_object_simple1 already took everything
+    // from our deque that wasn't stolen.
+    assert (mark_steal_deque.get_count() == 0);
+    Interlocked::Increment (&mark_steal_idle_count);
 
-                BOOL success = TRUE;
-                uint8_t* next = (ref_mark_stack (hp, level+1));
-                if (ref_p (next))
-                {
-                    if (((size_t)o > 4) && !partial_object_p (o))
-                    {
-                        //this is a normal object, not a partial mark tuple
-                        //success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level), 0, o)==o);
-                        success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level), (uint8_t*)4, o)==o);
-#ifdef SNOOP_STATS
-                        snoop_stat.interlocked_count++;
-                        if (success)
-                            snoop_stat.normal_count++;
-#endif //SNOOP_STATS
-                    }
-                    else
-                    {
-                        //it is a stolen entry, or beginning/ending of a partial mark
-                        level++;
-#ifdef SNOOP_STATS
-                        snoop_stat.stolen_or_pm_count++;
-#endif //SNOOP_STATS
-                        success = FALSE;
-                    }
-                }
-                else if (stolen_p (next))
-                {
-                    //ignore the stolen guy and go to the next level
-                    success = FALSE;
-                    level+=2;
-#ifdef SNOOP_STATS
-                    snoop_stat.stolen_entry_count++;
-#endif //SNOOP_STATS
-                }
-                else
-                {
-                    assert (partial_p (next));
-                    start = ref_from_slot (next);
-                    //re-read the object
-                    o = ref_from_slot (ref_mark_stack (hp, level));
-                    if (o && start)
-                    {
-                        //steal the object
-                        success = (Interlocked::CompareExchangePointer (&ref_mark_stack (hp, level+1),
-                                                                        (uint8_t*)stolen, next) == next);
-#ifdef SNOOP_STATS
-                        snoop_stat.interlocked_count++;
-                        if (success)
-                        {
-                            snoop_stat.partial_mark_parent_count++;
-                        }
-#endif //SNOOP_STATS
-                    }
-                    else
-                    {
-                        // stack is not ready, or o is completely different from the last time we read from this stack level.
-                        // go up 2 levels to steal children or totally unrelated objects.
-                        success = FALSE;
-                        if (first_not_ready_level == 0)
-                        {
-                            first_not_ready_level = level;
-                        }
-                        level+=2;
-#ifdef SNOOP_STATS
-                        snoop_stat.pm_not_ready_count++;
-#endif //SNOOP_STATS
-                    }
-                }
-                if (success)
-                {
+    //pick the next heap as our buddy
+    int thpn = find_next_buddy_heap (heap_number, heap_number, n_heaps);
 
 #ifdef SNOOP_STATS
-                    dprintf (SNOOP_LOG, ("heap%d: marking %zx from %d [%d] tl:%dms",
-                            heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
-                            (GCToOSInterface::GetLowPrecisionTimeStamp()-begin_tick)));
-                    uint64_t start_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
+    dprintf (SNOOP_LOG, ("(GC%d)heap%d: start stealing from %d", settings.gc_index, heap_number, thpn));
+    uint64_t begin_tick = GCToOSInterface::GetLowPrecisionTimeStamp();
 #endif //SNOOP_STATS
 
-                    mark_object_simple1 (o, start, heap_number);
+    int idle_loop_count = 0;
 
+    while (1)
+    {
+        // Only steal from heaps on other numa nodes once in a while.
+        bool any_node_p = ((idle_loop_count % 1000) == 999);
+        gc_heap* victim = nullptr;
+        for (int i = 0, hpn = thpn; i < n_heaps; i++, hpn = (hpn + 1) % n_heaps)
+        {
 #ifdef SNOOP_STATS
-                    dprintf (SNOOP_LOG, ("heap%d: done marking %zx from %d [%d] %dms tl:%dms",
-                            heap_number, (size_t)o, (heap_number+1)%n_heaps, level,
-                            (GCToOSInterface::GetLowPrecisionTimeStamp()-start_tick),(GCToOSInterface::GetLowPrecisionTimeStamp()-begin_tick)));
+            snoop_stat.check_level_count++;
 #endif //SNOOP_STATS
+            if ((hpn != heap_number) &&
+                (g_heaps[hpn]->mark_steal_deque.get_count() > 0) &&
+                (any_node_p || same_numa_node_p (hpn, heap_number)))
+            {
+                victim = g_heaps[hpn];
+                thpn = hpn;
+                break;
+            }
+        }
 
-                    mark_stack_busy() = 0;
+        if (victim)
+        {
+            idle_loop_count = 0;
 
-                    //clear the mark stack in snooping range
-                    for (int i = 0; i < max_snoop_level; i++)
-                    {
-                        if (((uint8_t**)mark_stack_array)[i] != 0)
-                        {
-                            ((VOLATILE(uint8_t*)*)(mark_stack_array))[i] = 0;
+            // We must not count as idle while we hold work, otherwise other heaps
+            // could see all heaps idle and stop stealing before marking is done.
+            Interlocked::Decrement (&mark_steal_idle_count);
+
+            if (steal_mark_work (victim) > 0)
+            {
 #ifdef SNOOP_STATS
-                            snoop_stat.stack_bottom_clear_count++;
+                dprintf (SNOOP_LOG, ("heap%d: stole from %d tl:%dms",
+                        heap_number, thpn, (GCToOSInterface::GetLowPrecisionTimeStamp()-begin_tick)));
 #endif //SNOOP_STATS
-                        }
-                    }
-
-                    level = 0;
+                // This marks the rest of what we stole as well since it keeps
+                // taking from our deque till its mark stack is empty.
+                uint8_t* o = mark_steal_deque.pop();
+                if (o != nullptr)
+                {
+                    mark_object_simple1 (o, o, heap_number);
                 }
-                mark_stack_busy() = 0;
-            }
-            else
-            {
-                //slot is either partial or stolen
-                level++;
+                drain_mark_queue();
             }
+
+            Interlocked::Increment (&mark_steal_idle_count);
         }
-        if ((first_not_ready_level != 0) && hp->mark_stack_busy())
-        {
-            continue;
-        }
-        if (!hp->mark_stack_busy())
+        else
         {
-            first_not_ready_level = 0;
-            idle_loop_count++;
-
-            if ((idle_loop_count % (6) )==1)
+            if (mark_steal_idle_count == n_heaps)
             {
-#ifdef SNOOP_STATS
-                snoop_stat.switch_to_thread_count++;
-#endif //SNOOP_STATS
-                GCToOSInterface::Sleep(1);
+                break;
             }
-            int free_count = 1;
+
 #ifdef SNOOP_STATS
             snoop_stat.stack_idle_count++;
-            //dprintf (SNOOP_LOG, ("heap%d: counting idle threads", heap_number));
 #endif //SNOOP_STATS
-            for (int hpn = (heap_number+1)%n_heaps; hpn != heap_number;)
+            idle_loop_count++;
+            if ((idle_loop_count % (6)) == 1)
             {
-                if (!((g_heaps [hpn])->mark_stack_busy()))
-                {
-                    free_count++;
 #ifdef SNOOP_STATS
-                dprintf (SNOOP_LOG, ("heap%d: %d idle", heap_number, free_count));
+                snoop_stat.switch_to_thread_count++;
 #endif //SNOOP_STATS
-                }
-                else if (same_numa_node_p (hpn, heap_number) || ((idle_loop_count%1000))==999)
-                {
-                    thpn = hpn;
-                    break;
-                }
-                hpn = (hpn+1)%n_heaps;
-                YieldProcessor();
+                GCToOSInterface::Sleep(1);
             }
-            if (free_count == n_heaps)
+            else
             {
-                break;
+                YieldProcessor();
             }
         }
     }
+
+    assert (mark_steal_deque.get_count() == 0);
+    mark_steal_p = FALSE;
 }
 
-inline
-BOOL gc_heap::check_next_mark_stack (gc_heap* next_heap)
+// Fires one MarkSteal event per heap with how much mark work it took from other
+// heaps and how much was taken from it. Called on one thread after all heaps
+// are done with mark_steal.
+void gc_heap::fire_mark_steal_events()
 {
-#ifdef SNOOP_STATS
-    snoop_stat.check_level_count++;
-#endif //SNOOP_STATS
-    return (next_heap->mark_stack_busy()>=1);
+#ifdef FEATURE_EVENT_TRACE
+    if (!EVENT_ENABLED (GCMarkWithType)) return;
+
+    for (int i = 0; i < n_heaps; i++)
+    {
+        gc_heap* hp = g_heaps[i];
+        dprintf (3, ("h%d stole %zd entries, %d entries stolen from it",
+            i, hp->mark_steal_count, (int)hp->mark_stolen_from_count));
+
+        GCEventFireMarkSteal_V1 (
+            (uint64_t)settings.gc_index,
+            (uint32_t)i,
+            (uint64_t)hp->mark_steal_count,
+            (uint64_t)hp->mark_stolen_from_count
+        );
+    }
+#endif //FEATURE_EVENT_TRACE
 }
 #endif //MH_SC_MARK
 
@@ -30043,16 +30546,9 @@ void gc_heap::mark_phase (int condemned_gen_number)
 #endif //SNOOP_STATS
 
 #ifdef MH_SC_MARK
-    if (full_p)
-    {
-        //initialize the mark stack
-        for (int i = 0; i < max_snoop_level; i++)
-        {
-            ((uint8_t**)(mark_stack_array))[i] = 0;
-        }
-
-        mark_stack_busy() = 1;
-    }
+    mark_steal_deque.init();
+    mark_steal_count = 0;
+    mark_stolen_from_count = 0;
 #endif //MH_SC_MARK
 
     static uint32_t num_sizedrefs = 0;
@@ -30161,12 +30657,18 @@ void gc_heap::mark_phase (int condemned_gen_number)
         {
             do_mark_steal_p = FALSE;
         }
+
+        mark_steal_idle_count = 0;
 #endif //MH_SC_MARK
 
         gc_t_join.restart();
 #endif //MULTIPLE_HEAPS
     }
 
+#ifdef MH_SC_MARK
+    mark_steal_p = do_mark_steal_p;
+#endif //MH_SC_MARK
+
     {
         //set up the mark lists from g_mark_list
         assert (g_mark_list);
@@ -30429,6 +30931,13 @@ void gc_heap::mark_phase (int condemned_gen_number)
         record_mark_time (gc_time_info[time_mark_roots], current_mark_time, last_mark_time);
 #endif //FEATURE_EVENT_TRACE
 
+#ifdef MH_SC_MARK
+        if (do_mark_steal_p)
+        {
+            fire_mark_steal_events();
+        }
+#endif //MH_SC_MARK
+
         uint64_t promoted_bytes_global = 0;
 #ifdef HEAP_ANALYZE
         heap_analyze_enabled = FALSE;
@@ -31639,6 +32148,40 @@ void gc_heap::check_loh_compact_mode (BOOL all_heaps_compacted_p)
     }
 }
 
+#ifdef USE_REGIONS
+// Compacting a LOH region that's mostly live copies a lot of memory to reclaim very
+// little, so plan_loh leaves the survivors in such a region where they are by
+// treating them as pinned.
+bool gc_heap::loh_region_dense_p (heap_segment* region, uint8_t* start)
+{
+    if (loh_compaction_dense_region_percent == 0)
+    {
+        return false;
+    }
+
+    uint8_t* end = heap_segment_allocated (region);
+    if (start >= end)
+    {
+        return false;
+    }
+
+    size_t survived = 0;
+    for (uint8_t* o = start; o < end; o += AlignQword (size (o)))
+    {
+        if (marked (o))
+        {
+            survived += AlignQword (size (o));
+        }
+    }
+
+    size_t region_size = end - start;
+    bool dense_p = (survived >= ((region_size / 100) * loh_compaction_dense_region_percent));
+    dprintf (1235, ("LOH region %p [%p, %p[ survived %zd / %zd, %s",
+        heap_segment_mem (region), start, end, survived, region_size, (dense_p ? "dense" : "compact")));
+    return dense_p;
+}
+#endif //USE_REGIONS
+
 BOOL gc_heap::plan_loh()
 {
 #ifdef FEATURE_EVENT_TRACE
@@ -31697,6 +32240,10 @@ BOOL gc_heap::plan_loh()
     uint8_t* free_space_end = o;
     uint8_t* new_address = 0;
 
+#ifdef USE_REGIONS
+    bool dense_region_p = loh_region_dense_p (seg, o);
+#endif //USE_REGIONS
+
     while (1)
     {
         if (o >= heap_segment_allocated (seg))
@@ -31708,6 +32255,9 @@ BOOL gc_heap::plan_loh()
             }
 
             o = heap_segment_mem (seg);
+#ifdef USE_REGIONS
+            dense_region_p = loh_region_dense_p (seg, o);
+#endif //USE_REGIONS
         }
 
         if (marked (o))
@@ -31716,6 +32266,14 @@ BOOL gc_heap::plan_loh()
             size_t size = AlignQword (size (o));
             dprintf (1235, ("%p(%zd) M", o, size));
 
+#ifdef USE_REGIONS
+            // compact_loh and sweep_uoh_objects both clear the pinned bit.
+            if (dense_region_p && !pinned (o))
+            {
+                set_pinned (o);
+            }
+#endif //USE_REGIONS
+
             if (pinned (o))
             {
                 // We don't clear the pinned bit yet so we can check in
@@ -32266,7 +32824,13 @@ void gc_heap::decide_on_demotion_pin_surv (heap_segment* region, int* no_pinned_
         heap_segment_gen_num (region), (size_t)region, heap_segment_mem (region), pinned_surv, pinned_ratio,
         ((pinned_ratio >= demotion_pinned_ratio_th) ? "ND" : "D")));
 
-    if (pinned_ratio >= demotion_pinned_ratio_th)
+    // If the pins have kept this region from being promoted for long enough they are unlikely to
+    // go away soon, so we stop demoting it. This gets them out of gen0 instead of having every
+    // ephemeral GC plan around them.
+    bool long_lived_pins_p = ((long_lived_pin_gc_count != 0) && (pinned_surv != 0) &&
+                              (heap_segment_pinned_demoted_count (region) >= long_lived_pin_gc_count));
+
+    if ((pinned_ratio >= demotion_pinned_ratio_th) || long_lived_pins_p)
     {
         if (settings.promotion)
         {
@@ -32274,6 +32838,32 @@ void gc_heap::decide_on_demotion_pin_surv (heap_segment* region, int* no_pinned_
         }
     }
 
+    // We keep counting while the region is promoted for its long lived pins so it stays promoted
+    // until they are gone.
+    uint8_t& pinned_demoted_count = heap_segment_pinned_demoted_count (region);
+    if ((pinned_surv != 0) && (long_lived_pins_p || (new_gen_num < get_plan_gen_num (heap_segment_gen_num (region)))))
+    {
+        if (pinned_demoted_count < UINT8_MAX)
+        {
+            pinned_demoted_count++;
+        }
+
+        if (long_lived_pins_p)
+        {
+            num_pinned_regions_long_lived++;
+            dprintf (REGIONS_LOG, ("h%d region %Ix pinned for %d GCs, promoting to g%d",
+                heap_number, heap_segment_mem (region), pinned_demoted_count, new_gen_num));
+        }
+        else
+        {
+            num_pinned_regions_demoted++;
+        }
+    }
+    else
+    {
+        pinned_demoted_count = 0;
+    }
+
     set_region_plan_gen_num (region, new_gen_num);
 }
 
@@ -33454,6 +34044,17 @@ void gc_heap::plan_phase (int condemned_gen_number)
                 {
                     // We need to process the pins on the remaining regions if any.
                     process_remaining_regions (active_new_gen_number, consing_gen);
+
+#ifdef FEATURE_EVENT_TRACE
+                    GCEventFirePinningStats_V1 (
+                        (uint64_t)settings.gc_index,
+                        (uint32_t)heap_number,
+                        (uint64_t)num_pinned_objects,
+                        (uint64_t)mark_stack_tos,
+                        (uint64_t)dd_pinned_survived_size (dynamic_data_of (0)),
+                        (uint32_t)num_pinned_regions_demoted,
+                        (uint32_t)num_pinned_regions_long_lived);
+#endif //FEATURE_EVENT_TRACE
                     break;
                 }
                 else
@@ -41648,6 +42249,44 @@ uint8_t* gc_heap::find_first_object (uint8_t* start, uint8_t* first_object)
     return o;
 }
 
+// Returns the first non-zero card word in [card_word, card_word_end[ or card_word_end
+// if they are all clear. With a large gen2 the card table is mostly clear so we skip
+// clear words a few pointer sized chunks at a time instead of one word at a time.
+inline
+uint32_t* find_non_zero_card_word (uint32_t* card_word, uint32_t* card_word_end)
+{
+    const size_t words_per_chunk = sizeof (size_t) / sizeof (uint32_t);
+    const size_t chunks_per_iteration = 4;
+    const size_t words_per_iteration = words_per_chunk * chunks_per_iteration;
+
+    // Get to a pointer size boundary first so the chunk reads are aligned.
+    while ((card_word < card_word_end) && ((size_t)card_word & (sizeof (size_t) - 1)))
+    {
+        if (*card_word)
+        {
+            return card_word;
+        }
+        card_word++;
+    }
+
+    while ((size_t)(card_word_end - card_word) >= words_per_iteration)
+    {
+        size_t* chunk = (size_t*)card_word;
+        if ((chunk[0] | chunk[1] | chunk[2] | chunk[3]) != 0)
+        {
+            break;
+        }
+        card_word += words_per_iteration;
+    }
+
+    while ((card_word < card_word_end) && !(*card_word))
+    {
+        card_word++;
+    }
+
+    return card_word;
+}
+
 #ifdef CARD_BUNDLE
 // Find the first non-zero card word between cardw and cardw_end.
 // The index of the word we find is returned in cardw.
@@ -41682,10 +42321,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
 
             uint32_t* card_word = &card_table[max(card_bundle_cardw (cardb),cardw)];
             uint32_t* card_word_end = &card_table[min(card_bundle_cardw (cardb+1),cardw_end)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
 
             if (card_word != card_word_end)
             {
@@ -41699,10 +42335,7 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
             }
             // explore the end of the card bundle so we can possibly clear it
             card_word_end = &card_table[card_bundle_cardw (cardb+1)];
-            while ((card_word < card_word_end) && !(*card_word))
-            {
-                card_word++;
-            }
+            card_word = find_non_zero_card_word (card_word, card_word_end);
             if ((cardw <= card_bundle_cardw (cardb)) &&
                 (card_word == card_word_end))
             {
@@ -41719,18 +42352,12 @@ BOOL gc_heap::find_card_dword (size_t& cardw, size_t cardw_end)
     }
     else
     {
-        uint32_t* card_word = &card_table[cardw];
-        uint32_t* card_word_end = &card_table [cardw_end];
+        uint32_t* card_word = find_non_zero_card_word (&card_table[cardw], &card_table [cardw_end]);
 
-        while (card_word < card_word_end)
+        if (card_word < &card_table [cardw_end])
         {
-            if ((*card_word) != 0)
-            {
-                cardw = (card_word - &card_table [0]);
-                return TRUE;
-            }
-
-            card_word++;
+            cardw = (card_word - &card_table [0]);
+            return TRUE;
         }
         return FALSE;
 
@@ -41790,12 +42417,7 @@ BOOL gc_heap::find_card(uint32_t* card_table,
 #else //CARD_BUNDLE
         // Go through the remaining card words between here and card_word_end until we find
         // one that is non-zero.
-        do
-        {
-            ++last_card_word;
-        }
-
-        while ((last_card_word < &card_table [card_word_end]) && !(*last_card_word));
+        last_card_word = find_non_zero_card_word (last_card_word + 1, &card_table [card_word_end]);
         if (last_card_word < &card_table [card_word_end])
         {
             card_word_value = *last_card_word;
@@ -44345,6 +44967,14 @@ size_t gc_heap::desired_new_allocation (dynamic_data* dd,
                         new_allocation = min (new_allocation,
                                               max (min_gc_size, (max_size/3)));
                     }
+
+                    if (pause_goal && (gen0_budget_pause_ratio < 1.0f))
+                    {
+                        size_t new_allocation_for_goal = max (min_gc_size, (size_t)(new_allocation * gen0_budget_pause_ratio));
+                        dprintf (2, ("Reducing new allocation for pause goal %zdus from %zd to %zd",
+                            pause_goal, new_allocation, new_allocation_for_goal));
+                        new_allocation = new_allocation_for_goal;
+                    }
                 }
             }
         }
@@ -46526,6 +47156,12 @@ void gc_heap::background_sweep()
 
     bool rebuild_maxgen_fl_p = true;
 
+#ifdef USE_REGIONS
+    // gen2 regions that are mostly free space after this sweep.
+    size_t sparse_region_count = 0;
+    size_t sparse_region_free_size = 0;
+#endif //USE_REGIONS
+
 #ifdef DOUBLY_LINKED_FL
 #ifdef DYNAMIC_HEAP_COUNT
     rebuild_maxgen_fl_p = trigger_bgc_for_rethreading_p;
@@ -46752,6 +47388,10 @@ void gc_heap::background_sweep()
             // on a seg is unmarked, we will process this in process_background_segment_end.
             size_t free_obj_size_last_gap = 0;
 
+#ifdef USE_REGIONS
+            size_t region_survived = 0;
+#endif //USE_REGIONS
+
             allow_fgc();
             uint8_t* end = background_next_end (seg, (i > max_generation));
             dprintf (3333, ("bgs: seg: %zx, [%zx, %zx[%zx", (size_t)seg,
@@ -46809,6 +47449,9 @@ void gc_heap::background_sweep()
                     {
                         add_gen_plug (max_generation, plug_end-plug_start);
                         dd_survived_size (dd) += (plug_end - plug_start);
+#ifdef USE_REGIONS
+                        region_survived += (plug_end - plug_start);
+#endif //USE_REGIONS
                     }
                     dprintf (3, ("bgs: plug [%zx, %zx[", (size_t)plug_start, (size_t)plug_end));
                 }
@@ -46910,6 +47553,14 @@ void gc_heap::background_sweep()
 
 #ifndef USE_REGIONS
                     assert (next_seg || !delete_p);
+#else //!USE_REGIONS
+                    size_t region_size = end - heap_segment_mem (seg);
+                    if (!delete_p && (region_size > 0) &&
+                        ((region_survived * 100 / region_size) < bgc_sparse_region_surv_ratio_th))
+                    {
+                        sparse_region_count++;
+                        sparse_region_free_size += region_size - region_survived;
+                    }
 #endif //!USE_REGIONS
                 }
             }
@@ -46982,6 +47633,19 @@ void gc_heap::background_sweep()
         generation_free_list_space (generation_of (max_generation)),
         generation_free_obj_space (generation_of (max_generation))));
 
+#ifdef USE_REGIONS
+    dprintf (GTC_LOG, ("h%d: end of bgc sweep: %zd sparse gen2 regions with %zd free",
+        heap_number, sparse_region_count, sparse_region_free_size));
+
+#ifdef FEATURE_EVENT_TRACE
+    GCEventFireBGCSparseRegions_V1 (
+        (uint64_t)VolatileLoad (&settings.gc_index),
+        (uint32_t)heap_number,
+        (uint64_t)sparse_region_count,
+        (uint64_t)sparse_region_free_size);
+#endif //FEATURE_EVENT_TRACE
+#endif //USE_REGIONS
+
     dprintf (GTC_LOG, ("h%d: end of bgc sweep: loh FL: %zd, FO: %zd",
         heap_number,
         generation_free_list_space (generation_of (loh_generation)),
@@ -48307,6 +48971,7 @@ gc_heap::verify_free_lists ()
         }
     }
 }
+#endif //VERIFY_HEAP
 
 void gc_heap::verify_committed_bytes_per_heap()
 {
@@ -48449,16 +49114,6 @@ void gc_heap::verify_regions (bool can_verify_gen_num, bool concurrent_p)
 }
 #endif // USE_REGIONS
 
-BOOL gc_heap::check_need_card (uint8_t* child_obj, int gen_num_for_cards,
-                               uint8_t* low, uint8_t* high)
-{
-#ifdef USE_REGIONS
-    return (is_in_heap_range (child_obj) && (get_region_gen_num (child_obj) < gen_num_for_cards));
-#else
-    return ((child_obj < high) && (child_obj >= low));
-#endif //USE_REGIONS
-}
-
 void gc_heap::enter_gc_lock_for_verify_heap()
 {
 #ifdef VERIFY_HEAP
@@ -48481,6 +49136,17 @@ void gc_heap::leave_gc_lock_for_verify_heap()
 #endif // VERIFY_HEAP
 }
 
+#ifdef VERIFY_HEAP
+BOOL gc_heap::check_need_card (uint8_t* child_obj, int gen_num_for_cards,
+                               uint8_t* low, uint8_t* high)
+{
+#ifdef USE_REGIONS
+    return (is_in_heap_range (child_obj) && (get_region_gen_num (child_obj) < gen_num_for_cards));
+#else
+    return ((child_obj < high) && (child_obj >= low));
+#endif //USE_REGIONS
+}
+
 void gc_heap::verify_heap (BOOL begin_gc_p)
 {
     int heap_verify_level = static_cast<int>(GCConfig::GetHeapVerifyLevel());
@@ -49210,6 +49876,10 @@ HRESULT GCHeap::Initialize()
     bool compute_memory_settings_succeed = gc_heap::compute_memory_settings(true, nhp, nhp_from_config, seg_size_from_config, 0);
     assert (compute_memory_settings_succeed);
 
+    // Large pages can't be reserved without also being committed, so the GC reserves and commits
+    // the whole range up front and needs a hard limit to bound it. This is also true with regions -
+    // we don't back individual regions with large pages on demand, and decommit works at normal
+    // page granularity, so unbounded heaps can't use large pages.
     if ((!gc_heap::heap_hard_limit) && gc_heap::use_large_pages_p)
     {
         return CLR_E_GC_LARGE_PAGE_MISSING_HARD_LIMIT;
@@ -49296,6 +49966,7 @@ HRESULT GCHeap::Initialize()
 
 #ifdef USE_REGIONS
     gc_heap::enable_special_regions_p = (bool)GCConfig::GetGCEnableSpecialRegions();
+    gc_heap::long_lived_pin_gc_count = (int)min ((int64_t)UINT8_MAX, max ((int64_t)0, (int64_t)GCConfig::GetGCLongLivedPinGCCount()));
     size_t gc_region_size = (size_t)GCConfig::GetGCRegionSize();
 
     if (gc_region_size >= MAX_REGION_SIZE)
@@ -51145,6 +51816,36 @@ void gc_heap::update_recorded_gen_data (last_recorded_gc_info* gc_info)
     }
 }
 
+// Ephemeral GC pauses mostly depend on how much survives, and less gen0 budget means
+// less time for objects to die but also fewer objects to mark and copy. So when the last
+// ephemeral GC paused longer than the goal we reduce the gen0 budget in proportion, and when
+// it's comfortably below the goal we let the budget grow back towards what it would be
+// without a goal.
+void gc_heap::update_gen0_budget_pause_ratio (size_t pause_duration)
+{
+    // Never go below this so a goal that can't be met won't cause GCs non stop.
+    const float min_ratio = 0.1f;
+    // How far under the goal a pause needs to be for us to grow the budget back.
+    const float grow_back_th = 0.75f;
+    const float grow_back_step = 1.1f;
+
+    float ratio = gen0_budget_pause_ratio;
+    if (pause_duration > pause_goal)
+    {
+        ratio *= max (0.5f, (float)pause_goal / (float)pause_duration);
+    }
+    else if (pause_duration < (size_t)(pause_goal * grow_back_th))
+    {
+        ratio *= grow_back_step;
+    }
+
+    ratio = min (1.0f, max (min_ratio, ratio));
+
+    dprintf (6666, ("pause %zdus, goal %zdus, gen0 budget ratio %.3f->%.3f",
+        pause_duration, pause_goal, gen0_budget_pause_ratio, ratio));
+    gen0_budget_pause_ratio = ratio;
+}
+
 void gc_heap::do_post_gc()
 {
 #ifdef MULTIPLE_HEAPS
@@ -51263,6 +51964,11 @@ void gc_heap::do_post_gc()
         last_gc_info->pause_durations[0] = pause_duration;
         total_suspended_time += pause_duration;
         last_gc_info->pause_durations[1] = 0;
+
+        if (pause_goal && (settings.condemned_generation < max_generation))
+        {
+            update_gen0_budget_pause_ratio (pause_duration);
+        }
     }
 
     uint64_t total_process_time = end_gc_time - process_start_time;
@@ -51696,8 +52402,17 @@ bool GCHeap::IsThreadUsingAllocationContextHeap(gc_alloc_context* context, int t
     assert ((acontext->get_home_heap() == 0) ||
             (acontext->get_home_heap()->pGenGCHeap->heap_number < gc_heap::n_heaps));
 
-    return ((acontext->get_home_heap() == GetHeap(thread_number)) ||
-            ((acontext->get_home_heap() == 0) && (thread_number == 0)));
+    if (acontext->get_home_heap() != 0)
+    {
+        return (acontext->get_home_heap() == GetHeap(thread_number));
+    }
+
+    // Threads that have not allocated yet have no home heap. Spread them across the GC threads
+    // instead of leaving all of them to thread 0, which dominates the stack scanning time when a
+    // process has many threads that rarely allocate. The alloc context addresses are stable and
+    // distinct per thread, so each such thread is still scanned by exactly one GC thread.
+    size_t context_index = (size_t)acontext / sizeof (alloc_context);
+    return ((int)(context_index % (size_t)gc_heap::n_heaps) == thread_number);
 #else
     UNREFERENCED_PARAMETER(acontext);
     UNREFERENCED_PARAMETER(thread_number);
@@ -52163,6 +52878,22 @@ Object* GCHeap::GetNextFinalizableObject()
 
 }
 
+Object* GCHeap::GetNextNonCriticalFinalizableObject()
+{
+#ifdef MULTIPLE_HEAPS
+    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+        Object* O = hp->finalize_queue->GetNextFinalizableObject(TRUE);
+        if (O)
+            return O;
+    }
+    return 0;
+#else //MULTIPLE_HEAPS
+    return pGenGCHeap->finalize_queue->GetNextFinalizableObject(TRUE);
+#endif //MULTIPLE_HEAPS
+}
+
 size_t GCHeap::GetNumberFinalizableObjects()
 {
 #ifdef MULTIPLE_HEAPS
@@ -53003,6 +53734,87 @@ void gc_heap::walk_heap (walk_fn fn, void* context, int gen_number, BOOL walk_la
 #endif //MULTIPLE_HEAPS
 }
 
+// Walks objects in address order, region by region, until budget bytes have been
+// visited. The cursor is the next object to visit; if a GC happened since it was
+// recorded objects may have moved, so we restart from the beginning of the region
+// it's in. That means objects compacted across the cursor by the GC can be missed
+// or visited twice, which is acceptable for diagnostics that ask for a chunked walk.
+// Without regions there's no cheap way to find a resume point so we walk
+// everything in one go.
+bool gc_heap::walk_heap_chunk (walk_fn fn, void* context, gc_heap_walk_cursor* cursor, size_t budget)
+{
+#ifdef USE_REGIONS
+    uint8_t* regions_start = global_region_allocator.get_start();
+    uint8_t* regions_end = global_region_allocator.get_left_used_unsafe();
+    uint8_t* x = cursor->next_object;
+    bool region_restart_p = (cursor->gc_index != (size_t)settings.gc_index);
+
+    if ((x < regions_start) || (x >= regions_end))
+    {
+        x = regions_start;
+        region_restart_p = true;
+    }
+
+    size_t walked = 0;
+
+    while (x < regions_end)
+    {
+        heap_segment* region = get_region_info_for_address (x);
+
+        if (is_free_region (region))
+        {
+            x = align_on_segment (x + 1);
+            region_restart_p = true;
+            continue;
+        }
+
+        uint8_t* end = heap_segment_allocated (region);
+        if (region_restart_p || (x < heap_segment_mem (region)))
+        {
+            x = heap_segment_mem (region);
+            region_restart_p = false;
+        }
+
+        int align_const = get_alignment_constant (!heap_segment_uoh_p (region));
+
+        while (x < end)
+        {
+            if (walked >= budget)
+            {
+                cursor->next_object = x;
+                cursor->gc_index = (size_t)settings.gc_index;
+                return true;
+            }
+
+            size_t s = size (x);
+            CObjectHeader* o = (CObjectHeader*)x;
+
+            if (!o->IsFree())
+            {
+                if (!fn (o->GetObjectBase(), context))
+                    return false;
+            }
+
+            s = Align (s, align_const);
+            walked += s;
+            x += s;
+        }
+
+        x = heap_segment_reserved (region);
+        region_restart_p = true;
+    }
+
+    cursor->next_object = regions_end;
+    cursor->gc_index = (size_t)settings.gc_index;
+    return false;
+#else
+    UNREFERENCED_PARAMETER(cursor);
+    UNREFERENCED_PARAMETER(budget);
+    walk_heap (fn, context, max_generation, TRUE);
+    return false;
+#endif //USE_REGIONS
+}
+
 void GCHeap::DiagWalkObject (Object* obj, walk_fn fn, void* context)
 {
     uint8_t* o = (uint8_t*)obj;
@@ -53089,6 +53901,35 @@ void GCHeap::DiagWalkHeapWithACHandling (walk_fn fn, void* context, int gen_numb
     }
 }
 
+bool GCHeap::DiagWalkHeapChunk (walk_fn fn, void* context, gc_heap_walk_cursor* cursor, size_t budget)
+{
+#ifdef MULTIPLE_HEAPS
+    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+#else
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        hp->fix_allocation_contexts (FALSE);
+    }
+
+    bool more_p = gc_heap::walk_heap_chunk (fn, context, cursor, budget);
+
+#ifdef MULTIPLE_HEAPS
+    for (int hn = 0; hn < gc_heap::n_heaps; hn++)
+    {
+        gc_heap* hp = gc_heap::g_heaps [hn];
+#else
+    {
+        gc_heap* hp = pGenGCHeap;
+#endif //MULTIPLE_HEAPS
+        hp->repair_allocation_contexts (TRUE);
+    }
+
+    return more_p;
+}
+
 void GCHeap::DiagWalkFinalizeQueue (void* gc_context, fq_walk_fn fn)
 {
     gc_heap* hp = (gc_heap*)gc_context;
@@ -53540,6 +54381,42 @@ int GCHeap::RefreshMemoryLimit()
     return gc_heap::refresh_memory_limit();
 }
 
+set_dynamic_adaptation_status GCHeap::SetDynamicAdaptationSettings(int min_heap_count, int max_heap_count, float target_tcp)
+{
+#ifdef DYNAMIC_HEAP_COUNT
+    if (gc_heap::dynamic_adaptation_mode != dynamic_adaptation_to_application_sizes)
+    {
+        return set_dynamic_adaptation_not_enabled;
+    }
+
+    if ((min_heap_count < 0) || (max_heap_count < 0) ||
+        ((max_heap_count != 0) && (min_heap_count > max_heap_count)) ||
+        !(target_tcp >= 0.0f) || (target_tcp >= 100.0f))
+    {
+        return set_dynamic_adaptation_invalid_argument;
+    }
+
+    dprintf (6666, ("DATAS settings: HC [%d, %d], target tcp %.3f", min_heap_count, max_heap_count, target_tcp));
+
+    // These are only read when the GC decides on a new heap count so we don't need to
+    // synchronize with it; a decision that races with this call just uses the old settings.
+    gc_heap::dynamic_heap_count_data_t& hc_data = gc_heap::dynamic_heap_count_data;
+    VolatileStore (&hc_data.min_heap_count_limit, min_heap_count);
+    VolatileStore (&hc_data.max_heap_count_limit, max_heap_count);
+    if (target_tcp > 0.0f)
+    {
+        VolatileStore (&hc_data.target_tcp, target_tcp);
+    }
+
+    return set_dynamic_adaptation_succeed;
+#else //DYNAMIC_HEAP_COUNT
+    UNREFERENCED_PARAMETER(min_heap_count);
+    UNREFERENCED_PARAMETER(max_heap_count);
+    UNREFERENCED_PARAMETER(target_tcp);
+    return set_dynamic_adaptation_not_enabled;
+#endif //DYNAMIC_HEAP_COUNT
+}
+
 bool gc_heap::compute_hard_limit()
 {
     heap_hard_limit_oh[soh] = 0;
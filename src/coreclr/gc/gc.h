@@ -219,6 +219,31 @@ void record_global_mechanism (int mech_index);
 
 struct alloc_context : gc_alloc_context
 {
+    // How the alloc_quantum_state field is organized -
+    //
+    // high 8 bits store the signed log2 scale applied to the allocation quantum for this context.
+    // next 8 bits store the low byte of the GC index at which refill counting last restarted.
+    // low 16 bits count the SOH refills of this context since then.
+    inline int get_quantum_scale()
+    {
+        return (int8_t)(alloc_quantum_state >> 24);
+    }
+
+    inline uint8_t get_quantum_gc_index()
+    {
+        return (uint8_t)(alloc_quantum_state >> 16);
+    }
+
+    inline uint16_t get_quantum_refill_count()
+    {
+        return (uint16_t)alloc_quantum_state;
+    }
+
+    inline void set_quantum_state (int scale, uint8_t gc_index, uint16_t refill_count)
+    {
+        alloc_quantum_state = ((unsigned int)(uint8_t)scale << 24) | ((unsigned int)gc_index << 16) | refill_count;
+    }
+
 #ifdef FEATURE_SVR_GC
     inline SVR::GCHeap* get_alloc_heap()
     {
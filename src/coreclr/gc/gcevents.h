@@ -52,6 +52,10 @@ DYNAMIC_EVENT(CommittedUsage, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationTuning, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationFullGCTuning, GCEventLevel_Information, GCEventKeyword_GC, 1)
 DYNAMIC_EVENT(SizeAdaptationSample, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(MarkSteal, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(BGCSparseRegions, GCEventLevel_Information, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(AllocationQuantum, GCEventLevel_Verbose, GCEventKeyword_GC, 1)
+DYNAMIC_EVENT(PinningStats, GCEventLevel_Information, GCEventKeyword_GC, 1)
 
 #undef KNOWN_EVENT
 #undef DYNAMIC_EVENT
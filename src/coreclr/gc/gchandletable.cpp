@@ -107,6 +107,13 @@ GCHandleStore::~GCHandleStore()
     ::Ref_DestroyHandleTableBucket(&_underlyingBucket);
 }
 
+uint32_t GCHandleStore::CreateHandlesOfType(HandleType type, OBJECTHANDLE* handles, uint32_t count)
+{
+    // a batch all comes from one table so it can be satisfied in one go
+    HHANDLETABLE handletable = _underlyingBucket.pTable[GetCurrentThreadHomeHeapNumber()];
+    return ::HndCreateHandles(handletable, type, handles, count);
+}
+
 bool GCHandleManager::Initialize()
 {
     return Ref_Initialize();
@@ -222,3 +229,23 @@ void GCHandleManager::TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t
     ::Ref_TraceRefCountHandles(callback, param1, param2);
 }
 
+void GCHandleManager::DestroyHandlesOfType(const OBJECTHANDLE* handles, uint32_t count, HandleType type)
+{
+    // The handles only have to come from the same store, and a store has a table per heap,
+    // so free each run of handles that share a table back to that table.
+    uint32_t start = 0;
+    while (start < count)
+    {
+        HHANDLETABLE handletable = ::HndGetHandleTable(handles[start]);
+
+        uint32_t end = start + 1;
+        while ((end < count) && (::HndGetHandleTable(handles[end]) == handletable))
+        {
+            end++;
+        }
+
+        ::HndDestroyHandles(handletable, type, &handles[start], end - start);
+        start = end;
+    }
+}
+
@@ -24,6 +24,8 @@ public:
 
     virtual ~GCHandleStore();
 
+    virtual uint32_t CreateHandlesOfType(HandleType type, OBJECTHANDLE* handles, uint32_t count);
+
     HandleTableBucket _underlyingBucket;
 
 private:
@@ -70,6 +72,8 @@ public:
     virtual HandleType HandleFetchType(OBJECTHANDLE handle);
 
     virtual void TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t param1, uintptr_t param2);
+
+    virtual void DestroyHandlesOfType(const OBJECTHANDLE* handles, uint32_t count, HandleType type);
 };
 
 #endif  // GCHANDLETABLE_H_
@@ -209,6 +209,7 @@ public:
     unsigned GetGcCount();
 
     Object* GetNextFinalizable() { return GetNextFinalizableObject(); };
+    Object* GetNextNonCriticalFinalizable() { return GetNextNonCriticalFinalizableObject(); }
     size_t GetNumberOfFinalizable() { return GetNumberFinalizableObjects(); }
 
     size_t GetValidSegmentSize(bool large_seg = false);
@@ -216,6 +217,7 @@ public:
     void SetReservedVMLimit (size_t vmlimit);
 
     PER_HEAP_ISOLATED Object* GetNextFinalizableObject();
+    PER_HEAP_ISOLATED Object* GetNextNonCriticalFinalizableObject();
     PER_HEAP_ISOLATED size_t GetNumberFinalizableObjects();
     PER_HEAP_ISOLATED size_t GetFinalizablePromotedCount();
 
@@ -318,6 +320,8 @@ protected:
     virtual unsigned int GetGenerationWithRange(Object* object, uint8_t** ppStart, uint8_t** ppAllocated, uint8_t** ppReserved);
 
     virtual void DiagWalkHeapWithACHandling(walk_fn fn, void* context, int gen_number, bool walk_large_object_heap_p);
+
+    virtual bool DiagWalkHeapChunk(walk_fn fn, void* context, gc_heap_walk_cursor* cursor, size_t budget);
 public:
     Object * NextObj (Object * object);
 
@@ -330,6 +334,8 @@ public:
     static void ReportGenerationBounds();
 
     virtual int RefreshMemoryLimit();
+
+    virtual set_dynamic_adaptation_status SetDynamicAdaptationSettings(int min_heap_count, int max_heap_count, float target_tcp);
 };
 
 #endif  // GCIMPL_H_
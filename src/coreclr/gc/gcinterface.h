@@ -11,7 +11,7 @@
 // The minor version of the IGCHeap interface. Non-breaking changes are required
 // to bump the minor version number. GCs and EEs with minor version number
 // mismatches can still interoperate correctly, with some care.
-#define GC_INTERFACE_MINOR_VERSION 4
+#define GC_INTERFACE_MINOR_VERSION 8
 
 // The major version of the IGCToCLR interface. Breaking changes to this interface
 // require bumps in the major version number.
@@ -174,6 +174,8 @@ struct gc_alloc_context
     void*          gc_reserved_1;
     void*          gc_reserved_2;
     int            alloc_count;
+    // Used by the GC to size the allocation quantum of this context based on how often it is refilled.
+    unsigned int   alloc_quantum_state;
 public:
 
     void init()
@@ -187,6 +189,7 @@ public:
         gc_reserved_1 = 0;
         gc_reserved_2 = 0;
         alloc_count = 0;
+        alloc_quantum_state = 0;
     }
 };
 
@@ -351,6 +354,14 @@ enum enable_no_gc_region_callback_status
     already_registered,
 };
 
+enum set_dynamic_adaptation_status
+{
+    set_dynamic_adaptation_succeed = 0,
+    // DATAS is not in use, so there is no heap count to adapt.
+    set_dynamic_adaptation_not_enabled = 1,
+    set_dynamic_adaptation_invalid_argument = 2,
+};
+
 enum gc_kind
 {
     gc_kind_any = 0,           // any of the following kind
@@ -525,6 +536,14 @@ typedef void (* fq_scan_fn)(Object** ppObject, ScanContext *pSC, uint32_t dwFlag
 typedef void (* handle_scan_fn)(Object** pRef, Object* pSec, uint32_t flags, ScanContext* context, bool isDependent);
 typedef bool (* async_pin_enum_fn)(Object* object, void* context);
 
+// Position of a chunked heap walk (see IGCHeap::DiagWalkHeapChunk). Zero initialize it
+// before the first call; its contents are private to the GC.
+struct gc_heap_walk_cursor
+{
+    uint8_t* next_object;
+    size_t gc_index;
+};
+
 // Implement pure virtual for NativeAOT Unix (for -p:LinkStandardCPlusPlusLibrary=false the default),
 // to avoid linker requiring __cxa_pure_virtual.
 #if defined(FEATURE_NATIVEAOT) && !defined(TARGET_WINDOWS)
@@ -550,6 +569,9 @@ public:
     virtual OBJECTHANDLE CreateDependentHandle(Object* primary, Object* secondary) PURE_VIRTUAL
 
     virtual ~IGCHandleStore() {};
+
+    // Creates count null handles of the given type, returning how many were created.
+    virtual uint32_t CreateHandlesOfType(HandleType type, OBJECTHANDLE* handles, uint32_t count) PURE_VIRTUAL
 };
 
 class IGCHandleManager {
@@ -590,6 +612,9 @@ public:
     virtual HandleType HandleFetchType(OBJECTHANDLE handle) PURE_VIRTUAL
 
     virtual void TraceRefCountedHandles(HANDLESCANPROC callback, uintptr_t param1, uintptr_t param2) PURE_VIRTUAL
+
+    // Destroys count handles of the given type that were all created from the same store.
+    virtual void DestroyHandlesOfType(const OBJECTHANDLE* handles, uint32_t count, HandleType type) PURE_VIRTUAL
 };
 
 // Enum representing the type to be passed to GC.CoreCLR.cs used to deduce the type of configuration.
@@ -1022,6 +1047,22 @@ public:
 
     // Walk the heap object by object outside of a GC.
     virtual void DiagWalkHeapWithACHandling(walk_fn fn, void* context, int gen_number, bool walk_large_object_heap_p) PURE_VIRTUAL
+
+    // Walk the next chunk of the heap outside of a GC, visiting roughly budget bytes of objects
+    // starting where the previous call described by cursor left off. Like DiagWalkHeapWithACHandling
+    // the EE must be suspended for the duration of each call, but it can be resumed between calls so
+    // a large heap can be walked without one long pause. Returns true if there is more to walk.
+    virtual bool DiagWalkHeapChunk(walk_fn fn, void* context, gc_heap_walk_cursor* cursor, size_t budget) PURE_VIRTUAL
+
+    // Gets the next finalizable object that does not have a critical finalizer, or null once only
+    // critical finalizers (which must run after all the others) are left. Safe to call from several
+    // threads at once.
+    virtual Object* GetNextNonCriticalFinalizable() PURE_VIRTUAL
+
+    // Bounds the heap counts DATAS adapts between and sets the GC throughput cost percentage it
+    // aims for. A heap count of 0 removes that bound and a target_tcp of 0 leaves the current
+    // target unchanged. The new settings take effect at the next heap count decision.
+    virtual set_dynamic_adaptation_status SetDynamicAdaptationSettings(int min_heap_count, int max_heap_count, float target_tcp) PURE_VIRTUAL
 };
 
 #ifdef WRITE_BARRIER_CHECK
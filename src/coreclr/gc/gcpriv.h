@@ -209,13 +209,6 @@ inline void FATAL_GC_ERROR()
 //#define SNOOP_STATS //diagnostic
 #endif //SERVER_GC
 
-//This is used to mark some type volatile only when the scalable marking is used.
-#if defined (SERVER_GC) && defined (MH_SC_MARK)
-#define SERVER_SC_MARK_VOLATILE(x) VOLATILE(x)
-#else //SERVER_GC&&MH_SC_MARK
-#define SERVER_SC_MARK_VOLATILE(x) x
-#endif //SERVER_GC&&MH_SC_MARK
-
 //#define MULTIPLE_HEAPS         //Allow multiple heaps for servers
 
 #define CARD_BUNDLE         //enable card bundle feature.(requires WRITE_WATCH)
@@ -1316,6 +1309,24 @@ struct spinlock_info
 
 #define HS_CACHE_LINE_SIZE 128
 
+#ifndef MULTIPLE_HEAPS
+// With GCNurseryPerCore, workstation GC refills allocation contexts from a chunk of gen0 that belongs
+// to the core the thread is running on. Only refilling a chunk takes more_space_lock_soh so threads on
+// different cores mostly don't contend with each other. The unused part of a chunk is always kept
+// formatted as a free object since nothing outside of the GC knows about these chunks.
+struct nursery_slot
+{
+    RAW_KEYWORD(volatile) int32_t lock;
+    alloc_context chunk;
+    // Accounting for the contexts refilled from this slot that needs the msl to be updated. It's
+    // folded into gen0 and total_alloc_bytes_soh during the next GC.
+    size_t free_obj_space;
+    size_t unused_alloc_bytes;
+    // Keeps the slots of different cores on different cache lines.
+    uint8_t padding[HS_CACHE_LINE_SIZE];
+};
+#endif //!MULTIPLE_HEAPS
+
 #ifdef SNOOP_STATS
 struct snoop_stats_data
 {
@@ -1504,6 +1515,37 @@ public:
     void verify_empty();
 };
 
+#ifdef MH_SC_MARK
+// A bounded Chase-Lev work-stealing deque of objects whose children still need
+// to be marked. Only the owning heap pushes and pops, at the bottom; other heaps
+// steal the oldest entries from the top with a CAS. When the deque is full the
+// owner keeps the work on its own mark stack or records it as mark overflow.
+class mark_steal_deque_t
+{
+    // Must be a power of 2.
+    static const int32_t slot_count = 2048;
+
+    // top is written by thieves and bottom by the owner so keep them on
+    // different cache lines.
+    VOLATILE(int32_t) top;
+    uint8_t padding0[HS_CACHE_LINE_SIZE - sizeof(int32_t)];
+    VOLATILE(int32_t) bottom;
+    uint8_t padding1[HS_CACHE_LINE_SIZE - sizeof(int32_t)];
+    uint8_t* slot_table[slot_count];
+
+public:
+    mark_steal_deque_t();
+
+    void init();
+    ptrdiff_t get_count();
+    ptrdiff_t get_space();
+
+    bool push (uint8_t* o);
+    uint8_t* pop();
+    uint8_t* steal();
+};
+#endif //MH_SC_MARK
+
 float median_of_3 (float a, float b, float c);
 
 //class definition of the internal class
@@ -1617,14 +1659,15 @@ private:
 
     PER_HEAP_METHOD void verify_soh_segment_list();
 
-#ifdef VERIFY_HEAP
-    PER_HEAP_METHOD void verify_free_lists();
 #if defined (USE_REGIONS)
     PER_HEAP_METHOD void verify_regions (int gen_number, bool can_verify_gen_num, bool can_verify_tail);
     PER_HEAP_METHOD void verify_regions (bool can_verify_gen_num, bool concurrent_p);
 #endif //USE_REGIONS
     PER_HEAP_ISOLATED_METHOD void enter_gc_lock_for_verify_heap();
     PER_HEAP_ISOLATED_METHOD void leave_gc_lock_for_verify_heap();
+
+#ifdef VERIFY_HEAP
+    PER_HEAP_METHOD void verify_free_lists();
     PER_HEAP_METHOD void verify_heap (BOOL begin_gc_p);
     PER_HEAP_METHOD BOOL check_need_card (uint8_t* child_obj, int gen_num_for_cards,
                           uint8_t* low, uint8_t* high);
@@ -1816,6 +1859,8 @@ private:
 
     PER_HEAP_ISOLATED_METHOD void do_post_gc();
 
+    PER_HEAP_ISOLATED_METHOD void update_gen0_budget_pause_ratio (size_t pause_duration);
+
     PER_HEAP_ISOLATED_METHOD void update_recorded_gen_data (last_recorded_gc_info* gc_info);
 
     PER_HEAP_METHOD void update_end_gc_time_per_heap();
@@ -2140,6 +2185,8 @@ private:
 
     PER_HEAP_METHOD void walk_heap_per_heap (walk_fn fn, void* context, int gen_number, BOOL walk_large_object_heap_p);
 
+    PER_HEAP_ISOLATED_METHOD bool walk_heap_chunk (walk_fn fn, void* context, gc_heap_walk_cursor* cursor, size_t budget);
+
     struct walk_relocate_args
     {
         uint8_t* last_plug;
@@ -2267,7 +2314,9 @@ private:
                           size_t& last_promoted_bytes);
 
     PER_HEAP_METHOD size_t limit_from_size (size_t size, uint32_t flags, size_t room, int gen_number,
-                            int align_const);
+                            alloc_context* acontext, int align_const);
+    PER_HEAP_METHOD size_t get_allocation_quantum (alloc_context* acontext);
+    PER_HEAP_METHOD void update_allocation_quantum_scale (alloc_context* acontext);
     PER_HEAP_METHOD allocation_state try_allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
                                               int alloc_generation_number);
     PER_HEAP_ISOLATED_METHOD BOOL allocate_more_space (alloc_context* acontext, size_t jsize, uint32_t flags,
@@ -2412,6 +2461,12 @@ private:
     PER_HEAP_METHOD void fix_youngest_allocation_area();
     PER_HEAP_METHOD void fix_allocation_context (alloc_context* acontext, BOOL for_gc_p,
                                  BOOL record_ac_p);
+#ifndef MULTIPLE_HEAPS
+    PER_HEAP_ISOLATED_METHOD void init_nursery_slots();
+    PER_HEAP_METHOD void fix_nursery_slots (BOOL for_gc_p);
+    PER_HEAP_ISOLATED_METHOD void void_nursery_slots();
+    PER_HEAP_METHOD BOOL allocate_from_nursery_slot (alloc_context* acontext, size_t size);
+#endif //!MULTIPLE_HEAPS
     PER_HEAP_METHOD void fix_older_allocation_area (generation* older_gen);
     PER_HEAP_METHOD void set_allocation_heap_segment (generation* gen);
     PER_HEAP_METHOD void reset_allocation_pointers (generation* gen, uint8_t* start);
@@ -2719,10 +2774,6 @@ private:
     PER_HEAP_METHOD mark* before_oldest_pin();
     PER_HEAP_METHOD BOOL pinned_plug_que_empty_p ();
     PER_HEAP_METHOD void make_mark_stack (mark* arr);
-#ifdef MH_SC_MARK
-    PER_HEAP_METHOD int& mark_stack_busy();
-    PER_HEAP_METHOD VOLATILE(uint8_t*)& ref_mark_stack (gc_heap* hp, int index);
-#endif
 #ifdef BACKGROUND_GC
     PER_HEAP_ISOLATED_METHOD size_t&  bpromoted_bytes (int);
     PER_HEAP_METHOD void make_background_mark_stack (uint8_t** arr);
@@ -2741,6 +2792,8 @@ private:
     PER_HEAP_METHOD void drain_mark_queue();
 
 #ifdef MH_SC_MARK
+    PER_HEAP_METHOD uint8_t** share_mark_stack (uint8_t** mark_stack_base, uint8_t** mark_stack_tos);
+    PER_HEAP_METHOD ptrdiff_t steal_mark_work (gc_heap* victim);
     PER_HEAP_METHOD void mark_steal ();
 #endif //MH_SC_MARK
 
@@ -2822,7 +2875,7 @@ private:
 #endif //SNOOP_STATS
 
 #ifdef MH_SC_MARK
-    PER_HEAP_METHOD BOOL check_next_mark_stack (gc_heap* next_heap);
+    PER_HEAP_ISOLATED_METHOD void fire_mark_steal_events();
 #endif //MH_SC_MARK
 
     PER_HEAP_METHOD void scan_dependent_handles (int condemned_gen_number, ScanContext *sc, BOOL initial_scan_p);
@@ -2929,6 +2982,10 @@ private:
 
     PER_HEAP_METHOD uint8_t* loh_allocate_in_condemned (size_t size);
 
+#ifdef USE_REGIONS
+    PER_HEAP_METHOD bool loh_region_dense_p (heap_segment* region, uint8_t* start);
+#endif //USE_REGIONS
+
     PER_HEAP_ISOLATED_METHOD BOOL loh_object_p (uint8_t* o);
 
     PER_HEAP_ISOLATED_METHOD BOOL loh_compaction_requested();
@@ -3577,6 +3634,19 @@ private:
     PER_HEAP_FIELD_SINGLE_GC snoop_stats_data snoop_stat;
 #endif //SNOOP_STATS
 
+#ifdef MH_SC_MARK
+    // Objects this heap offers to other heaps to mark.
+    PER_HEAP_FIELD_SINGLE_GC mark_steal_deque_t mark_steal_deque;
+    // Set while this heap takes part in work stealing for the current mark phase,
+    // ie, from the beginning of the mark phase till it leaves mark_steal.
+    PER_HEAP_FIELD_SINGLE_GC BOOL mark_steal_p;
+    // Number of objects this heap stole from other heaps in mark_steal.
+    PER_HEAP_FIELD_SINGLE_GC size_t mark_steal_count;
+    // Number of objects other heaps stole from this heap. Updated by the
+    // stealing threads so it needs to be updated with an interlocked op.
+    PER_HEAP_FIELD_SINGLE_GC VOLATILE(int32_t) mark_stolen_from_count;
+#endif //MH_SC_MARK
+
 #ifdef BGC_SERVO_TUNING
     PER_HEAP_FIELD_SINGLE_GC size_t     bgc_maxgen_end_fl_size;
 #endif //BGC_SERVO_TUNING
@@ -3587,6 +3657,11 @@ private:
     // It's used in the decision for compaction so we calculate it in plan.
     PER_HEAP_FIELD_SINGLE_GC int num_regions_freed_in_sweep;
 
+    // Regions with pinned survivors that were demoted, and ones that were promoted anyway because
+    // their pins are long lived (see long_lived_pin_gc_count), in this GC.
+    PER_HEAP_FIELD_SINGLE_GC int num_pinned_regions_demoted;
+    PER_HEAP_FIELD_SINGLE_GC int num_pinned_regions_long_lived;
+
     PER_HEAP_FIELD_SINGLE_GC int sip_maxgen_regions_per_gen[max_generation + 1];
     PER_HEAP_FIELD_SINGLE_GC heap_segment* reserved_free_regions_sip[max_generation];
 
@@ -4174,7 +4249,9 @@ private:
     // Also updated on the heap#0 GC thread because that's where we are actually doing the decommit.
     PER_HEAP_ISOLATED_FIELD_SINGLE_GC BOOL gradual_decommit_in_progress_p;
 #ifdef MH_SC_MARK
-    PER_HEAP_ISOLATED_FIELD_SINGLE_GC int* g_mark_stack_busy;
+    // Number of heaps in mark_steal that currently have no mark work. Marking is
+    // done when this reaches n_heaps.
+    PER_HEAP_ISOLATED_FIELD_SINGLE_GC VOLATILE(int32_t) mark_steal_idle_count;
 #endif //MH_SC_MARK
 
 #if !defined(USE_REGIONS) || defined(_DEBUG)
@@ -4316,6 +4393,11 @@ private:
 
     PER_HEAP_ISOLATED_FIELD_MAINTAINED uint64_t gc_last_ephemeral_decommit_time;
 
+    // When there's a pause goal, this is what we scale the gen0 budget by. It's reduced
+    // when ephemeral GCs pause longer than the goal and recovers when they are well
+    // under the goal.
+    PER_HEAP_ISOLATED_FIELD_MAINTAINED float gen0_budget_pause_ratio;
+
     // maintained as we need to grow bookkeeping data.
     PER_HEAP_ISOLATED_FIELD_MAINTAINED size_t card_table_element_layout[total_bookkeeping_elements + 1];
 
@@ -4365,6 +4447,10 @@ private:
         float target_tcp = 2.0;
         float target_gen2_tcp = 10.0;
 
+        // Heap count bounds set through SetDynamicAdaptationSettings, 0 means no bound.
+        int min_heap_count_limit = 0;
+        int max_heap_count_limit = 0;
+
         static const int recorded_adjustment_size = 4;
         static const int sample_size = 3;
         static const int recorded_tcp_array_size = 64;
@@ -5251,8 +5337,20 @@ private:
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int generation_skip_ratio_threshold;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY int conserve_mem_setting;
 
+    // Goal for ephemeral GC pauses in us, 0 means there's no goal.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t pause_goal;
+
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool spin_count_unit_config_p;
 
+    // Whether each allocation context scales the allocation quantum by how often it gets refilled.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool adaptive_allocation_quantum_p;
+
+#ifndef MULTIPLE_HEAPS
+    // One per processor when GCNurseryPerCore is enabled, otherwise NULL.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY nursery_slot* nursery_slots;
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int n_nursery_slots;
+#endif //!MULTIPLE_HEAPS
+
     // For SOH we always allocate segments of the same size (except for segments when no_gc_region requires larger ones).
     // REGIONS TODO: right now soh_segment_size is still used in a few places for tuning. Should replace those with
     // something more meaningful.
@@ -5355,6 +5453,9 @@ private:
 #ifdef USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t regions_range;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY bool enable_special_regions_p;
+    // A region demoted because of its pins this many GCs in a row is promoted normally from then
+    // on so the long lived pinned objects get out of gen0. 0 means we always demote.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int long_lived_pin_gc_count;
 #else //USE_REGIONS
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t eph_gen_starts_size;
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY size_t min_segment_size;
@@ -5368,6 +5469,12 @@ private:
 #ifdef FEATURE_LOH_COMPACTION
     // This is for forced LOH compaction via the complus env var
     PER_HEAP_ISOLATED_FIELD_INIT_ONLY BOOL        loh_compaction_always_p;
+
+#ifdef USE_REGIONS
+    // LOH regions with at least this percentage of survived bytes are left in place
+    // when we compact LOH. 0 means we always compact all LOH regions.
+    PER_HEAP_ISOLATED_FIELD_INIT_ONLY int         loh_compaction_dense_region_percent;
+#endif //USE_REGIONS
 #endif //FEATURE_LOH_COMPACTION
 
 #ifdef HOST_64BIT
@@ -6220,6 +6327,13 @@ public:
     #define AGE_IN_FREE_TO_DECOMMIT_LARGE 5
     #define AGE_IN_FREE_TO_DECOMMIT_HUGE 2
     int             age_in_free;
+    // How many GCs in a row this region had pinned survivors and was demoted. Used to tell
+    // long lived pins (eg, buffers pinned for IO) apart from short lived ones.
+    uint8_t         pinned_demoted_count;
+    // The NUMA node of the heap this region was created for. Its pages were most
+    // likely first touched on that node so when we move free regions between heaps
+    // we prefer heaps on this node.
+    uint16_t        numa_node;
     // This is currently only used by regions that are swept in plan -
     // we then thread this list onto the generation's free list.
     // We may keep per region free list later which requires more work.
@@ -6653,6 +6767,16 @@ int& heap_segment_age_in_free (heap_segment* inst)
     return inst->age_in_free;
 }
 inline
+uint8_t& heap_segment_pinned_demoted_count (heap_segment* inst)
+{
+    return inst->pinned_demoted_count;
+}
+inline
+uint16_t& heap_segment_numa_node (heap_segment* inst)
+{
+    return inst->numa_node;
+}
+inline
 size_t& heap_segment_survived (heap_segment* inst)
 {
     return inst->survived;
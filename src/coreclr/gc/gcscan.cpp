@@ -58,6 +58,11 @@ void GCScan::GcDhInitialScan(promote_func* fn, int condemned, int max_gen, ScanC
     pDhContext->m_iMaxGen = max_gen;
     pDhContext->m_pScanContext = sc;
 
+    // Any handles recorded by a previous GC are stale, the initial scan below walks the whole table.
+    pDhContext->m_fRecordPending = false;
+    pDhContext->m_fPendingComplete = false;
+    pDhContext->m_cPending = 0;
+
     // Look for dependent handle whose primary has been promoted but whose secondary has not. Promote the
     // secondary in those cases. Additionally this scan sets the m_fUnpromotedPrimaries and m_fPromoted state
     // flags in the DH context. The m_fUnpromotedPrimaries flag is the most interesting here: if this flag is
@@ -20,14 +20,29 @@
 // result we need to maintain a context between all the DH scanning methods called during a single mark phase.
 // The structure below describes this context. We allocate one of these per GC heap at Ref_Initialize time and
 // select between them based on the ScanContext passed to us by the GC during the mark phase.
+//
+// In a non-concurrent mark phase the first table scan also records every handle it finds with an unpromoted
+// primary. Subsequent re-scans then only visit those handles, dropping each one as soon as its primary turns
+// out to be promoted, instead of walking the whole dependent handle table over and over again.
+struct DhPendingHandle
+{
+    Object        **m_pPrimary;
+    Object        **m_pSecondary;
+};
+
 struct DhContext
 {
     bool            m_fUnpromotedPrimaries;     // Did last scan find at least one non-null unpromoted primary?
     bool            m_fPromoted;                // Did last scan promote at least one secondary?
+    bool            m_fRecordPending;           // Is the current table scan recording handles into m_pPending?
+    bool            m_fPendingComplete;         // Does m_pPending hold every handle with an unpromoted primary?
     promote_func   *m_pfnPromoteFunction;       // GC promote callback to be used for all secondary promotions
     int             m_iCondemned;               // The condemned generation
     int             m_iMaxGen;                  // The maximum generation
     ScanContext    *m_pScanContext;             // The GC's scan context for this phase
+    DhPendingHandle *m_pPending;                // Handles whose primary was unpromoted as of the last scan
+    size_t          m_cPending;                 // Number of valid entries in m_pPending
+    size_t          m_cPendingMax;              // Capacity of m_pPending, kept across GCs
 };
 
 class GCScan
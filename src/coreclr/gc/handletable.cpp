@@ -396,6 +396,116 @@ void HndDestroyHandle(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE handle)
 }
 
 
+/*
+ * HndCreateHandles
+ *
+ * Entrypoint for allocating a batch of null handles of the same type.
+ *
+ * Returns the number of handles that were actually allocated, which is less than
+ * the number requested only if we ran out of memory.
+ *
+ */
+uint32_t HndCreateHandles(HHANDLETABLE hTable, uint32_t uType, OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;     // because of TableAllocHandlesFromCache
+    }
+    CONTRACTL_END;
+
+    // variable-strength handles need their strength at creation time
+    _ASSERTE(uType != HNDTYPE_VARIABLE);
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    uint32_t uSatisfied = TableAllocHandlesFromCache(pTable, uType, pHandles, uCount);
+
+    for (uint32_t u = 0; u < uSatisfied; u++)
+    {
+#ifdef DEBUG_DestroyedHandleValue
+        if (*(_UNCHECKED_OBJECTREF *)pHandles[u] == DEBUG_DestroyedHandleValue)
+            *(_UNCHECKED_OBJECTREF *)pHandles[u] = NULL;
+#endif
+
+        // the handles better not point at anything yet
+        _ASSERTE(*(_UNCHECKED_OBJECTREF *)pHandles[u] == NULL);
+    }
+
+#if !defined(DACCESS_COMPILE) && defined(FEATURE_EVENT_TRACE)
+    // the single handle path reports creation through HndAssignHandle storing the initial
+    // referent - these handles start out null so report them the same way that would
+    if (EVENT_ENABLED(SetGCHandle) || EVENT_ENABLED(PrvSetGCHandle))
+    {
+        for (uint32_t u = 0; u < uSatisfied; u++)
+        {
+            FIRE_EVENT(SetGCHandle, (void *)pHandles[u], (void *)NULL, uType, 0);
+            FIRE_EVENT(PrvSetGCHandle, (void *)pHandles[u], (void *)NULL, uType, 0);
+        }
+    }
+#endif
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles += uSatisfied;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+
+    STRESS_LOG3(LF_GC, LL_INFO1000, "CreateHandles: %d of %d, type=%d\n", uSatisfied, uCount, uType);
+
+    return uSatisfied;
+}
+
+
+/*
+ * HndDestroyHandles
+ *
+ * Entrypoint for freeing a batch of handles of the same type.
+ *
+ */
+void HndDestroyHandles(HHANDLETABLE hTable, uint32_t uType, const OBJECTHANDLE *pHandles, uint32_t uCount)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+        CAN_TAKE_LOCK;     // because of TableFreeHandlesToCache
+    }
+    CONTRACTL_END;
+
+    STRESS_LOG2(LF_GC, LL_INFO1000, "DestroyHandles: %d, type=%d\n", uCount, uType);
+
+    // fetch the handle table pointer
+    HandleTable *pTable = Table(hTable);
+
+    // sanity check the type index
+    _ASSERTE(uType < pTable->uTypeCount);
+
+    for (uint32_t u = 0; u < uCount; u++)
+    {
+        FIRE_EVENT(DestroyGCHandle, (void *)pHandles[u]);
+        FIRE_EVENT(PrvDestroyGCHandle, (void *)pHandles[u]);
+
+        // sanity check the handles we are being asked to free
+        _ASSERTE(pHandles[u]);
+        _ASSERTE(HandleFetchHandleTable(pHandles[u]) == pTable);
+        _ASSERTE(HandleFetchType(pHandles[u]) == uType);
+    }
+
+    // return the handles to the table
+    TableFreeHandlesToCache(pTable, uType, pHandles, uCount);
+
+#if defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+    g_dwHandles -= uCount;
+#endif // defined(ENABLE_PERF_COUNTERS) || defined(FEATURE_EVENT_TRACE)
+}
+
+
 /*
  * HndDestroyHandleOfUnknownType
  *
@@ -612,6 +722,9 @@ void HndWriteBarrierWorker(OBJECTHANDLE handle, _UNCHECKED_OBJECTREF value)
             // we just set the clump age to 0, which means that whoever wins the race
             // results are the same, as GC will always look at the clump
             *pClumpAge = (uint8_t)0;
+
+            // the segment's summary age must never be above any of its clumps
+            *(volatile uint8_t *)&((_TableSegmentHeader *)barrier)->bMinAge = (uint8_t)0;
         }
     }
 }
@@ -820,13 +820,26 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
  * TableAllocHandlesFromCache
  *
  * Allocates multiple handles of the specified type by repeatedly
- * calling TableAllocSingleHandleFromCache.
+ * calling TableAllocSingleHandleFromCache, or directly from the table
+ * for large requests.
  *
  */
 uint32_t TableAllocHandlesFromCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE *pHandleBase, uint32_t uCount)
 {
     WRAPPER_NO_CONTRACT;
 
+    // a request this big would drain the cache banks several times over, taking the
+    // table lock on each rebalance - go straight to the table with a single lock instead
+    if (uCount >= HANDLES_PER_CACHE_BANK)
+    {
+        CrstHolder ch(&pTable->Lock);
+
+        // we intentionally don't check for success here
+        FAULT_NOT_FATAL();
+
+        return TableAllocBulkHandles(pTable, uType, pHandleBase, uCount);
+    }
+
     // loop until we have satisfied all the handles we need to allocate
     uint32_t uSatisfied = 0;
     while (uSatisfied < uCount)
@@ -855,13 +868,22 @@ uint32_t TableAllocHandlesFromCache(HandleTable *pTable, uint32_t uType, OBJECTH
  * TableFreeHandlesToCache
  *
  * Frees multiple handles of the specified type by repeatedly
- * calling TableFreeSingleHandleToCache.
+ * calling TableFreeSingleHandleToCache, or directly to the table
+ * for large requests.
  *
  */
 void TableFreeHandlesToCache(HandleTable *pTable, uint32_t uType, const OBJECTHANDLE *pHandleBase, uint32_t uCount)
 {
     WRAPPER_NO_CONTRACT;
 
+    // as in TableAllocHandlesFromCache, free big batches straight to the table
+    if (uCount >= HANDLES_PER_CACHE_BANK)
+    {
+        CrstHolder ch(&pTable->Lock);
+        TableFreeBulkUnpreparedHandles(pTable, uType, pHandleBase, uCount);
+        return;
+    }
+
     // loop until we have freed all the handles
     while (uCount)
     {
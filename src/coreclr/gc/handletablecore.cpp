@@ -527,6 +527,9 @@ BOOL SegmentInitialize(TableSegment *pSegment, HandleTable *pTable)
     memset(pSegment->rgBlockType,  TYPE_INVALID,    sizeof(pSegment->rgBlockType));
     memset(pSegment->rgUserData,   BLOCK_INVALID,   sizeof(pSegment->rgUserData));
 
+    // nothing is known about the clump ages yet
+    pSegment->bMinAge = 0;
+
     // prelink the free chain
     _ASSERTE(FitsInU1(HANDLE_BLOCKS_PER_SEGMENT));
     uint8_t u = 0;
@@ -166,6 +166,16 @@ struct _TableSegmentHeader
      * Indicates the segment sequence number.
      */
     uint8_t bSequence;
+
+    /*
+     * Minimum Age
+     *
+     * A lower bound on the clump ages in rgGeneration.  Ephemeral scans use this to
+     * skip segments where no clump can point into the condemned generations.  The
+     * write barrier drops it to zero whenever it lowers a clump age, and it is only
+     * raised again (by recomputing it) while the EE is suspended.
+     */
+    uint8_t bMinAge;
 };
 
 typedef DPTR(struct _TableSegmentHeader) PTR__TableSegmentHeader;
@@ -755,7 +765,8 @@ void TableFreeSingleHandleToCache(HandleTable *pTable, uint32_t uType, OBJECTHAN
  * TableAllocHandlesFromCache
  *
  * Allocates multiple handles of the specified type by repeatedly
- * calling TableAllocSingleHandleFromCache.
+ * calling TableAllocSingleHandleFromCache, or directly from the table
+ * for large requests.
  *
  */
 uint32_t TableAllocHandlesFromCache(HandleTable *pTable, uint32_t uType, OBJECTHANDLE *pHandleBase, uint32_t uCount);
@@ -765,7 +776,8 @@ uint32_t TableAllocHandlesFromCache(HandleTable *pTable, uint32_t uType, OBJECTH
  * TableFreeHandlesToCache
  *
  * Frees multiple handles of the specified type by repeatedly
- * calling TableFreeSingleHandleToCache.
+ * calling TableFreeSingleHandleToCache, or directly to the table
+ * for large requests.
  *
  */
 void TableFreeHandlesToCache(HandleTable *pTable, uint32_t uType, const OBJECTHANDLE *pHandleBase, uint32_t uCount);
@@ -851,6 +851,9 @@ void CALLBACK BlockResetAgeMapForBlocks(TableSegment *pSegment, uint32_t uBlock,
 {
     WRAPPER_NO_CONTRACT;
 
+    // the ages we compute below can be lower than the segment's summary
+    pSegment->bMinAge = 0;
+
 #if 0
     // zero the age map for the specified range of blocks
     ZeroMemory((uint32_t *)pSegment->rgGeneration + uBlock, uCount * sizeof(uint32_t));
@@ -1701,6 +1704,50 @@ void SegmentScanByTypeMap(PTR_TableSegment pSegment, const BOOL *rgTypeInclusion
 }
 
 
+/*
+ * SegmentIsEphemeralScanEligible
+ *
+ * Determines whether any clump in the segment could be selected by the age mask
+ * of an ephemeral scan.
+ *
+ */
+static BOOL SegmentIsEphemeralScanEligible(PTR_TableSegment pSegment, ScanCallbackInfo *pInfo)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint32_t dwMinAge = pSegment->bMinAge * 0x01010101;
+    return (COMPUTE_CLUMP_MASK(dwMinAge, pInfo->dwAgeMask) != 0);
+}
+
+#ifndef DACCESS_COMPILE
+/*
+ * SegmentRecomputeMinAge
+ *
+ * Recomputes the lower bound on the clump ages of a segment.  This must only be
+ * called while the EE is suspended, as the handle write barrier is not synchronized
+ * with us.
+ *
+ */
+static void SegmentRecomputeMinAge(TableSegment *pSegment)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint8_t minAge = GEN_MAX_AGE;
+    for (uint32_t uBlock = 0; uBlock < HANDLE_BLOCKS_PER_SEGMENT; uBlock++)
+    {
+        uint32_t dwGen = ((uint32_t *)pSegment->rgGeneration)[uBlock] & GEN_CLAMP;
+        for (uint32_t i = 0; i < HANDLE_CLUMPS_PER_BLOCK; i++, dwGen >>= 8)
+        {
+            if ((uint8_t)dwGen < minAge)
+                minAge = (uint8_t)dwGen;
+        }
+    }
+
+    pSegment->bMinAge = minAge;
+}
+#endif // !DACCESS_COMPILE
+
+
 /*
  * TableScanHandles
  *
@@ -1731,13 +1778,20 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
     if (uTypeCount > 1)
         BuildInclusionMap(rgTypeInclusion, puType, uTypeCount);
 
+    // ephemeral scans only look at clumps that are young enough, so they can skip
+    // entire segments that have nothing young enough in them
+    BOOL fEphemeral = (pfnBlockHandler == BlockScanBlocksEphemeral);
+#ifndef DACCESS_COMPILE
+    fEphemeral = fEphemeral || (pfnBlockHandler == BlockAgeBlocksEphemeral);
+#endif
+
     // now, iterate over the segments, scanning blocks of the specified type(s)
     PTR_TableSegment pSegment = NULL;
     while ((pSegment = pfnSegmentIterator(pTable, pSegment, pCrstHolder)) != NULL)
     {
         // if there are types to scan then enumerate the blocks in this segment
         // (we do this test inside the loop since the iterators should still run...)
-        if (uTypeCount >= 1)
+        if ((uTypeCount >= 1) && (!fEphemeral || SegmentIsEphemeralScanEligible(pSegment, pInfo)))
         {
             // make sure the "current segment" pointer in the scan info is up to date
             pInfo->pCurrentSegment = pSegment;
@@ -1756,6 +1810,12 @@ void CALLBACK TableScanHandles(PTR_HandleTable pTable,
 
             // make sure the "current segment" pointer in the scan info is up to date
             pInfo->pCurrentSegment = NULL;
+
+#ifndef DACCESS_COMPILE
+            // aging may have moved every young clump out of the condemned generations
+            if (fEphemeral && (pInfo->uFlags & HNDGCF_AGE))
+                SegmentRecomputeMinAge(pSegment);
+#endif
         }
     }
 }
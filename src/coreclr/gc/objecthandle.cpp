@@ -225,41 +225,108 @@ void CALLBACK UpdateDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pE
 #endif
 }
 
-void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
+// Promote the secondary of a dependent handle whose primary is promoted. Returns false if the primary is
+// non-null but not (yet) promoted.
+static bool PromoteDependentHandleSecondary(Object **pPrimaryRef, Object **pSecondaryRef, DhContext *pDhContext)
 {
     LIMITED_METHOD_CONTRACT;
-    _ASSERTE(pExtraInfo);
-
-    Object **pPrimaryRef = (Object **)pObjRef;
-    Object **pSecondaryRef = (Object **)pExtraInfo;
-    LOG((LF_GC, LL_INFO1000, "Checking promotion of DependentHandle\n"));
-    LOG((LF_GC, LL_INFO1000, LOG_HANDLE_OBJECT_CLASS("\tPrimary:\t", pObjRef, "to ", *pObjRef)));
-    LOG((LF_GC, LL_INFO1000, LOG_HANDLE_OBJECT_CLASS("\tSecondary\t", pSecondaryRef, "to ", *pSecondaryRef)));
-
-    ScanContext *sc = (ScanContext*)lp1;
-    DhContext *pDhContext = Ref_GetDependentHandleContext(sc);
 
-    if (*pObjRef && g_theGCHeap->IsPromoted(*pPrimaryRef))
+    if (*pPrimaryRef && g_theGCHeap->IsPromoted(*pPrimaryRef))
     {
         if (!g_theGCHeap->IsPromoted(*pSecondaryRef))
         {
             LOG((LF_GC, LL_INFO10000, "\tPromoting secondary " LOG_OBJECT_CLASS(*pSecondaryRef)));
-            _ASSERTE(lp2);
-            promote_func* callback = (promote_func*) lp2;
-            callback(pSecondaryRef, (ScanContext *)lp1, 0);
+            _ASSERTE(pDhContext->m_pfnPromoteFunction);
+            pDhContext->m_pfnPromoteFunction(pSecondaryRef, pDhContext->m_pScanContext, 0);
             // need to rescan because we might have promoted an object that itself has added fields and this
             // promotion might be all that is pinning that object. If we've already scanned that dependent
             // handle relationship, we could lose it secondary object.
             pDhContext->m_fPromoted = true;
         }
     }
-    else if (*pObjRef)
+    else if (*pPrimaryRef)
     {
         // If we see a non-cleared primary which hasn't been promoted, record the fact. We will only require a
         // rescan if this flag has been set (if it's clear then the previous scan found only clear and
         // promoted handles, so there's no chance of finding an additional handle being promoted on a
         // subsequent scan).
         pDhContext->m_fUnpromotedPrimaries = true;
+        return false;
+    }
+
+    return true;
+}
+
+// Append a handle with an unpromoted primary to the pending list of the context. If the list can't grow the
+// recording is abandoned and re-scans fall back to walking the whole table.
+static void RecordPendingDependentHandle(Object **pPrimaryRef, Object **pSecondaryRef, DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (pDhContext->m_cPending == pDhContext->m_cPendingMax)
+    {
+        size_t cNewMax = max((size_t)256, pDhContext->m_cPendingMax * 2);
+        DhPendingHandle *pNewPending = new (nothrow) DhPendingHandle[cNewMax];
+        if (pNewPending == NULL)
+        {
+            pDhContext->m_fRecordPending = false;
+            return;
+        }
+
+        if (pDhContext->m_pPending != NULL)
+        {
+            memcpy(pNewPending, pDhContext->m_pPending, pDhContext->m_cPending * sizeof(DhPendingHandle));
+            delete [] pDhContext->m_pPending;
+        }
+
+        pDhContext->m_pPending = pNewPending;
+        pDhContext->m_cPendingMax = cNewMax;
+    }
+
+    DhPendingHandle *pPending = &pDhContext->m_pPending[pDhContext->m_cPending++];
+    pPending->m_pPrimary = pPrimaryRef;
+    pPending->m_pSecondary = pSecondaryRef;
+}
+
+void CALLBACK PromoteDependentHandle(_UNCHECKED_OBJECTREF *pObjRef, uintptr_t *pExtraInfo, uintptr_t lp1, uintptr_t lp2)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(pExtraInfo);
+
+    Object **pPrimaryRef = (Object **)pObjRef;
+    Object **pSecondaryRef = (Object **)pExtraInfo;
+    LOG((LF_GC, LL_INFO1000, "Checking promotion of DependentHandle\n"));
+    LOG((LF_GC, LL_INFO1000, LOG_HANDLE_OBJECT_CLASS("\tPrimary:\t", pObjRef, "to ", *pObjRef)));
+    LOG((LF_GC, LL_INFO1000, LOG_HANDLE_OBJECT_CLASS("\tSecondary\t", pSecondaryRef, "to ", *pSecondaryRef)));
+
+    ScanContext *sc = (ScanContext*)lp1;
+    DhContext *pDhContext = Ref_GetDependentHandleContext(sc);
+    _ASSERTE(pDhContext->m_pfnPromoteFunction == (promote_func*)lp2);
+
+    if (!PromoteDependentHandleSecondary(pPrimaryRef, pSecondaryRef, pDhContext) && pDhContext->m_fRecordPending)
+    {
+        RecordPendingDependentHandle(pPrimaryRef, pSecondaryRef, pDhContext);
+    }
+}
+
+// Re-scan only the handles recorded by the last table scan, dropping those whose primary is now promoted.
+static void ScanPendingDependentHandles(DhContext *pDhContext)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    size_t i = 0;
+    while (i < pDhContext->m_cPending)
+    {
+        DhPendingHandle *pPending = &pDhContext->m_pPending[i];
+        if (PromoteDependentHandleSecondary(pPending->m_pPrimary, pPending->m_pSecondary, pDhContext))
+        {
+            // Order doesn't matter, the last entry takes the place of the resolved one.
+            *pPending = pDhContext->m_pPending[--pDhContext->m_cPending];
+        }
+        else
+        {
+            i++;
+        }
     }
 }
 
@@ -690,7 +757,7 @@ bool Ref_Initialize()
 
     // Allocate contexts used during dependent handle promotion scanning. There's one of these for every GC
     // heap since they're scanned in parallel.
-    g_pDependentHandleContexts = new (nothrow) DhContext[n_slots];
+    g_pDependentHandleContexts = new (nothrow) DhContext[n_slots]();
     if (g_pDependentHandleContexts == NULL)
         goto CleanupAndFail;
 
@@ -712,6 +779,11 @@ void Ref_Shutdown()
 
     if (g_pDependentHandleContexts)
     {
+        for (int i = 0; i < getNumberOfSlots(); i++)
+        {
+            delete [] g_pDependentHandleContexts[i].m_pPending;
+        }
+
         delete [] g_pDependentHandleContexts;
         g_pDependentHandleContexts = NULL;
     }
@@ -1313,6 +1385,22 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
         pDhContext->m_fUnpromotedPrimaries = false;
         pDhContext->m_fPromoted = false;
 
+        if (pDhContext->m_fPendingComplete)
+        {
+            ScanPendingDependentHandles(pDhContext);
+
+            if (pDhContext->m_fPromoted)
+                fAnyPromotions = true;
+
+            continue;
+        }
+
+        // Handles can be freed or reused while a concurrent scan has the table unlocked, so they can only be
+        // remembered between scans while the EE is suspended.
+        bool fRecordPending = !pDhContext->m_pScanContext->concurrent;
+        pDhContext->m_fRecordPending = fRecordPending;
+        pDhContext->m_cPending = 0;
+
         HandleTableMap *walk = &g_HandleTableMap;
         while (walk)
         {
@@ -1345,6 +1433,10 @@ bool Ref_ScanDependentHandlesForPromotion(DhContext *pDhContext)
             walk = walk->pNext;
         }
 
+        // Recording stops early if the pending list fails to grow; in that case keep walking the table.
+        pDhContext->m_fPendingComplete = fRecordPending && pDhContext->m_fRecordPending;
+        pDhContext->m_fRecordPending = false;
+
         if (pDhContext->m_fPromoted)
             fAnyPromotions = true;
 
@@ -0,0 +1,697 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+//
+// GCBench.cpp
+//
+
+//
+//  Native microbenchmarks for the hot kernels of the GC, built on the same GC environment as GCSample.
+//
+//  Each scenario drives the GC with a synthetic object graph:
+//
+//  * alloc          - short lived small objects, measures the allocator and gen0 GCs with no survivors
+//  * deep-list      - a single linked list, measures marking of a very deep graph
+//  * tree           - a balanced binary tree, measures marking of a large graph
+//  * wide-array     - large arrays of references, measures marking of wide objects
+//  * cross-gen-N    - stores young objects into an old array every Nth allocation, measures card marking
+//  * pin-N          - retains some objects and pins every Nth one, measures plan and compaction around pins
+//
+//  For every scenario one CSV line is printed with the GC counts per generation, the allocation throughput and
+//  the time spent in each stage of the collections:
+//
+//  * suspend        - from SuspendEE to the start of the GC work
+//  * mark_roots     - marking through the roots, sized ref handles, handles and cards
+//  * mark_short_weak, mark_finalization, mark_long_weak
+//                   - weak handle and finalization queue scanning
+//  * plan, relocate, compact, sweep
+//                   - the phases after marking (relocate and compact for compacting GCs, sweep otherwise)
+//  * pause          - from SuspendEE to RestartEE
+//
+//  The phase times are the ones the GC records for the GCGlobalHeapHistory event, so gcbench is built with
+//  FEATURE_EVENT_TRACE and receives that event through g_pGCSampleEventSink.
+//
+//  Usage: gcbench [scenario ...]
+//
+
+#include "common.h"
+
+#include "gcenv.h"
+
+#include "gc.h"
+#include "objecthandle.h"
+
+#include "gcdesc.h"
+
+#ifdef TARGET_X86
+#define LOCALGC_CALLCONV __cdecl
+#else
+#define LOCALGC_CALLCONV
+#endif
+
+//
+// Type layouts
+//
+
+class Node : Object {
+public:
+    Object * m_pLeft;
+    Object * m_pRight;
+};
+
+class Leaf : Object {
+public:
+    size_t m_payload[2];
+};
+
+static struct
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+s_nodeMethodTable;
+
+static MethodTable s_leafMethodTable;
+
+static struct
+{
+    // GCDesc
+    CGCDescSeries m_series[1];
+    size_t m_numSeries;
+
+    // The actual methodtable
+    MethodTable m_MT;
+}
+s_arrayMethodTable;
+
+static void InitializeMethodTables()
+{
+    // GC expects the size of ObjHeader (extra void*) to be included in the size and the object size to be
+    // at least MIN_OBJECT_SIZE.
+    uint32_t nodeSize = max((uint32_t)(sizeof(Node) + sizeof(ObjHeader)), (uint32_t)MIN_OBJECT_SIZE);
+    s_nodeMethodTable.m_MT.m_baseSize = nodeSize;
+    s_nodeMethodTable.m_MT.m_componentSize = 0;
+    s_nodeMethodTable.m_MT.m_flags = MTFlag_ContainsGCPointers;
+
+    // Both references are adjacent, so a single series covers them
+    s_nodeMethodTable.m_numSeries = 1;
+    s_nodeMethodTable.m_series[0].SetSeriesOffset(offsetof(Node, m_pLeft));
+    s_nodeMethodTable.m_series[0].SetSeriesCount(2);
+    s_nodeMethodTable.m_series[0].seriessize -= nodeSize;
+
+    s_leafMethodTable.m_baseSize = max((uint32_t)(sizeof(Leaf) + sizeof(ObjHeader)), (uint32_t)MIN_OBJECT_SIZE);
+    s_leafMethodTable.m_componentSize = 0;
+    s_leafMethodTable.m_flags = 0;
+
+    // Array of references. The component size shares storage with the low bits of the flags.
+    s_arrayMethodTable.m_MT.m_baseSize = sizeof(ArrayBase) + sizeof(ObjHeader);
+    s_arrayMethodTable.m_MT.m_flags = MTFlag_HasComponentSize | MTFlag_IsArray | MTFlag_ContainsGCPointers;
+    s_arrayMethodTable.m_MT.m_componentSize = sizeof(Object *);
+
+    // The GC adds the total size of the object to the series size, so the negative base size leaves
+    // the size of the elements.
+    s_arrayMethodTable.m_numSeries = 1;
+    s_arrayMethodTable.m_series[0].SetSeriesOffset(sizeof(ArrayBase));
+    s_arrayMethodTable.m_series[0].seriessize = (size_t)0 - s_arrayMethodTable.m_MT.m_baseSize;
+}
+
+//
+// Allocator and write barrier, same as in GCSample except that arrays and large objects are supported
+//
+
+static uint64_t s_allocatedBytes;
+
+Object * AllocateObject(MethodTable * pMT, uint32_t numComponents = 0)
+{
+    alloc_context * acontext = GetThread()->GetAllocContext();
+    Object * pObject;
+
+    size_t size = pMT->GetBaseSize() + (size_t)numComponents * pMT->RawGetComponentSize();
+
+    uint8_t* result = acontext->alloc_ptr;
+    uint8_t* advance = result + size;
+    if (size < LARGE_OBJECT_SIZE && advance <= acontext->alloc_limit)
+    {
+        acontext->alloc_ptr = advance;
+        pObject = (Object *)result;
+    }
+    else
+    {
+        pObject = g_theGCHeap->Alloc(acontext, size, (size >= LARGE_OBJECT_SIZE) ? GC_ALLOC_LARGE_OBJECT_HEAP : 0);
+        if (pObject == NULL)
+            return NULL;
+    }
+
+    pObject->RawSetMethodTable(pMT);
+
+    if (pMT->HasComponentSize())
+        *(uint32_t *)((uint8_t *)pObject + ArrayBase::GetOffsetOfNumComponents()) = numComponents;
+
+    s_allocatedBytes += size;
+
+    return pObject;
+}
+
+inline Object ** GetArrayData(Object * pArray)
+{
+    return (Object **)((uint8_t *)pArray + sizeof(ArrayBase));
+}
+
+#if defined(HOST_64BIT)
+// Card byte shift is different on 64bit.
+#define card_byte_shift     11
+#else
+#define card_byte_shift     10
+#endif
+
+#define card_byte(addr) (((size_t)(addr)) >> card_byte_shift)
+
+inline void WriteBarrier(Object ** dst, Object * ref)
+{
+    *dst = ref;
+
+    // if the dst is outside of the heap (unboxed value classes) then we
+    //      simply exit
+    if (((uint8_t*)dst < g_gc_lowest_address) || ((uint8_t*)dst >= g_gc_highest_address))
+        return;
+
+    // volatile is used here to prevent fetch of g_card_table from being reordered
+    // with g_lowest/highest_address check above. See comments in StompWriteBarrier
+    uint8_t* pCardByte = (uint8_t *)*(volatile uint8_t **)(&g_gc_card_table) + card_byte((uint8_t *)dst);
+    if(*pCardByte != 0xFF)
+        *pCardByte = 0xFF;
+}
+
+//
+// Timing of the stages of each GC
+//
+
+// The phases of a blocking GC in the order the GC reports them in GCGlobalHeapHistory. A sweeping GC reports
+// sweep in place of relocate and has no compact phase, a background GC only reports the mark phases.
+enum GCBenchPhase
+{
+    Phase_MarkSizedRef,
+    Phase_MarkRoots,
+    Phase_MarkShortWeak,
+    Phase_MarkFinalization,
+    Phase_MarkLongWeak,
+    Phase_Plan,
+    Phase_Relocate,
+    Phase_Compact,
+    Phase_Sweep,
+    Phase_Count
+};
+
+struct GCBenchStats
+{
+    uint32_t gcCount[max_generation + 1];
+    int64_t suspendTicks;
+    uint64_t phaseUs[Phase_Count];
+    int64_t pauseTicks;
+    int64_t maxPauseTicks;
+};
+
+static GCBenchStats s_stats;
+static int64_t s_suspendTimestamp;
+
+static void OnGCSampleEvent(GCSampleEvent event, int generation)
+{
+    int64_t timestamp = GCToOSInterface::QueryPerformanceCounter();
+
+    switch (event)
+    {
+    case GCSampleEvent::SuspendEE:
+        s_suspendTimestamp = timestamp;
+        break;
+
+    case GCSampleEvent::GcStartWork:
+        s_stats.gcCount[min(generation, (int)max_generation)]++;
+        s_stats.suspendTicks += timestamp - s_suspendTimestamp;
+        break;
+
+    case GCSampleEvent::RestartEE:
+    {
+        int64_t pauseTicks = timestamp - s_suspendTimestamp;
+        s_stats.pauseTicks += pauseTicks;
+        s_stats.maxPauseTicks = max(s_stats.maxPauseTicks, pauseTicks);
+        break;
+    }
+    }
+}
+
+class GCBenchEventSink : public IGCToCLREventSink
+{
+public:
+    void FireGCGlobalHeapHistory_V4(uint64_t finalYoungestDesired, int32_t numHeaps, uint32_t condemnedGeneration,
+                                    uint32_t gen0reductionCount, uint32_t reason, uint32_t globalMechanisms,
+                                    uint32_t pauseMode, uint32_t memoryPressure, uint32_t condemnReasons0,
+                                    uint32_t condemnReasons1, uint32_t count, uint32_t valuesLen,
+                                    void *values) override
+    {
+        // The values are the per phase times of this GC in microseconds
+        const uint32_t* phaseUs = (const uint32_t*)values;
+        assert(valuesLen == sizeof(uint32_t));
+
+        // A sweeping GC reports one phase less, with sweep in place of relocate
+        bool isSweeping = (count == Phase_Compact);
+        for (uint32_t i = 0; i < count && i <= Phase_Compact; i++)
+        {
+            GCBenchPhase phase = (isSweeping && (i == Phase_Relocate)) ? Phase_Sweep : (GCBenchPhase)i;
+            s_stats.phaseUs[phase] += phaseUs[i];
+        }
+    }
+
+    // The other events are not used by the benchmark
+    void FireDynamicEvent(const char* eventName, void* payload, uint32_t payloadSize) override {}
+    void FireGCStart_V2(uint32_t count, uint32_t depth, uint32_t reason, uint32_t type) override {}
+    void FireGCEnd_V1(uint32_t count, uint32_t depth) override {}
+    void FireGCGenerationRange(uint8_t generation, void* rangeStart, uint64_t rangeUsedLength,
+                               uint64_t rangeReservedLength) override {}
+    void FireGCHeapStats_V2(uint64_t generationSize0, uint64_t totalPromotedSize0, uint64_t generationSize1,
+                            uint64_t totalPromotedSize1, uint64_t generationSize2, uint64_t totalPromotedSize2,
+                            uint64_t generationSize3, uint64_t totalPromotedSize3, uint64_t generationSize4,
+                            uint64_t totalPromotedSize4, uint64_t finalizationPromotedSize,
+                            uint64_t finalizationPromotedCount, uint32_t pinnedObjectCount, uint32_t sinkBlockCount,
+                            uint32_t gcHandleCount) override {}
+    void FireGCCreateSegment_V1(void* address, size_t size, uint32_t type) override {}
+    void FireGCFreeSegment_V1(void* address) override {}
+    void FireGCCreateConcurrentThread_V1() override {}
+    void FireGCTerminateConcurrentThread_V1() override {}
+    void FireGCTriggered(uint32_t reason) override {}
+    void FireGCMarkWithType(uint32_t heapNum, uint32_t type, uint64_t bytes) override {}
+    void FireGCJoin_V2(uint32_t heap, uint32_t joinTime, uint32_t joinType, uint32_t joinId) override {}
+    void FireGCAllocationTick_V1(uint32_t allocationAmount, uint32_t allocationKind) override {}
+    void FireGCAllocationTick_V4(uint64_t allocationAmount, uint32_t allocationKind, uint32_t heapIndex,
+                                 void* objectAddress, uint64_t objectSize) override {}
+    void FirePinObjectAtGCTime(void* object, uint8_t** ppObject) override {}
+    void FirePinPlugAtGCTime(uint8_t* plug_start, uint8_t* plug_end, uint8_t* gapBeforeSize) override {}
+    void FireGCPerHeapHistory_V3(void *freeListAllocated, void *freeListRejected, void *endOfSegAllocated,
+                                 void *condemnedAllocated, void *pinnedAllocated, void *pinnedAllocatedAdvance,
+                                 uint32_t runningFreeListEfficiency, uint32_t condemnReasons0, uint32_t condemnReasons1,
+                                 uint32_t compactMechanisms, uint32_t expandMechanisms, uint32_t heapIndex,
+                                 void *extraGen0Commit, uint32_t count, uint32_t valuesLen, void *values) override {}
+    void FireGCLOHCompact(uint16_t count, uint32_t valuesLen, void *values) override {}
+    void FireGCFitBucketInfo(uint16_t bucketKind, size_t size, uint16_t count, uint32_t valuesLen,
+                             void *values) override {}
+    void FireBGCBegin() override {}
+    void FireBGC1stNonConEnd() override {}
+    void FireBGC1stConEnd() override {}
+    void FireBGC1stSweepEnd(uint32_t genNumber) override {}
+    void FireBGC2ndNonConBegin() override {}
+    void FireBGC2ndNonConEnd() override {}
+    void FireBGC2ndConBegin() override {}
+    void FireBGC2ndConEnd() override {}
+    void FireBGCDrainMark(uint64_t objects) override {}
+    void FireBGCRevisit(uint64_t pages, uint64_t objects, uint32_t isLarge) override {}
+    void FireBGCOverflow_V1(uint64_t min, uint64_t max, uint64_t objects, uint32_t isLarge,
+                            uint32_t genNumber) override {}
+    void FireBGCAllocWaitBegin(uint32_t reason) override {}
+    void FireBGCAllocWaitEnd(uint32_t reason) override {}
+    void FireGCFullNotify_V1(uint32_t genNumber, uint32_t isAlloc) override {}
+    void FireSetGCHandle(void *handleID, void *objectID, uint32_t kind, uint32_t generation) override {}
+    void FirePrvSetGCHandle(void *handleID, void *objectID, uint32_t kind, uint32_t generation) override {}
+    void FireDestroyGCHandle(void *handleID) override {}
+    void FirePrvDestroyGCHandle(void *handleID) override {}
+};
+
+static GCBenchEventSink s_eventSink;
+
+//
+// Scenarios
+//
+
+static IGCHeap * s_pGCHeap;
+
+// Strong handles that keep the object graph of the current scenario alive
+static OBJECTHANDLE s_ohRoot;
+static OBJECTHANDLE s_ohTemp1;
+static OBJECTHANDLE s_ohTemp2;
+
+static uint32_t s_randomSeed;
+
+static uint32_t NextRandom()
+{
+    s_randomSeed = s_randomSeed * 1664525 + 1013904223;
+    return s_randomSeed >> 8;
+}
+
+static HHANDLETABLE GetHandleTable()
+{
+    return g_HandleTableMap.pBuckets[0]->pTable[GetCurrentThreadHomeHeapNumber()];
+}
+
+static const int FullGCCount = 10;
+
+static void InduceFullGCs()
+{
+    for (int i = 0; i < FullGCCount; i++)
+    {
+        s_pGCHeap->GarbageCollect();
+    }
+}
+
+static bool RunAllocation(uint32_t count)
+{
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (AllocateObject(&s_leafMethodTable) == NULL)
+            return false;
+    }
+
+    return true;
+}
+
+static bool RunDeepList(uint32_t length)
+{
+    for (uint32_t i = 0; i < length; i++)
+    {
+        Object * p = AllocateObject(&s_nodeMethodTable.m_MT);
+        if (p == NULL)
+            return false;
+
+        WriteBarrier(&((Node *)p)->m_pLeft, HndFetchHandle(s_ohRoot));
+        HndAssignHandle(s_ohRoot, p);
+    }
+
+    InduceFullGCs();
+    return true;
+}
+
+static bool RunTree(uint32_t depth)
+{
+    // The tree is built bottom up one level at a time, so every node is reachable from a handle whenever
+    // an allocation triggers a GC
+    uint32_t count = 1u << (depth - 1);
+    Object * pLevel = AllocateObject(&s_arrayMethodTable.m_MT, count);
+    if (pLevel == NULL)
+        return false;
+
+    HndAssignHandle(s_ohTemp1, pLevel);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        Object * p = AllocateObject(&s_nodeMethodTable.m_MT);
+        if (p == NULL)
+            return false;
+
+        WriteBarrier(&GetArrayData(HndFetchHandle(s_ohTemp1))[i], p);
+    }
+
+    while (count > 1)
+    {
+        count /= 2;
+
+        Object * pParents = AllocateObject(&s_arrayMethodTable.m_MT, count);
+        if (pParents == NULL)
+            return false;
+
+        HndAssignHandle(s_ohTemp2, pParents);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Object * p = AllocateObject(&s_nodeMethodTable.m_MT);
+            if (p == NULL)
+                return false;
+
+            Object ** children = GetArrayData(HndFetchHandle(s_ohTemp1));
+            WriteBarrier(&((Node *)p)->m_pLeft, children[2 * i]);
+            WriteBarrier(&((Node *)p)->m_pRight, children[2 * i + 1]);
+            WriteBarrier(&GetArrayData(HndFetchHandle(s_ohTemp2))[i], p);
+        }
+
+        HndAssignHandle(s_ohTemp1, HndFetchHandle(s_ohTemp2));
+    }
+
+    HndAssignHandle(s_ohRoot, GetArrayData(HndFetchHandle(s_ohTemp1))[0]);
+
+    InduceFullGCs();
+    return true;
+}
+
+static bool RunWideArrays(uint32_t length)
+{
+    const uint32_t arrayCount = 64;
+
+    Object * pArrays = AllocateObject(&s_arrayMethodTable.m_MT, arrayCount);
+    if (pArrays == NULL)
+        return false;
+
+    HndAssignHandle(s_ohRoot, pArrays);
+
+    for (uint32_t i = 0; i < arrayCount; i++)
+    {
+        Object * pArray = AllocateObject(&s_arrayMethodTable.m_MT, length);
+        if (pArray == NULL)
+            return false;
+
+        WriteBarrier(&GetArrayData(HndFetchHandle(s_ohRoot))[i], pArray);
+
+        for (uint32_t j = 0; j < length; j++)
+        {
+            Object * p = AllocateObject(&s_leafMethodTable);
+            if (p == NULL)
+                return false;
+
+            WriteBarrier(&GetArrayData(GetArrayData(HndFetchHandle(s_ohRoot))[i])[j], p);
+        }
+    }
+
+    InduceFullGCs();
+    return true;
+}
+
+static const uint32_t ScenarioAllocationCount = 4 * 1024 * 1024;
+
+static bool RunCrossGeneration(uint32_t storeInterval)
+{
+    // The old array is on the large object heap, so it is never in the condemned generation of the
+    // ephemeral GCs and its references to young objects are only found through the cards
+    const uint32_t length = 1024 * 1024;
+
+    Object * pOld = AllocateObject(&s_arrayMethodTable.m_MT, length);
+    if (pOld == NULL)
+        return false;
+
+    HndAssignHandle(s_ohRoot, pOld);
+
+    for (uint32_t i = 0; i < ScenarioAllocationCount; i++)
+    {
+        Object * p = AllocateObject(&s_leafMethodTable);
+        if (p == NULL)
+            return false;
+
+        if ((i % storeInterval) == 0)
+            WriteBarrier(&GetArrayData(HndFetchHandle(s_ohRoot))[NextRandom() % length], p);
+    }
+
+    return true;
+}
+
+static bool RunPinning(uint32_t pinInterval)
+{
+    // Every 8th object survives for a while, so the ephemeral GCs have to compact around the pinned ones
+    const uint32_t survivorCount = 64 * 1024;
+    const uint32_t survivorInterval = 8;
+    const uint32_t pinnedCount = 1024;
+
+    Object * pSurvivors = AllocateObject(&s_arrayMethodTable.m_MT, survivorCount);
+    if (pSurvivors == NULL)
+        return false;
+
+    HndAssignHandle(s_ohRoot, pSurvivors);
+
+    OBJECTHANDLE pinned[pinnedCount] = {};
+    uint32_t nextPinned = 0;
+    bool result = true;
+
+    for (uint32_t i = 0; i < ScenarioAllocationCount; i++)
+    {
+        Object * p = AllocateObject(&s_leafMethodTable);
+        if (p == NULL)
+        {
+            result = false;
+            break;
+        }
+
+        if ((i % survivorInterval) == 0)
+            WriteBarrier(&GetArrayData(HndFetchHandle(s_ohRoot))[NextRandom() % survivorCount], p);
+
+        if (pinInterval != 0 && (i % pinInterval) == 0)
+        {
+            if (pinned[nextPinned] != NULL)
+                HndDestroyHandle(HndGetHandleTable(pinned[nextPinned]), HNDTYPE_PINNED, pinned[nextPinned]);
+
+            pinned[nextPinned] = HndCreateHandle(GetHandleTable(), HNDTYPE_PINNED, p);
+            if (pinned[nextPinned] == NULL)
+            {
+                result = false;
+                break;
+            }
+
+            nextPinned = (nextPinned + 1) % pinnedCount;
+        }
+    }
+
+    for (uint32_t i = 0; i < pinnedCount; i++)
+    {
+        if (pinned[i] != NULL)
+            HndDestroyHandle(HndGetHandleTable(pinned[i]), HNDTYPE_PINNED, pinned[i]);
+    }
+
+    return result;
+}
+
+struct Scenario
+{
+    const char * name;
+    bool (*run)(uint32_t parameter);
+    uint32_t parameter;
+};
+
+static const Scenario s_scenarios[] =
+{
+    { "alloc",          RunAllocation,      16 * 1024 * 1024 },
+    { "deep-list",      RunDeepList,        1024 * 1024 },
+    { "tree",           RunTree,            20 },
+    { "wide-array",     RunWideArrays,      16 * 1024 },
+    { "cross-gen-1",    RunCrossGeneration, 1 },
+    { "cross-gen-16",   RunCrossGeneration, 16 },
+    { "cross-gen-256",  RunCrossGeneration, 256 },
+    { "pin-0",          RunPinning,         0 },
+    { "pin-1000",       RunPinning,         1000 },
+    { "pin-100",        RunPinning,         100 },
+};
+
+static double TicksToMilliseconds(int64_t ticks)
+{
+    return (double)ticks * 1000.0 / (double)GCToOSInterface::QueryPerformanceFrequency();
+}
+
+static double PhaseMilliseconds(GCBenchPhase phase)
+{
+    return (double)s_stats.phaseUs[phase] / 1000.0;
+}
+
+static bool RunScenario(const Scenario & scenario)
+{
+    // Start every scenario from a clean heap
+    HndAssignHandle(s_ohRoot, NULL);
+    HndAssignHandle(s_ohTemp1, NULL);
+    HndAssignHandle(s_ohTemp2, NULL);
+    s_pGCHeap->GarbageCollect();
+
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_allocatedBytes = 0;
+    s_randomSeed = 1;
+
+    int64_t start = GCToOSInterface::QueryPerformanceCounter();
+    bool result = scenario.run(scenario.parameter);
+    int64_t elapsedTicks = GCToOSInterface::QueryPerformanceCounter() - start;
+
+    if (!result)
+    {
+        printf("%s,failed\n", scenario.name);
+        return false;
+    }
+
+    double allocatedMB = (double)s_allocatedBytes / (1024 * 1024);
+    double elapsedMs = TicksToMilliseconds(elapsedTicks);
+    double mutatorMs = TicksToMilliseconds(elapsedTicks - s_stats.pauseTicks);
+
+    printf("%s,%u,%u,%u,%.1f,%.3f,%.1f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+        scenario.name,
+        s_stats.gcCount[0],
+        s_stats.gcCount[1],
+        s_stats.gcCount[2],
+        allocatedMB,
+        elapsedMs,
+        (mutatorMs > 0) ? allocatedMB * 1000 / mutatorMs : 0.0,
+        TicksToMilliseconds(s_stats.suspendTicks),
+        PhaseMilliseconds(Phase_MarkSizedRef) + PhaseMilliseconds(Phase_MarkRoots),
+        PhaseMilliseconds(Phase_MarkShortWeak),
+        PhaseMilliseconds(Phase_MarkFinalization),
+        PhaseMilliseconds(Phase_MarkLongWeak),
+        PhaseMilliseconds(Phase_Plan),
+        PhaseMilliseconds(Phase_Relocate),
+        PhaseMilliseconds(Phase_Compact),
+        PhaseMilliseconds(Phase_Sweep),
+        TicksToMilliseconds(s_stats.pauseTicks),
+        TicksToMilliseconds(s_stats.maxPauseTicks));
+
+    return true;
+}
+
+extern "C" HRESULT LOCALGC_CALLCONV GC_Initialize(IGCToCLR* clrToGC, IGCHeap** gcHeap, IGCHandleManager** gcHandleManager, GcDacVars* gcDacVars);
+
+int main(int argc, char* argv[])
+{
+    //
+    // Initialize system info
+    //
+    if (!GCToOSInterface::Initialize())
+    {
+        return -1;
+    }
+
+    //
+    // Initialize GC heap
+    //
+    GcDacVars dacVars;
+    IGCHandleManager *pGCHandleManager;
+    if (GC_Initialize(nullptr, &s_pGCHeap, &pGCHandleManager, &dacVars) != S_OK)
+    {
+        return -1;
+    }
+
+    if (FAILED(s_pGCHeap->Initialize()))
+        return -1;
+
+    //
+    // Initialize handle manager
+    //
+    if (!pGCHandleManager->Initialize())
+        return -1;
+
+    //
+    // Initialize current thread
+    //
+    ThreadStore::AttachCurrentThread();
+
+    InitializeMethodTables();
+
+    s_ohRoot = HndCreateHandle(GetHandleTable(), HNDTYPE_DEFAULT, NULL);
+    s_ohTemp1 = HndCreateHandle(GetHandleTable(), HNDTYPE_DEFAULT, NULL);
+    s_ohTemp2 = HndCreateHandle(GetHandleTable(), HNDTYPE_DEFAULT, NULL);
+    if (s_ohRoot == NULL || s_ohTemp1 == NULL || s_ohTemp2 == NULL)
+        return -1;
+
+    g_pfnGCSampleEventCallback = OnGCSampleEvent;
+
+    // The GC records its phase times only while its informational events are enabled
+    g_pGCSampleEventSink = &s_eventSink;
+    s_pGCHeap->ControlEvents(GCEventKeyword_GC, GCEventLevel_Information);
+
+    printf("scenario,gen0,gen1,gen2,allocated_mb,elapsed_ms,alloc_mb_per_s,suspend_ms,"
+           "mark_roots_ms,mark_short_weak_ms,mark_finalization_ms,mark_long_weak_ms,"
+           "plan_ms,relocate_ms,compact_ms,sweep_ms,pause_ms,max_pause_ms\n");
+
+    int result = 0;
+    for (const Scenario & scenario : s_scenarios)
+    {
+        // Run all the scenarios unless some were selected on the command line
+        bool selected = (argc < 2);
+        for (int i = 1; i < argc && !selected; i++)
+        {
+            selected = (strcmp(argv[i], scenario.name) == 0);
+        }
+
+        if (selected && !RunScenario(scenario))
+            result = -1;
+    }
+
+    return result;
+}
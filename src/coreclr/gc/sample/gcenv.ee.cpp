@@ -3,13 +3,26 @@
 
 #include "common.h"
 
+#ifdef TARGET_WINDOWS
 #include "windows.h"
+#endif
 
 #include "gcenv.h"
 #include "gc.h"
 
 EEConfig * g_pConfig;
 
+GCSampleEventCallback g_pfnGCSampleEventCallback;
+IGCToCLREventSink* g_pGCSampleEventSink;
+
+static void NotifyGCSampleEvent(GCSampleEvent event, int generation)
+{
+    if (g_pfnGCSampleEventCallback != NULL)
+        g_pfnGCSampleEventCallback(event, generation);
+}
+
+// The GC itself only uses GCEvent, which GCToOSInterface implements on every platform
+#ifdef TARGET_WINDOWS
 bool CLREventStatic::CreateManualEventNoThrow(bool bInitialState)
 {
     m_hEvent = CreateEventW(NULL, TRUE, bInitialState, NULL);
@@ -94,6 +107,7 @@ uint32_t CLREventStatic::Wait(uint32_t dwMilliseconds, bool bAlertable)
 
     return result;
 }
+#endif // TARGET_WINDOWS
 
 thread_local Thread * pCurrentThread;
 
@@ -129,10 +143,14 @@ void GCToEEInterface::SuspendEE(SUSPEND_REASON reason)
     g_theGCHeap->SetGCInProgress(true);
 
     // TODO: Implement
+
+    NotifyGCSampleEvent(GCSampleEvent::SuspendEE, -1);
 }
 
 void GCToEEInterface::RestartEE(bool bFinishedGC)
 {
+    NotifyGCSampleEvent(GCSampleEvent::RestartEE, -1);
+
     // TODO: Implement
 
     g_theGCHeap->SetGCInProgress(false);
@@ -145,6 +163,7 @@ void GCToEEInterface::GcScanRoots(promote_func* fn,  int condemned, int max_gen,
 
 void GCToEEInterface::GcStartWork(int condemned, int max_gen)
 {
+    NotifyGCSampleEvent(GCSampleEvent::GcStartWork, condemned);
 }
 
 void GCToEEInterface::BeforeGcScanRoots(int condemned, bool is_bgc, bool is_concurrent)
@@ -366,4 +385,13 @@ void GCToEEInterface::LogErrorToHost(const char *message)
 uint64_t GCToEEInterface::GetThreadOSThreadId(Thread* thread)
 {
     return 0;
-}
\ No newline at end of file
+}
+uint32_t GCToEEInterface::GetActiveSyncBlockCount()
+{
+    return 0;
+}
+
+IGCToCLREventSink* GCToEEInterface::EventSink()
+{
+    return g_pGCSampleEventSink;
+}
@@ -137,6 +137,26 @@ public:
     static void AttachCurrentThread();
 };
 
+// -----------------------------------------------------------------------------------------------------------
+// Optional notifications of the stages of a collection, used by the GC benchmark to time them
+//
+
+enum class GCSampleEvent
+{
+    SuspendEE,
+    GcStartWork,
+    RestartEE,
+};
+
+typedef void (*GCSampleEventCallback)(GCSampleEvent event, int generation);
+
+extern GCSampleEventCallback g_pfnGCSampleEventCallback;
+
+// Receives the events the GC fires when it is built with FEATURE_EVENT_TRACE
+class IGCToCLREventSink;
+
+extern IGCToCLREventSink* g_pGCSampleEventSink;
+
 // -----------------------------------------------------------------------------------------------------------
 // Config file enumulation
 //
@@ -28,6 +28,22 @@ void SoftwareWriteWatch::StaticClose()
     g_gc_sw_ww_table = nullptr;
 }
 
+inline bool SoftwareWriteWatch::IsChunkClean(uint8_t *chunk)
+{
+    assert(chunk != nullptr);
+    assert(ALIGN_DOWN(chunk, CleanChunkByteSize) == chunk);
+
+    // Or all of the blocks together instead of testing them one at a time, there are no branches in the loop so it can be
+    // unrolled and vectorized
+    const size_t *blocks = reinterpret_cast<const size_t *>(chunk);
+    size_t dirtyBytes = 0;
+    for (size_t i = 0; i < CleanChunkByteSize / sizeof(size_t); ++i)
+    {
+        dirtyBytes |= blocks[i];
+    }
+    return dirtyBytes == 0;
+}
+
 bool SoftwareWriteWatch::GetDirtyFromBlock(
     uint8_t *block,
     uint8_t *firstPageAddressInBlock,
@@ -188,6 +204,15 @@ void SoftwareWriteWatch::GetDirty(
 
         while (currentBlock < fullBlockEnd)
         {
+            if (ALIGN_DOWN(currentBlock, CleanChunkByteSize) == currentBlock &&
+                static_cast<size_t>(fullBlockEnd - currentBlock) >= CleanChunkByteSize &&
+                IsChunkClean(currentBlock))
+            {
+                currentBlock += CleanChunkByteSize;
+                firstPageAddressInCurrentBlock += CleanChunkByteSize * WRITE_WATCH_UNIT_SIZE;
+                continue;
+            }
+
             if (!GetDirtyFromBlock(
                     currentBlock,
                     firstPageAddressInCurrentBlock,
@@ -31,6 +31,12 @@ private:
     // GetTable()[address >> AddressToTableByteIndexShift] is the byte that represents the region of memory for 'address'.
     static const uint8_t AddressToTableByteIndexShift = SOFTWARE_WRITE_WATCH_AddressToTableByteIndexShift;
 
+    // GetDirty() skips over clean parts of the table this many bytes at a time. The whole chunk is checked with a single
+    // reduction that the compiler can turn into a few vector loads, so on a mostly clean heap the cost of the scan is a
+    // fraction of that of going block by block. Each chunk covers 64 pages.
+    static const size_t CleanChunkByteSize = 64;
+    static_assert(CleanChunkByteSize % sizeof(size_t) == 0, "Unexpected CleanChunkByteSize");
+
 private:
     static void VerifyCreated();
     static void VerifyMemoryRegion(void *baseAddress, size_t regionByteSize);
@@ -74,6 +80,7 @@ public:
     static void SetDirty(void *address, size_t writeByteSize);
     static void SetDirtyRegion(void *baseAddress, size_t regionByteSize);
 private:
+    static bool IsChunkClean(uint8_t *chunk);
     static bool GetDirtyFromBlock(uint8_t *block, uint8_t *firstPageAddressInBlock, size_t startByteIndex, size_t endByteIndex, void **dirtyPages, size_t *dirtyPageIndexRef, size_t dirtyPageCount, bool clearDirty);
 public:
     static void GetDirty(void *baseAddress, size_t regionByteSize, void **dirtyPages, size_t *dirtyPageCountRef, bool clearDirty, bool isRuntimeSuspended);
@@ -45,6 +45,7 @@ Abstract:
 #define PROC_STATM_FILENAME "/proc/self/statm"
 #define CGROUP1_MEMORY_LIMIT_FILENAME "/memory.limit_in_bytes"
 #define CGROUP2_MEMORY_LIMIT_FILENAME "/memory.max"
+#define CGROUP2_MEMORY_HIGH_FILENAME "/memory.high"
 #define CGROUP_MEMORY_STAT_FILENAME "/memory.stat"
 #define CGROUP1_MEMORY_USAGE_FILENAME "/memory.usage_in_bytes"
 #define CGROUP2_MEMORY_USAGE_FILENAME "/memory.current"
@@ -92,6 +93,16 @@ public:
         }
     }
 
+    // memory.high is the usage above which the kernel throttles the cgroup and reclaims memory
+    // aggressively. It only exists for cgroup v2.
+    static bool GetPhysicalMemoryHigh(uint64_t *val)
+    {
+        if (s_cgroup_version == 2)
+            return GetCGroupMemoryValueV2(CGROUP2_MEMORY_HIGH_FILENAME, val);
+
+        return false;
+    }
+
     static bool GetPhysicalMemoryUsage(size_t *val)
     {
         if (s_cgroup_version == 0)
@@ -454,6 +465,11 @@ private:
     }
     
     static bool GetCGroupMemoryLimitV2(uint64_t *val)
+    {
+        return GetCGroupMemoryValueV2(CGROUP2_MEMORY_LIMIT_FILENAME, val);
+    }
+
+    static bool GetCGroupMemoryValueV2(const char *filename, uint64_t *val)
     {
         if (s_memory_cgroup_path == nullptr)
             return false;
@@ -465,13 +481,13 @@ private:
         bool found_any_limit = false;
 
         char *mem_limit_filename = nullptr;
-        if (asprintf(&mem_limit_filename, "%s%s", s_memory_cgroup_path, CGROUP2_MEMORY_LIMIT_FILENAME) < 0)
+        if (asprintf(&mem_limit_filename, "%s%s", s_memory_cgroup_path, filename) < 0)
             return false;
 
         size_t cgroupPathLength = strlen(s_memory_cgroup_path);
 
         // Iterate over the directory hierarchy representing the cgroup hierarchy until reaching the 
-        // mount directory. The mount directory doesn't contain the memory.max.
+        // mount directory. The mount directory doesn't contain the memory limit files.
         do
         {
             if (ReadMemoryValueFromFile(mem_limit_filename, &limit))
@@ -492,7 +508,7 @@ private:
 
             cgroupPathLength = parent_directory_end - mem_limit_filename;
 
-            strcpy(parent_directory_end, CGROUP2_MEMORY_LIMIT_FILENAME);
+            strcpy(parent_directory_end, filename);
         }
         while (cgroupPathLength != memory_cgroup_hierarchy_mount_length);
 
@@ -614,6 +630,22 @@ size_t GetRestrictedPhysicalMemoryLimit()
     }
 }
 
+// Returns the cgroup memory.high threshold, or 0 if there is none or it isn't below the
+// restricted physical memory limit.
+size_t GetPhysicalMemoryHighThreshold(size_t restricted_limit)
+{
+    uint64_t memory_high = 0;
+
+    // An unset memory.high reads as "max" on every level, which doesn't parse as a value.
+    if (!CGroup::GetPhysicalMemoryHigh(&memory_high) || (memory_high == 0))
+        return 0;
+
+    if ((restricted_limit != 0) && (memory_high >= restricted_limit))
+        return 0;
+
+    return (memory_high > std::numeric_limits<size_t>::max()) ? 0 : (size_t)memory_high;
+}
+
 bool GetPhysicalMemoryUsed(size_t* val)
 {
     bool result = false;
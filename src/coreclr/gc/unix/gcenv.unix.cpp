@@ -179,10 +179,14 @@ static uint8_t* g_helperPage = 0;
 static pthread_mutex_t g_flushProcessWriteBuffersMutex;
 
 size_t GetRestrictedPhysicalMemoryLimit();
+size_t GetPhysicalMemoryHighThreshold(size_t restricted_limit);
 bool GetPhysicalMemoryUsed(size_t* val);
 
 static size_t g_RestrictedPhysicalMemoryLimit = 0;
 
+// The cgroup v2 memory.high threshold if it's below the restricted limit, 0 otherwise.
+static size_t g_PhysicalMemoryHighThreshold = 0;
+
 uint32_t g_pageSizeUnixInl = 0;
 
 AffinitySet g_processAffinitySet;
@@ -1229,6 +1233,8 @@ uint64_t GCToOSInterface::GetPhysicalMemoryLimit(bool* is_restricted)
 
     restricted_limit = GetRestrictedPhysicalMemoryLimit();
     VolatileStore(&g_RestrictedPhysicalMemoryLimit, restricted_limit);
+    VolatileStore(&g_PhysicalMemoryHighThreshold,
+        GetPhysicalMemoryHighThreshold((restricted_limit != SIZE_T_MAX) ? restricted_limit : 0));
 
     if (restricted_limit != 0 && restricted_limit != SIZE_T_MAX)
     {
@@ -1379,12 +1385,14 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
     uint32_t load = 0;
 
     size_t used;
+    bool used_p = false;
     if (restricted_limit != 0)
     {
         // Get the physical memory in use - from it, we can get the physical memory available.
         // We do this only when we have the total physical memory available.
         if (GetPhysicalMemoryUsed(&used))
         {
+            used_p = true;
             available = restricted_limit > used ? restricted_limit - used : 0;
             load = (uint32_t)(((float)used * 100) / (float)restricted_limit);
         }
@@ -1431,6 +1439,21 @@ void GCToOSInterface::GetMemoryStatus(uint64_t restricted_limit, uint32_t* memor
         }
     }
 
+    // The kernel starts throttling the process once its usage goes past memory.high, well
+    // before the limit is reached. Report the load relative to memory.high when that is
+    // higher so the GC's high memory load handling (decommitting more aggressively and
+    // triggering gen2 GCs earlier) kicks in ahead of the throttling. Available memory is
+    // still reported against the limit since memory.high is not a hard limit.
+    size_t memory_high = VolatileLoad(&g_PhysicalMemoryHighThreshold);
+    if ((memory_load != nullptr) && (memory_high != 0) && (used_p || GetPhysicalMemoryUsed(&used)))
+    {
+        uint32_t load_high = (uint32_t)std::min((((float)used * 100) / (float)memory_high), 100.0f);
+        if (load_high > load)
+        {
+            load = load_high;
+        }
+    }
+
     if (available_physical != NULL)
         *available_physical = available;
 
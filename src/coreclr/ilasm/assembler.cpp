@@ -354,11 +354,76 @@ mdToken Assembler::GetModRef(_In_ __nullterminated char* szName)
     return tkResScope;
 }
 /**************************************************************************/
+class TypeRefContainer
+{
+private:
+    // Contain the resolution scope and the full class name
+    mdToken scope_;
+    const char *name_;
+    // Hash the name and scope, just for speed of lookup
+    unsigned hash_;
+    // The value we're looking for
+    mdToken token_;
+public:
+    // Constructor for a 'lookup' object
+    TypeRefContainer(mdToken tkResScope, const char *pszFullClassName) :
+        scope_(tkResScope),
+        name_(pszFullClassName),
+        hash_(tkResScope),
+        token_(mdTokenNil)
+    {
+        for (const char *pc = name_; *pc; pc++)
+            hash_ = (hash_ * 257) ^ (unsigned char)*pc;
+    }
+    // Constructor for a 'permanent' object
+    // Don't bother re-hashing, since we will always have already constructed the lookup object
+    TypeRefContainer(const TypeRefContainer &t, mdToken tk) :
+        scope_(t.scope_),
+        hash_(t.hash_),
+        token_(tk)
+    {
+        _ASSERT(tk != mdTokenNil);
+        _ASSERT(t.token_ == mdTokenNil);
+        size_t len = strlen(t.name_) + 1;
+        char *name = new char[len];
+        memcpy(name, t.name_, len);
+        name_ = name;
+    }
+    ~TypeRefContainer()
+    {
+        if (token_ != mdTokenNil)
+            // delete any memory for a 'permanent' object
+            delete[] name_;
+    }
+    // this is the operator for a RBTREE
+    int ComparedTo(TypeRefContainer *t) const
+    {
+        // Order by hash, then scope, then name. The values are unsigned, so compare them
+        // rather than subtracting, which would not give a consistent order.
+        if (hash_ != t->hash_)
+            return (hash_ < t->hash_) ? -1 : 1;
+        if (scope_ != t->scope_)
+            return (scope_ < t->scope_) ? -1 : 1;
+        return strcmp(name_, t->name_);
+    }
+    // The only public data we need
+    mdToken Token() const { return token_; }
+};
+
+static RBTREE<TypeRefContainer> typeRefCache;
+
 mdToken Assembler::MakeTypeRef(mdToken tkResScope, LPCUTF8 pszFullClassName)
 {
     mdToken tkRet = mdTokenNil;
     if(pszFullClassName && *pszFullClassName)
     {
+        // DefineTypeRefByName looks the name up in metadata (and the enclosing
+        // classes, one name at a time) on every call; look it up in a cache instead
+        TypeRefContainer trc(tkResScope, pszFullClassName);
+        TypeRefContainer *res = typeRefCache.FIND(&trc);
+        if (res != NULL)
+            return res->Token();
+
         LPCUTF8 pc;
         if((pc = strrchr(pszFullClassName,NESTING_SEP))) // scope: enclosing class
         {
@@ -382,6 +447,8 @@ mdToken Assembler::MakeTypeRef(mdToken tkResScope, LPCUTF8 pszFullClassName)
             MultiByteToWideChar(g_uCodePage,0,pc,-1,wzUniBuf,dwUniBuf);
             if(FAILED(m_pEmitter->DefineTypeRefByName(tkResScope, wzUniBuf, &tkRet))) tkRet = mdTokenNil;
         }
+        if (tkRet != mdTokenNil)
+            typeRefCache.PUSH(new TypeRefContainer(trc, tkRet));
     }
     return tkRet;
 }
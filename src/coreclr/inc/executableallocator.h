@@ -117,19 +117,13 @@ private:
     // for platforms that don't use shared memory.
     size_t m_freeOffset = 0;
 
-// Uncomment these to gather information to better choose caching parameters
-//#define VARIABLE_SIZED_CACHEDMAPPING_SIZE
-
     // Last RW mappings cached so that it can be reused for the next mapping
     // request if it goes into the same range.
-    // This is handled as a 3 element cache with an LRU replacement policy
-#ifdef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-    // If variable sized mappings enabled, make the cache physically big enough to cover all interesting sizes
+    // This is handled as a small cache with an LRU replacement policy. It holds 3 elements
+    // by default, the WriteXorExecuteMappingCacheSize setting can make it use up to all of
+    // the physical slots.
     static int g_cachedMappingSize;
     BlockRW* m_cachedMapping[16] = { 0 };
-#else
-    BlockRW* m_cachedMapping[3] = { 0 };
-#endif
 
     // Synchronization of the public allocator methods
     CRITSEC_COOKIE m_CriticalSection;
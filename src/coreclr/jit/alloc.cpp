@@ -89,8 +89,16 @@ void* ArenaAllocator::allocateNewPage(size_t size)
         pageSize = roundUp(pageSize, DEFAULT_PAGE_SIZE);
     }
 
-    // Allocate the new page
-    PageDescriptor* newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    // Allocate the new page, preferring one left over from a previous compilation on this thread
+    PageDescriptor* newPage = bypassHostAllocator() ? nullptr : t_pagePool.take(pageSize);
+    if (newPage != nullptr)
+    {
+        pageSize = newPage->m_pageBytes;
+    }
+    else
+    {
+        newPage = static_cast<PageDescriptor*>(allocateHostMemory(pageSize, &pageSize));
+    }
 
     // Append the new page to the end of the list
     newPage->m_next      = nullptr;
@@ -125,11 +133,15 @@ void ArenaAllocator::destroy()
 {
     PageDescriptor* page = m_firstPage;
 
-    // Free all of the allocated pages
+    // Free all of the allocated pages, keeping a few in the per-thread pool
+    const bool canPool = !bypassHostAllocator();
     for (PageDescriptor* next; page != nullptr; page = next)
     {
         next = page->m_next;
-        freeHostMemory(page, page->m_pageBytes);
+        if (!canPool || !t_pagePool.give(page))
+        {
+            freeHostMemory(page, page->m_pageBytes);
+        }
     }
 
     // Clear out the allocator's fields
@@ -139,6 +151,102 @@ void ArenaAllocator::destroy()
     m_lastFreeByte = nullptr;
 }
 
+thread_local ArenaAllocator::PagePool ArenaAllocator::t_pagePool;
+LONG                                  ArenaAllocator::s_pooledPageCount = 0;
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PagePool::~PagePool:
+//    Returns any pooled pages to the host when the thread exits.
+ArenaAllocator::PagePool::~PagePool()
+{
+    release();
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PagePool::take:
+//    Takes a pooled page that is large enough for a request.
+//
+// Arguments:
+//    size - The number of bytes needed, including the page descriptor.
+//
+// Return Value:
+//    A page with at least `size` bytes, or nullptr if none is pooled.
+ArenaAllocator::PageDescriptor* ArenaAllocator::PagePool::take(size_t size)
+{
+    if (m_host != g_jitHost)
+    {
+        // The pooled pages (if any) belong to a different host.
+        release();
+        return nullptr;
+    }
+
+    for (PageDescriptor** pPage = &m_pages; *pPage != nullptr; pPage = &(*pPage)->m_next)
+    {
+        PageDescriptor* page = *pPage;
+        if (page->m_pageBytes >= size)
+        {
+            *pPage = page->m_next;
+            m_pageCount--;
+            InterlockedDecrement(&s_pooledPageCount);
+            return page;
+        }
+    }
+
+    return nullptr;
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PagePool::give:
+//    Tries to keep a page in the pool for reuse by a later compilation.
+//
+// Arguments:
+//    page - The page to keep.
+//
+// Return Value:
+//    True if the pool took ownership of the page; false if the caller
+//    should free it.
+bool ArenaAllocator::PagePool::give(PageDescriptor* page)
+{
+    if (page->m_pageBytes > MAX_POOLED_PAGE_SIZE)
+    {
+        return false;
+    }
+
+    // Reserve a slot under the process-wide cap before taking the page.
+    if (InterlockedIncrement(&s_pooledPageCount) > JitConfig.JitArenaPoolPages())
+    {
+        InterlockedDecrement(&s_pooledPageCount);
+        return false;
+    }
+
+    if (m_host != g_jitHost)
+    {
+        release();
+        m_host = g_jitHost;
+    }
+
+    page->m_next = m_pages;
+    m_pages      = page;
+    m_pageCount++;
+    return true;
+}
+
+//------------------------------------------------------------------------
+// ArenaAllocator::PagePool::release:
+//    Returns all pooled pages to the host they were allocated from.
+void ArenaAllocator::PagePool::release()
+{
+    for (PageDescriptor *page = m_pages, *next; page != nullptr; page = next)
+    {
+        next = page->m_next;
+        m_host->freeSlab(page, page->m_pageBytes);
+        InterlockedDecrement(&s_pooledPageCount);
+    }
+
+    m_pages     = nullptr;
+    m_pageCount = 0;
+}
+
 //------------------------------------------------------------------------
 // ArenaAllocator::allocateHostMemory:
 //    Allocates memory from the host (or the OS if `bypassHostAllocator()`
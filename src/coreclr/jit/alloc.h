@@ -49,6 +49,31 @@ private:
     BYTE* m_nextFreeByte;
     BYTE* m_lastFreeByte;
 
+    // A small per-thread cache of arena pages that is kept between
+    // compilations, so that back-to-back compilations on the same thread do
+    // not have to go back to the host for every page.
+    struct PagePool
+    {
+        PageDescriptor* m_pages     = nullptr;
+        unsigned        m_pageCount = 0;
+        ICorJitHost*    m_host      = nullptr; // Host the pooled pages came from.
+
+        ~PagePool();
+
+        PageDescriptor* take(size_t size);
+        bool            give(PageDescriptor* page);
+        void            release();
+    };
+
+    static thread_local PagePool t_pagePool;
+
+    // Number of pages held by the pools of all threads. An idle thread never
+    // returns its pages, so the total is capped rather than each pool.
+    static LONG s_pooledPageCount;
+
+    // Pages larger than this go straight back to the host.
+    static const size_t MAX_POOLED_PAGE_SIZE = 4 * DEFAULT_PAGE_SIZE;
+
     void* allocateNewPage(size_t size);
 
     static void* allocateHostMemory(size_t size, size_t* pActualSize);
@@ -1291,6 +1291,16 @@ void CodeGen::genUnspillRegIfNeeded(GenTree* tree)
             }
             unspillTree->gtFlags &= ~GTF_SPILLED;
         }
+        else if (unspillTree->IsRematerializableConstant())
+        {
+            // The constant was not stored to a spill temp; recreate it in the
+            // register specified by 'tree', which may be a GT_RELOAD.
+            regNumber dstReg = tree->GetRegNum();
+            genSetRegToConst(dstReg, unspillTree->TypeGet(), unspillTree);
+
+            unspillTree->gtFlags &= ~GTF_SPILLED;
+            gcInfo.gcMarkRegPtrVal(dstReg, unspillTree->TypeGet());
+        }
         else
         {
             // Here we may have a GT_RELOAD.
@@ -2143,6 +2153,12 @@ void CodeGen::genProduceReg(GenTree* tree)
                     }
                 }
             }
+            else if (tree->IsRematerializableConstant() && ((tree->gtFlags & GTF_NOREG_AT_USE) == 0))
+            {
+                // The constant will be recreated at the reload, so there is
+                // nothing to store.
+                gcInfo.gcMarkRegSetNpt(genRegMask(tree->GetRegNum()));
+            }
             else
             {
                 regSet.rsSpillTree(tree->GetRegNum(), tree);
@@ -2187,9 +2187,10 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     opts.compDbgEnC  = jitFlags->IsSet(JitFlags::JIT_FLAG_DEBUG_EnC);
 
 #ifdef DEBUG
-    opts.compJitAlignLoopAdaptive       = JitConfig.JitAlignLoopAdaptive() == 1;
-    opts.compJitAlignLoopBoundary       = (unsigned short)JitConfig.JitAlignLoopBoundary();
-    opts.compJitAlignLoopMinBlockWeight = (unsigned short)JitConfig.JitAlignLoopMinBlockWeight();
+    opts.compJitAlignLoopAdaptive             = JitConfig.JitAlignLoopAdaptive() == 1;
+    opts.compJitAlignLoopBoundary             = (unsigned short)JitConfig.JitAlignLoopBoundary();
+    opts.compJitAlignLoopMinBlockWeight       = (unsigned short)JitConfig.JitAlignLoopMinBlockWeight();
+    opts.compJitAlignLoopMinProfileIterations = (unsigned short)JitConfig.JitAlignLoopMinProfileIterations();
 
     opts.compJitAlignLoopForJcc             = JitConfig.JitAlignLoopForJcc() == 1;
     opts.compJitAlignLoopMaxCodeSize        = (unsigned short)JitConfig.JitAlignLoopMaxCodeSize();
@@ -2197,13 +2198,14 @@ void Compiler::compInitOptions(JitFlags* jitFlags)
     opts.compJitOptimizeStructHiddenBuffer  = JitConfig.JitOptimizeStructHiddenBuffer() == 1;
     opts.compJitUnrollLoopMaxIterationCount = (unsigned short)JitConfig.JitUnrollLoopMaxIterationCount();
 #else
-    opts.compJitAlignLoopAdaptive           = true;
-    opts.compJitAlignLoopBoundary           = DEFAULT_ALIGN_LOOP_BOUNDARY;
-    opts.compJitAlignLoopMinBlockWeight     = DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT;
-    opts.compJitAlignLoopMaxCodeSize        = DEFAULT_MAX_LOOPSIZE_FOR_ALIGN;
-    opts.compJitHideAlignBehindJmp          = true;
-    opts.compJitOptimizeStructHiddenBuffer  = true;
-    opts.compJitUnrollLoopMaxIterationCount = DEFAULT_UNROLL_LOOP_MAX_ITERATION_COUNT;
+    opts.compJitAlignLoopAdaptive             = true;
+    opts.compJitAlignLoopBoundary             = DEFAULT_ALIGN_LOOP_BOUNDARY;
+    opts.compJitAlignLoopMinBlockWeight       = DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT;
+    opts.compJitAlignLoopMinProfileIterations = DEFAULT_ALIGN_LOOP_MIN_PROFILE_ITERATIONS;
+    opts.compJitAlignLoopMaxCodeSize          = DEFAULT_MAX_LOOPSIZE_FOR_ALIGN;
+    opts.compJitHideAlignBehindJmp            = true;
+    opts.compJitOptimizeStructHiddenBuffer    = true;
+    opts.compJitUnrollLoopMaxIterationCount   = DEFAULT_UNROLL_LOOP_MAX_ITERATION_COUNT;
 #endif
 
 #ifdef TARGET_XARCH
@@ -3773,10 +3775,26 @@ _SetMinOpts:
         compSwitchedToMinOpts = true;
     }
 
+    // Large methods that stay optimized skip or scale back the optimizations
+    // whose cost grows fastest with method size.
+    if (!theMinOptsValue && !compIsForInlining() && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_PREJIT))
+    {
+        const unsigned throughputModeInstrCount = (unsigned)JitConfig.JitThroughputModeInstrCount();
+        if ((throughputModeInstrCount != 0) && (opts.instrCount > throughputModeInstrCount))
+        {
+            compThroughputMode = true;
+            Metrics.ThroughputModeMethods++;
+        }
+    }
+
 #ifdef DEBUG
     if (verbose && !compIsForInlining())
     {
         printf("OPTIONS: opts.MinOpts() == %s\n", opts.MinOpts() ? "true" : "false");
+        if (compThroughputMode)
+        {
+            printf("OPTIONS: throughput mode (%u IL instructions)\n", opts.instrCount);
+        }
     }
 #endif
 
@@ -5312,6 +5330,32 @@ bool Compiler::shouldAlignLoop(FlowGraphNaturalLoop* loop, BasicBlock* top)
         return false;
     }
 
+    // With profile data the block weights tell how often the loop is entered as well as how hot it is.
+    // A hot loop that is entered often but only runs a couple of iterations each time gets little
+    // out of alignment, while its padding still costs code size and can push other hot code across
+    // fetch boundaries.
+    BasicBlock* header = loop->GetHeader();
+    if (fgIsUsingProfileWeights() && header->hasProfileWeight())
+    {
+        weight_t entryWeight = 0;
+        for (FlowEdge* const entryEdge : loop->EntryEdges())
+        {
+            entryWeight += entryEdge->getLikelyWeight();
+        }
+
+        if (entryWeight > BB_ZERO_WEIGHT)
+        {
+            weight_t iterations = header->bbWeight / entryWeight;
+            if (iterations < opts.compJitAlignLoopMinProfileIterations)
+            {
+                JITDUMP("Skipping alignment for " FMT_LP " that starts at " FMT_BB ", profiled iterations=" FMT_WT
+                        " < %u.\n",
+                        loop->GetIndex(), top->bbNum, iterations, opts.compJitAlignLoopMinProfileIterations);
+                return false;
+            }
+        }
+    }
+
     JITDUMP("Aligning " FMT_LP " that starts at " FMT_BB ", weight=" FMT_WT " >= " FMT_WT ".\n", loop->GetIndex(),
             top->bbNum, topWeight, compareWeight);
     return true;
@@ -6394,13 +6438,14 @@ void Compiler::compCompileFinish()
     genMethodCnt++;
 #endif
 
+    // The arena usage is cheap to compute, so report it in all builds.
+    Metrics.BytesAllocated = (int64_t)compArenaAllocator->getTotalBytesUsed();
+
 #if MEASURE_MEM_ALLOC
     {
         compArenaAllocator->finishMemStats();
         memAllocHist.record((unsigned)((compArenaAllocator->getTotalBytesAllocated() + 1023) / 1024));
         memUsedHist.record((unsigned)((compArenaAllocator->getTotalBytesUsed() + 1023) / 1024));
-
-        Metrics.BytesAllocated = (int64_t)compArenaAllocator->getTotalBytesUsed();
     }
 
 #ifdef DEBUG
@@ -3716,7 +3716,7 @@ public:
     // Get the class handle for an helper call
     CORINFO_CLASS_HANDLE gtGetHelperCallClassHandle(GenTreeCall* call, bool* pIsExact, bool* pIsNonNull);
     // Get the element handle for an array of ref type.
-    CORINFO_CLASS_HANDLE gtGetArrayElementClassHandle(GenTree* array);
+    CORINFO_CLASS_HANDLE gtGetArrayElementClassHandle(GenTree* array, bool* pIsArrayExact = nullptr);
     // Get a class handle from a helper call argument
     CORINFO_CLASS_HANDLE gtGetHelperArgClassHandle(GenTree* array);
     // Get a method handle from a helper call argument
@@ -3892,6 +3892,13 @@ public:
     unsigned lvaTrackedCount;             // actual # of locals being tracked
     unsigned lvaTrackedCountInSizeTUnits; // min # of size_t's sufficient to hold a bit for all the locals being tracked
 
+    // Upper bound on lvaTrackedCount; halved in throughput mode to bound liveness, SSA and LSRA costs.
+    unsigned lvaMaxTrackedCount() const
+    {
+        unsigned maxTracked = (unsigned)JitConfig.JitMaxLocalsToTrack();
+        return compThroughputMode ? max(maxTracked / 2, 1u) : maxTracked;
+    }
+
 #ifdef DEBUG
     VARSET_TP lvaTrackedVars; // set of tracked variables
 #endif
@@ -4487,6 +4494,26 @@ protected:
         return compiler->impEnumeratorGdvLocalMap;
     }
 
+    // Known delegate target support
+    //
+    typedef JitHashTable<unsigned, JitSmallPrimitiveKeyFuncs<unsigned>, CORINFO_METHOD_HANDLE> LclNumToMethodMap;
+
+    // Maps newobj temps holding freshly constructed delegates to the method they invoke.
+    // Map is only set on the root instance.
+    //
+    LclNumToMethodMap* impDelegateTargetMap = nullptr;
+    LclNumToMethodMap* getImpDelegateTargetMap()
+    {
+        Compiler* compiler = impInlineRoot();
+        if (compiler->impDelegateTargetMap == nullptr)
+        {
+            CompAllocator alloc(compiler->getAllocator(CMK_Generic));
+            compiler->impDelegateTargetMap = new (alloc) LclNumToMethodMap(alloc);
+        }
+
+        return compiler->impDelegateTargetMap;
+    }
+
 #define SMALL_STACK_SIZE 16 // number of elements in impSmallStack
 
     struct SavedStack // used to save/restore stack contents.
@@ -4574,6 +4601,7 @@ protected:
     GenTree* impInitClass(CORINFO_RESOLVED_TOKEN* pResolvedToken);
 
     GenTree* impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORINFO_CLASS_HANDLE ownerCls);
+    GenTree* impImportStaticReadOnlyStructFields(CORINFO_CLASS_HANDLE fieldClsHnd, uint8_t* buffer, unsigned totalSize);
 
     GenTree* impImportStaticFieldAddress(CORINFO_RESOLVED_TOKEN* pResolvedToken,
                                          CORINFO_ACCESS_FLAGS    access,
@@ -4611,6 +4639,7 @@ protected:
     };
     GenTree* impUtf16StringComparison(StringComparisonKind kind, CORINFO_SIG_INFO* sig, unsigned methodFlags);
     GenTree* impUtf16SpanComparison(StringComparisonKind kind, CORINFO_SIG_INFO* sig, unsigned methodFlags);
+    GenTree* impUtf16ConstantContains(CORINFO_SIG_INFO* sig, unsigned methodFlags);
     GenTree* impExpandHalfConstEquals(GenTreeLclVarCommon*   data,
                                       GenTree*         lengthFld,
                                       bool             checkForNull,
@@ -5993,6 +6022,8 @@ public:
     bool fgLateCastExpansionForCall(BasicBlock** pBlock, Statement* stmt, GenTreeCall* call);
 
     PhaseStatus fgInsertGCPolls();
+    GCPollType  fgSelectGCPollType(BasicBlock* block);
+    bool        fgInsertLoopGCPolls();
     BasicBlock* fgCreateGCPoll(GCPollType pollType, BasicBlock* block);
 
 public:
@@ -6190,7 +6221,8 @@ public:
     class ThreeOptLayout
     {
         static bool EdgeCmp(const FlowEdge* left, const FlowEdge* right);
-        static constexpr unsigned maxSwaps = 1000;
+        static constexpr unsigned maxSwaps  = 1000;
+        static constexpr unsigned maxPasses = 3;
 
         Compiler* compiler;
         PriorityQueue<FlowEdge*, decltype(&ThreeOptLayout::EdgeCmp)> cutPoints;
@@ -6200,7 +6232,7 @@ public:
 
         bool IsCandidateBlock(BasicBlock* block) const;
 
-        INDEBUG(weight_t GetLayoutCost(unsigned startPos, unsigned endPos);)
+        weight_t GetLayoutCost(unsigned startPos, unsigned endPos);
         weight_t GetCost(BasicBlock* block, BasicBlock* next);
         weight_t GetPartitionCostDelta(unsigned s2Start, unsigned s3Start, unsigned s3End, unsigned s4End);
         void SwapPartitions(unsigned s1Start, unsigned s2Start, unsigned s3Start, unsigned s3End, unsigned s4End);
@@ -7035,6 +7067,7 @@ public:
     void optCloneLoop(FlowGraphNaturalLoop* loop, LoopCloneContext* context);
     PhaseStatus optUnrollLoops(); // Unrolls loops (needs to have cost info)
     bool optTryUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR);
+    bool optTryPartiallyUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR);
     void optRedirectPrevUnrollIteration(FlowGraphNaturalLoop* loop, BasicBlock* prevTestBlock, BasicBlock* target);
     void optReplaceScalarUsesWithConst(BasicBlock* block, unsigned lclNum, ssize_t cnsVal);
     void        optRemoveRedundantZeroInits();
@@ -7268,6 +7301,12 @@ protected:
     weight_t optCSEweight;         // The weight of the current block when we are doing PerformCSE
     CSE_HeuristicCommon* optCSEheuristic = nullptr; // CSE Heuristic to use for this method
 
+    // Upper bound on optCSECandidateCount; halved in throughput mode.
+    unsigned optCSEMaxCandidateCount() const
+    {
+        return compThroughputMode ? (MAX_CSE_CNT / 2) : MAX_CSE_CNT;
+    }
+
     bool optIsCSEcandidate(GenTree* tree, bool isReturn = false);
 
     // lclNumIsTrueCSE returns true if the LclVar was introduced by the CSE phase of the compiler
@@ -7518,6 +7557,11 @@ public:
 
     bool isCompatibleMethodGDV(GenTreeCall* call, CORINFO_METHOD_HANDLE gdvTarget);
 
+    void impNoteDelegateTarget(GenTreeCall* ctorCall, GenTree* newobjThis, methodPointerInfo* ldftnInfo);
+    bool impDevirtualizeKnownDelegateInvoke(GenTreeCall*            call,
+                                            CORINFO_CALL_INFO*      callInfo,
+                                            CORINFO_CONTEXT_HANDLE* exactContextHandle);
+
     void addGuardedDevirtualizationCandidate(GenTreeCall*           call,
                                              CORINFO_METHOD_HANDLE  methodHandle,
                                              CORINFO_CLASS_HANDLE   classHandle,
@@ -7540,9 +7584,15 @@ public:
                 return 3;
             }
 
-            // We plan to use 3 for CoreCLR too, but we need to make sure it doesn't regress performance
-            // as CoreCLR heavily relies on Dynamic PGO while for NativeAOT we *usually* don't have it and
-            // can only perform the "exact" devirtualization.
+            // With Dynamic PGO data the class histograms tell us which call sites are really
+            // polymorphic, and the likelihood thresholds in pickGDV keep the extra
+            // guesses to the classes that matter, so a site that sees a few classes can be
+            // devirtualized instead of going through the stub. Without it, stay with a single guess.
+            if ((fgPgoSource == ICorJitInfo::PgoSource::Dynamic) && !opts.jitFlags->IsSet(JitFlags::JIT_FLAG_SIZE_OPT))
+            {
+                return 3;
+            }
+
             return 1;
         }
 
@@ -7674,6 +7724,10 @@ public:
     void optReplaceWidenedIV(unsigned lclNum, unsigned ssaNum, unsigned newLclNum, Statement* stmt);
     void optSinkWidenedIV(unsigned lclNum, unsigned newLclNum, FlowGraphNaturalLoop* loop);
 
+    bool optRecognizeFillLoop(ScalarEvolutionContext& scevContext,
+                              FlowGraphNaturalLoop*   loop,
+                              LoopLocalOccurrences*   loopLocals);
+
     bool optRemoveUnusedIVs(FlowGraphNaturalLoop* loop, LoopLocalOccurrences* loopLocals);
     bool optIsUpdateOfIVWithoutSideEffects(GenTree* tree, unsigned lclNum);
 
@@ -10017,6 +10071,7 @@ public:
     bool compHasBackwardJumpInHandler = false; // Does the method have a lexically backwards jump in a handler?
     bool compSwitchedToOptimized      = false; // Codegen initially was Tier0 but jit switched to FullOpts
     bool compSwitchedToMinOpts        = false; // Codegen initially was Tier1/FullOpts but jit switched to MinOpts
+    bool compThroughputMode           = false; // Method is large enough that expensive opts are scaled back
     bool compSuppressedZeroInit       = false; // There are vars with lvSuppressedZeroInit set
     bool compMaskConvertUsed          = false; // Does the method have Convert Mask To Vector nodes.
 
@@ -10389,6 +10444,10 @@ public:
 // Default minimum loop block weight required to enable loop alignment.
 #define DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT 3
 
+// Default minimum average number of iterations per entry, as measured by profile data,
+// required to enable loop alignment.
+#define DEFAULT_ALIGN_LOOP_MIN_PROFILE_ITERATIONS 8
+
 // By default a loop will be aligned at 32B address boundary to get better
 // performance as per architecture manuals.
 #define DEFAULT_ALIGN_LOOP_BOUNDARY 0x20
@@ -10413,6 +10472,10 @@ public:
         // Minimum weight needed for the first block of a loop to make it a candidate for alignment.
         unsigned short compJitAlignLoopMinBlockWeight;
 
+        // Minimum average iteration count per loop entry, when the loop has profile data, to make it a candidate
+        // for alignment.
+        unsigned short compJitAlignLoopMinProfileIterations;
+
         // For non-adaptive alignment, address boundary (power of 2) at which loop alignment should
         // be done. By default, 32B.
         unsigned short compJitAlignLoopBoundary;
@@ -1145,7 +1145,12 @@ void Compiler::eeAllocMem(AllocMemArgs* args, const UNATIVE_OFFSET roDataSection
     // compiler does.
     // This way allows us to use a single `ldr` to access such data like float constant/jmp table.
     // For LoongArch64 using `pcaddi + ld` to access such data.
+    //
+    // When jitted code is really split, the VM needs to know the size of the hot code alone, as
+    // offsets into the cold code continue after it. The VM places the data right after the hot
+    // code in that case.
 
+    const bool     mergeRoData          = (args->coldCodeSize == 0) || opts.IsReadyToRun();
     UNATIVE_OFFSET roDataAlignmentDelta = 0;
     if (args->roDataSize > 0)
     {
@@ -1153,8 +1158,11 @@ void Compiler::eeAllocMem(AllocMemArgs* args, const UNATIVE_OFFSET roDataSection
     }
 
     const UNATIVE_OFFSET roDataOffset = args->hotCodeSize + roDataAlignmentDelta;
-    args->hotCodeSize                 = roDataOffset + args->roDataSize;
-    args->roDataSize                  = 0;
+    if (mergeRoData)
+    {
+        args->hotCodeSize = roDataOffset + args->roDataSize;
+        args->roDataSize  = 0;
+    }
 
 #endif // defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
 
@@ -1176,10 +1184,13 @@ void Compiler::eeAllocMem(AllocMemArgs* args, const UNATIVE_OFFSET roDataSection
 #if defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
 
     // Fix up data section pointers.
-    assert(args->roDataBlock == nullptr);
-    assert(args->roDataBlockRW == nullptr);
-    args->roDataBlock   = ((BYTE*)args->hotCodeBlock) + roDataOffset;
-    args->roDataBlockRW = ((BYTE*)args->hotCodeBlockRW) + roDataOffset;
+    if (mergeRoData)
+    {
+        assert(args->roDataBlock == nullptr);
+        assert(args->roDataBlockRW == nullptr);
+        args->roDataBlock   = ((BYTE*)args->hotCodeBlock) + roDataOffset;
+        args->roDataBlockRW = ((BYTE*)args->hotCodeBlockRW) + roDataOffset;
+    }
 
 #endif // defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
 }
@@ -4522,7 +4522,6 @@ bool Compiler::ThreeOptLayout<hasEH>::IsCandidateBlock(BasicBlock* block) const
     return (block->bbPreorderNum < numCandidateBlocks) && (blockOrder[block->bbPreorderNum] == block);
 }
 
-#ifdef DEBUG
 //-----------------------------------------------------------------------------
 // Compiler::ThreeOptLayout::GetLayoutCost: Computes the cost of the layout for the region
 // bounded by 'startPos' and 'endPos'.
@@ -4549,7 +4548,6 @@ weight_t Compiler::ThreeOptLayout<hasEH>::GetLayoutCost(unsigned startPos, unsig
     layoutCost += blockOrder[endPos]->bbWeight;
     return layoutCost;
 }
-#endif // DEBUG
 
 //-----------------------------------------------------------------------------
 // Compiler::ThreeOptLayout::GetCost: Computes the cost of placing 'next' after 'block'.
@@ -5014,7 +5012,13 @@ bool Compiler::ThreeOptLayout<hasEH>::RunGreedyThreeOptPass(unsigned startPos, u
         numSwaps++;
     }
 
-    cutPoints.Clear();
+    // If we stopped at the swap limit, the remaining edges are still marked as visited.
+    // Unmark them, or later passes would never consider them again.
+    while (!cutPoints.Empty())
+    {
+        cutPoints.Pop()->markUnvisited();
+    }
+
     return modified;
 }
 
@@ -5037,16 +5041,45 @@ void Compiler::ThreeOptLayout<hasEH>::RunThreeOpt()
     const unsigned endPos   = numCandidateBlocks - 1;
 
     JITDUMP("Initial layout cost: %f\n", GetLayoutCost(startPos, endPos));
-    const bool modified = RunGreedyThreeOptPass(startPos, endPos);
+
+    // Swaps made late in a pass can make previously rejected swaps profitable,
+    // so keep refining the layout until a pass makes no changes.
+    bool modified = false;
+    for (unsigned pass = 0; pass < maxPasses; pass++)
+    {
+        if (!RunGreedyThreeOptPass(startPos, endPos))
+        {
+            break;
+        }
+
+        modified = true;
+    }
+
+    const weight_t layoutCost = GetLayoutCost(startPos, endPos);
 
     if (modified)
     {
-        JITDUMP("Final layout cost: %f\n", GetLayoutCost(startPos, endPos));
+        JITDUMP("Final layout cost: %f\n", layoutCost);
     }
     else
     {
         JITDUMP("No changes made.\n");
     }
+
+    // Report how much of the hot flow falls through, in units of method entries,
+    // so that layout changes can be compared across methods in SPMI.
+    const weight_t entryWeight = compiler->fgFirstBB->bbWeight;
+    if (entryWeight > BB_ZERO_WEIGHT)
+    {
+        weight_t hotWeight = BB_ZERO_WEIGHT;
+        for (unsigned position = startPos; position <= endPos; position++)
+        {
+            hotWeight += blockOrder[position]->bbWeight;
+        }
+
+        compiler->Metrics.LayoutHotWeight += hotWeight / entryWeight;
+        compiler->Metrics.LayoutFallthroughWeight += max(0.0, hotWeight - layoutCost) / entryWeight;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -66,6 +66,9 @@ static bool blockNeedsGCPoll(BasicBlock* block)
 //    This must be done after any transformations that would add control flow between
 //    calls.
 //
+//    With JitLoopGCPolls, optimized methods also get polls on loop back edges;
+//    see fgInsertLoopGCPolls.
+//
 // Returns:
 //    PhaseStatus indicating what, if anything, was changed.
 //
@@ -73,7 +76,9 @@ PhaseStatus Compiler::fgInsertGCPolls()
 {
     PhaseStatus result = PhaseStatus::MODIFIED_NOTHING;
 
-    if ((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0)
+    const bool needsLoopPolls = opts.OptimizationEnabled() && (JitConfig.JitLoopGCPolls() != 0);
+
+    if (((optMethodFlags & OMF_NEEDS_GCPOLLS) == 0) && !needsLoopPolls)
     {
         return result;
     }
@@ -112,50 +117,128 @@ PhaseStatus Compiler::fgInsertGCPolls()
 
         assert(block->KindIs(BBJ_RETURN, BBJ_ALWAYS, BBJ_COND, BBJ_SWITCH, BBJ_THROW, BBJ_CALLFINALLY));
 
-        GCPollType pollType = GCPOLL_INLINE;
+        BasicBlock* curBasicBlock = fgCreateGCPoll(fgSelectGCPollType(block), block);
+        createdPollBlocks |= (block != curBasicBlock);
+        block = curBasicBlock;
+    }
 
-        // We'd like to insert an inline poll. Below is the list of places where we
-        // can't or don't want to emit an inline poll. Check all of those. If after all of that we still
-        // have INLINE, then emit an inline check.
+    if (needsLoopPolls && fgInsertLoopGCPolls())
+    {
+        result            = PhaseStatus::MODIFIED_EVERYTHING;
+        createdPollBlocks = true;
+    }
 
-        if (opts.OptimizationDisabled())
-        {
-            // Don't split blocks and create inlined polls unless we're optimizing.
-            //
-            JITDUMP("Selecting CALL poll in block " FMT_BB " because of debug/minopts\n", block->bbNum);
-            pollType = GCPOLL_CALL;
-        }
-        else if (genReturnBB == block)
-        {
-            // we don't want to split the single return block
-            //
-            JITDUMP("Selecting CALL poll in block " FMT_BB " because it is the single return block\n", block->bbNum);
-            pollType = GCPOLL_CALL;
-        }
-        else if (BBJ_SWITCH == block->GetKind())
+    // We should never split blocks unless we're optimizing.
+    assert(!createdPollBlocks || opts.OptimizationEnabled());
+
+    return result;
+}
+
+//------------------------------------------------------------------------------
+// fgSelectGCPollType : Choose the kind of GC poll to insert for the given block.
+//
+// Arguments:
+//    block - Basic block that needs a poll
+//
+// Return Value:
+//    GCPOLL_INLINE when the block can be split for an inline check of
+//    g_TrapReturningThreads; otherwise, GCPOLL_CALL.
+//
+Compiler::GCPollType Compiler::fgSelectGCPollType(BasicBlock* block)
+{
+    GCPollType pollType = GCPOLL_INLINE;
+
+    // We'd like to insert an inline poll. Below is the list of places where we
+    // can't or don't want to emit an inline poll. Check all of those. If after all of that we still
+    // have INLINE, then emit an inline check.
+
+    if (opts.OptimizationDisabled())
+    {
+        // Don't split blocks and create inlined polls unless we're optimizing.
+        //
+        JITDUMP("Selecting CALL poll in block " FMT_BB " because of debug/minopts\n", block->bbNum);
+        pollType = GCPOLL_CALL;
+    }
+    else if (genReturnBB == block)
+    {
+        // we don't want to split the single return block
+        //
+        JITDUMP("Selecting CALL poll in block " FMT_BB " because it is the single return block\n", block->bbNum);
+        pollType = GCPOLL_CALL;
+    }
+    else if (BBJ_SWITCH == block->GetKind())
+    {
+        // We don't want to deal with all the outgoing edges of a switch block.
+        //
+        JITDUMP("Selecting CALL poll in block " FMT_BB " because it is a SWITCH block\n", block->bbNum);
+        pollType = GCPOLL_CALL;
+    }
+    else if (block->HasFlag(BBF_COLD))
+    {
+        // We don't want to split a cold block.
+        //
+        JITDUMP("Selecting CALL poll in block " FMT_BB " because it is a cold block\n", block->bbNum);
+        pollType = GCPOLL_CALL;
+    }
+
+    return pollType;
+}
+
+//------------------------------------------------------------------------------
+// fgInsertLoopGCPolls : Insert GC polls on loop back edges whose source block
+//                       is not already a GC safe point.
+//
+// Notes:
+//    This lets the runtime suspend a thread running a call-free loop by just
+//    setting g_TrapReturningThreads, rather than hijacking it or injecting an
+//    activation. The method's interruptibility was decided in fgSetBlockOrder
+//    and is left as is, so injection keeps working when it is enabled.
+//
+//    Only optimized code is handled, since a poll in a minopts loop would be
+//    a helper call on every iteration.
+//
+// Returns:
+//    True if any polls were inserted.
+//
+bool Compiler::fgInsertLoopGCPolls()
+{
+    assert(opts.OptimizationEnabled());
+
+    FlowGraphDfsTree* const dfsTree = fgComputeDfs();
+    if (!dfsTree->HasCycle())
+    {
+        return false;
+    }
+
+    ArrayStack<BasicBlock*> backEdgeSources(getAllocator(CMK_ArrayStack));
+
+    for (unsigned i = 0; i < dfsTree->GetPostOrderCount(); i++)
+    {
+        BasicBlock* const block = dfsTree->GetPostOrder(i);
+
+        if (block->HasFlag(BBF_GC_SAFE_POINT) || !block->KindIs(BBJ_ALWAYS, BBJ_COND, BBJ_SWITCH))
         {
-            // We don't want to deal with all the outgoing edges of a switch block.
-            //
-            JITDUMP("Selecting CALL poll in block " FMT_BB " because it is a SWITCH block\n", block->bbNum);
-            pollType = GCPOLL_CALL;
+            continue;
         }
-        else if (block->HasFlag(BBF_COLD))
+
+        for (BasicBlock* const succ : block->Succs(this))
         {
-            // We don't want to split a cold block.
-            //
-            JITDUMP("Selecting CALL poll in block " FMT_BB " because it is a cold block\n", block->bbNum);
-            pollType = GCPOLL_CALL;
+            if (dfsTree->IsAncestor(succ, block))
+            {
+                backEdgeSources.Push(block);
+                break;
+            }
         }
-
-        BasicBlock* curBasicBlock = fgCreateGCPoll(pollType, block);
-        createdPollBlocks |= (block != curBasicBlock);
-        block = curBasicBlock;
     }
 
-    // We should never split blocks unless we're optimizing.
-    assert(!createdPollBlocks || opts.OptimizationEnabled());
+    for (int i = 0; i < backEdgeSources.Height(); i++)
+    {
+        BasicBlock* const block = backEdgeSources.Bottom(i);
+        JITDUMP("Inserting GC poll on back edge from " FMT_BB "\n", block->bbNum);
+        fgCreateGCPoll(fgSelectGCPollType(block), block);
+    }
 
-    return result;
+    return backEdgeSources.Height() > 0;
 }
 
 //------------------------------------------------------------------------------
@@ -295,7 +295,7 @@ void GenTree::InitNodeSize()
     static_assert_no_msg(sizeof(GenTreeLclFld)       <= TREE_NODE_SZ_SMALL);
     static_assert_no_msg(sizeof(GenTreeCC)           <= TREE_NODE_SZ_SMALL);
     static_assert_no_msg(sizeof(GenTreeOpCC)         <= TREE_NODE_SZ_SMALL);
-#ifdef TARGET_ARM64
+#if defined(TARGET_ARM64) || defined(TARGET_AMD64)
     static_assert_no_msg(sizeof(GenTreeCCMP)         <= TREE_NODE_SZ_SMALL);
 #endif
     static_assert_no_msg(sizeof(GenTreeConditional)  <= TREE_NODE_SZ_SMALL);
@@ -11905,11 +11905,16 @@ void Compiler::gtDispLclVarStructType(unsigned lclNum)
     }
 }
 
-#if defined(DEBUG) && defined(TARGET_ARM64)
+#if defined(DEBUG) && (defined(TARGET_ARM64) || defined(TARGET_AMD64))
 static const char* InsCflagsToString(insCflags flags)
 {
+#ifdef TARGET_ARM64
     const static char* s_table[16] = {"0", "v",  "c",  "cv",  "z",  "zv",  "zc",  "zcv",
                                       "n", "nv", "nc", "ncv", "nz", "nzv", "nzc", "nzcv"};
+#else
+    const static char* s_table[16] = {"0",  "c",  "z",  "zc",  "s",  "sc",  "sz",  "szc",
+                                      "o", "oc", "oz", "ozc", "os", "osc", "osz", "oszc"};
+#endif
     unsigned           index       = (unsigned)flags;
     assert((0 <= index) && (index < ArrLen(s_table)));
     return s_table[index];
@@ -12822,6 +12827,8 @@ void Compiler::gtDispTree(GenTree*                    tree,
         {
             printf(" cond=%s", tree->AsOpCC()->gtCondition.Name());
         }
+#endif
+#if defined(TARGET_ARM64) || defined(TARGET_AMD64)
         else if (tree->OperIs(GT_CCMP))
         {
             printf(" cond=%s flags=%s", tree->AsCCMP()->gtCondition.Name(),
@@ -19451,17 +19458,23 @@ CORINFO_CLASS_HANDLE Compiler::gtGetHelperCallClassHandle(GenTreeCall* call, boo
 // of ref types
 //
 // Arguments:
-//    array -- array to find handle for
+//    array         -- array to find handle for
+//    pIsArrayExact -- [optional, out] set to true if the array type is known exactly
 //
 // Return Value:
 //    nullptr if element class handle is unknown, otherwise the class handle.
 //
-CORINFO_CLASS_HANDLE Compiler::gtGetArrayElementClassHandle(GenTree* array)
+CORINFO_CLASS_HANDLE Compiler::gtGetArrayElementClassHandle(GenTree* array, bool* pIsArrayExact)
 {
     bool                 isArrayExact   = false;
     bool                 isArrayNonNull = false;
     CORINFO_CLASS_HANDLE arrayClassHnd  = gtGetClassHandle(array, &isArrayExact, &isArrayNonNull);
 
+    if (pIsArrayExact != nullptr)
+    {
+        *pIsArrayExact = isArrayExact;
+    }
+
     if (arrayClassHnd != nullptr)
     {
         // We know the class of the reference
@@ -31031,6 +31044,62 @@ bool GenTree::IsInvariant() const
     return OperIsConst() || OperIs(GT_LCL_ADDR) || OperIs(GT_FTN_ADDR);
 }
 
+//-------------------------------------------------------------------
+// IsRematerializableConstant: returns true if this node is a constant whose
+//    value codegen can recreate in a register instead of spilling it and
+//    reloading it from a spill temp.
+//
+// Returns:
+//     True if the constant can be rematerialized.
+//
+// Notes:
+//    The value is recreated at the point of the reload, so the sequence used
+//    must not need internal registers and must not clobber the flags.
+//
+//    LSRA and codegen both ask this, so the answer must not change between
+//    them; JitEnableConstantRemat=0 turns it off for the whole process.
+//
+bool GenTree::IsRematerializableConstant() const
+{
+#if defined(TARGET_XARCH) || defined(TARGET_ARM64)
+    if (JitConfig.JitEnableConstantRemat() == 0)
+    {
+        return false;
+    }
+
+    if (OperIs(GT_CNS_INT))
+    {
+        if (IsIconHandle(GTF_ICON_TLS_HDL, GTF_ICON_TLSGD_OFFSET, GTF_ICON_SECREL_OFFSET))
+        {
+            return false;
+        }
+
+#ifdef TARGET_XARCH
+        // Zero is materialized with "xor reg, reg", which clobbers the flags.
+        return AsIntCon()->IconValue() != 0;
+#else
+        return true;
+#endif
+    }
+
+#ifdef TARGET_XARCH
+    if (OperIs(GT_CNS_DBL))
+    {
+        return true;
+    }
+
+#ifdef FEATURE_SIMD
+    if (OperIs(GT_CNS_VEC))
+    {
+        return true;
+    }
+#endif // FEATURE_SIMD
+#endif // TARGET_XARCH
+#endif // TARGET_XARCH || TARGET_ARM64
+
+    return false;
+}
+
 //-------------------------------------------------------------------
 // IsVectorPerElementMask: returns true if this node is a vector constant per-element mask
 //                         (every element has either all bits set or none of them).
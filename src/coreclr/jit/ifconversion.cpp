@@ -41,9 +41,14 @@ private:
         GenTree*    node  = nullptr;
     };
 
-    GenTree*           m_cond;          // The condition in the conversion
-    IfConvertOperation m_thenOperation; // The single operation in the Then case.
-    IfConvertOperation m_elseOperation; // The single operation in the Else case.
+    // Max number of local stores to allow in each of the Then and Else cases.
+    static const int MAX_OPERATIONS = 3;
+
+    GenTree*           m_cond;                           // The condition in the conversion
+    IfConvertOperation m_thenOperations[MAX_OPERATIONS]; // The operations in the Then case.
+    IfConvertOperation m_elseOperations[MAX_OPERATIONS]; // The operations in the Else case.
+    int                m_thenOperationCount = 0;         // Number of operations in the Then case.
+    int                m_elseOperationCount = 0;         // Number of operations in the Else case.
 
     int m_checkLimit = 4; // Max number of chained blocks to allow in both the True and Else cases.
 
@@ -54,8 +59,10 @@ private:
     bool IfConvertCheckInnerBlockFlow(BasicBlock* block);
     bool IfConvertCheckThenFlow();
     void IfConvertFindFlow();
-    bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation);
+    bool IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperations, int* foundCount);
+    bool IfConvertCheckMultipleOperations();
     void IfConvertJoinStmts(BasicBlock* fromBlock);
+    int  IfConvertOperationCost(const IfConvertOperation& operation);
 
 #ifdef DEBUG
     void IfConvertDump();
@@ -208,19 +215,23 @@ void OptIfConversionDsc::IfConvertFindFlow()
 // IfConvertCheckStmts
 //
 // From the given block to the final block, check all the statements and nodes are
-// valid for an If conversion. Chain of blocks must contain only a single local
-// store and no other operations.
+// valid for an If conversion. Chain of blocks must contain either a single return
+// or up to MAX_OPERATIONS local stores, and no other operations.
 //
 // Arguments:
-//   fromBlock      - Block inside the if statement to start from (Either Then or Else path).
-//   foundOperation - Returns the found operation.
+//   fromBlock       - Block inside the if statement to start from (Either Then or Else path).
+//   foundOperations - Returns the found operations, in execution order.
+//   foundCount      - Returns the number of found operations.
 //
 // Returns:
-//   If everything is valid, then set foundOperation to the store and return true.
-//   Otherwise return false.
+//   If everything is valid, then set foundOperations to the stores (or return) and
+//   return true. Otherwise return false.
 //
-bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOperation* foundOperation)
+bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock*         fromBlock,
+                                             IfConvertOperation* foundOperations,
+                                             int*                foundCount)
 {
+    int  count = 0;
     bool found = false;
 
     for (BasicBlock* block = fromBlock; block != m_finalBlock; block = block->GetUniqueSucc())
@@ -235,8 +246,8 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
             {
                 case GT_STORE_LCL_VAR:
                 {
-                    // Only one per operation per block can be conditionally executed.
-                    if (found)
+                    // Only a bounded number of stores can be conditionally executed.
+                    if (count == MAX_OPERATIONS)
                     {
                         return false;
                     }
@@ -278,10 +289,11 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    found                 = true;
-                    foundOperation->block = block;
-                    foundOperation->stmt  = stmt;
-                    foundOperation->node  = tree;
+                    found                        = true;
+                    foundOperations[count].block = block;
+                    foundOperations[count].stmt  = stmt;
+                    foundOperations[count].node  = tree;
+                    count++;
                     break;
                 }
 
@@ -333,10 +345,11 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
                         return false;
                     }
 
-                    found                 = true;
-                    foundOperation->block = block;
-                    foundOperation->stmt  = stmt;
-                    foundOperation->node  = tree;
+                    found                        = true;
+                    foundOperations[count].block = block;
+                    foundOperations[count].stmt  = stmt;
+                    foundOperations[count].node  = tree;
+                    count++;
                     break;
                 }
 
@@ -350,9 +363,100 @@ bool OptIfConversionDsc::IfConvertCheckStmts(BasicBlock* fromBlock, IfConvertOpe
             }
         }
     }
+
+    *foundCount = count;
     return found;
 }
 
+//-----------------------------------------------------------------------------
+// IfConvertCheckMultipleOperations
+//
+// Check that a Then (and Else) case with more than one store can be converted
+// into a sequence of SELECTs on the same condition.
+//
+// Returns:
+//   True if each store can get its own copy of the condition.
+//
+// Notes:
+//   The condition is re-evaluated before each store, so it must be cheap to
+//   clone and must not read any of the stored locals. With an Else case, both
+//   cases must store the same locals in the same order, so that the stores can
+//   be paired up.
+//
+bool OptIfConversionDsc::IfConvertCheckMultipleOperations()
+{
+    assert(m_mainOper == GT_STORE_LCL_VAR);
+
+    if (m_doElseConversion && (m_thenOperationCount != m_elseOperationCount))
+    {
+        return false;
+    }
+
+    if ((m_cond->gtFlags & GTF_ORDER_SIDEEFF) != 0)
+    {
+        return false;
+    }
+
+    GenTree* const condOps[] = {m_cond->gtGetOp1(), m_cond->gtGetOp2()};
+    for (GenTree* const condOp : condOps)
+    {
+        if (condOp->IsInvariant())
+        {
+            continue;
+        }
+
+        if (!condOp->OperIs(GT_LCL_VAR))
+        {
+            return false;
+        }
+
+        for (int i = 0; i < m_thenOperationCount; i++)
+        {
+            if (m_thenOperations[i].node->AsLclVarCommon()->GetLclNum() == condOp->AsLclVarCommon()->GetLclNum())
+            {
+                return false;
+            }
+        }
+    }
+
+    if (m_doElseConversion)
+    {
+        for (int i = 0; i < m_thenOperationCount; i++)
+        {
+            if (m_thenOperations[i].node->AsLclVarCommon()->GetLclNum() !=
+                m_elseOperations[i].node->AsLclVarCommon()->GetLclNum())
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// IfConvertOperationCost
+//
+// Compute the cost of evaluating an operation unconditionally.
+//
+// Arguments:
+//   operation -- The store or return
+//
+// Returns:
+//   The execution cost of the value, plus a penalty for stores to locals that are
+//   unlikely to be enregistered.
+//
+int OptIfConversionDsc::IfConvertOperationCost(const IfConvertOperation& operation)
+{
+    if (m_mainOper == GT_STORE_LCL_VAR)
+    {
+        return operation.node->AsLclVar()->Data()->GetCostEx() + (m_comp->gtIsLikelyRegVar(operation.node) ? 0 : 2);
+    }
+
+    assert(m_mainOper == GT_RETURN);
+    return operation.node->AsOp()->GetReturnValue()->GetCostEx();
+}
+
 //-----------------------------------------------------------------------------
 // IfConvertJoinStmts
 //
@@ -572,30 +676,31 @@ bool OptIfConversionDsc::optIfConvert()
         return false;
     }
 
-    // Check the Then and Else blocks have a single operation each.
-    if (!IfConvertCheckStmts(m_startBlock->GetFalseTarget(), &m_thenOperation))
+    // Check the Then and Else blocks have a valid set of operations.
+    if (!IfConvertCheckStmts(m_startBlock->GetFalseTarget(), m_thenOperations, &m_thenOperationCount))
     {
         return false;
     }
-    assert(m_thenOperation.node->OperIs(GT_STORE_LCL_VAR, GT_RETURN));
+    assert(m_thenOperations[0].node->OperIs(GT_STORE_LCL_VAR, GT_RETURN));
     if (m_doElseConversion)
     {
-        if (!IfConvertCheckStmts(m_startBlock->GetTrueTarget(), &m_elseOperation))
+        if (!IfConvertCheckStmts(m_startBlock->GetTrueTarget(), m_elseOperations, &m_elseOperationCount))
         {
             return false;
         }
 
         // Both operations must be the same node type.
-        if (m_thenOperation.node->OperGet() != m_elseOperation.node->OperGet())
+        if (m_thenOperations[0].node->OperGet() != m_elseOperations[0].node->OperGet())
         {
             return false;
         }
 
         // Currently can only support Else Store Blocks that have the same destination as the Then block.
-        if (m_thenOperation.node->OperIs(GT_STORE_LCL_VAR))
+        if ((m_thenOperationCount == 1) && (m_elseOperationCount == 1) &&
+            m_thenOperations[0].node->OperIs(GT_STORE_LCL_VAR))
         {
-            unsigned lclNumThen = m_thenOperation.node->AsLclVarCommon()->GetLclNum();
-            unsigned lclNumElse = m_elseOperation.node->AsLclVarCommon()->GetLclNum();
+            unsigned lclNumThen = m_thenOperations[0].node->AsLclVarCommon()->GetLclNum();
+            unsigned lclNumElse = m_elseOperations[0].node->AsLclVarCommon()->GetLclNum();
             if (lclNumThen != lclNumElse)
             {
                 return false;
@@ -603,60 +708,77 @@ bool OptIfConversionDsc::optIfConvert()
         }
     }
 
+    if (((m_thenOperationCount > 1) || (m_elseOperationCount > 1)) && !IfConvertCheckMultipleOperations())
+    {
+        return false;
+    }
+
 #ifdef DEBUG
     if (m_comp->verbose)
     {
-        JITDUMP("\nConditionally executing " FMT_BB, m_thenOperation.block->bbNum);
+        JITDUMP("\nConditionally executing %d operation(s) from " FMT_BB, m_thenOperationCount,
+                m_thenOperations[0].block->bbNum);
         if (m_doElseConversion)
         {
-            JITDUMP(" and " FMT_BB, m_elseOperation.block->bbNum);
+            JITDUMP(" and " FMT_BB, m_elseOperations[0].block->bbNum);
         }
         JITDUMP(" inside " FMT_BB "\n", m_startBlock->bbNum);
         IfConvertDump();
     }
 #endif
 
+    // Use the branch likelihood to estimate how well the branch predicts. A SELECT
+    // pays for both sides and adds a data dependency, which is only worth it when
+    // the branch mispredicts often. Only measured profile data tells us that a
+    // branch is unpredictable; synthesized likelihoods are used only to detect
+    // strongly biased branches.
+    const weight_t trueLikelihood = m_startBlock->GetTrueEdge()->getLikelihood();
+    const bool     isBiased       = (trueLikelihood < 0.1) || (trueLikelihood > 0.9);
+    const bool     isUnpredictable =
+        m_comp->fgHaveTrustedProfileWeights() && (trueLikelihood >= 0.25) && (trueLikelihood <= 0.75);
+
     // Using SELECT nodes means that both Then and Else operations are fully evaluated.
     // Put a limit on the original source and destinations.
     if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_COST, 25))
     {
-        int thenCost = 0;
-        int elseCost = 0;
-
-        if (m_mainOper == GT_STORE_LCL_VAR)
+        if (isBiased)
         {
-            thenCost = m_thenOperation.node->AsLclVar()->Data()->GetCostEx() +
-                       (m_comp->gtIsLikelyRegVar(m_thenOperation.node) ? 0 : 2);
-            if (m_doElseConversion)
-            {
-                elseCost = m_elseOperation.node->AsLclVar()->Data()->GetCostEx() +
-                           (m_comp->gtIsLikelyRegVar(m_elseOperation.node) ? 0 : 2);
-            }
+            JITDUMP("Skipping if-conversion of biased branch (likelihood " FMT_WT ")\n", trueLikelihood);
+            return false;
         }
-        else
+
+        // Cost to allow for "x = cond ? a + b : c + d", and somewhat more when
+        // the branch is known to mispredict.
+        const int costLimit = isUnpredictable ? 10 : 7;
+
+        // Every operation is evaluated unconditionally, so they all share one budget.
+        // It is the same as the per-side limit for a single store, which keeps the
+        // single store case unchanged.
+        const int costBudget = m_doElseConversion ? (2 * costLimit) : costLimit;
+        int       totalCost  = 0;
+
+        for (int i = 0; i < m_thenOperationCount; i++)
         {
-            assert(m_mainOper == GT_RETURN);
-            thenCost = m_thenOperation.node->AsOp()->GetReturnValue()->GetCostEx();
-            if (m_doElseConversion)
+            int thenCost = IfConvertOperationCost(m_thenOperations[i]);
+            int elseCost = (i < m_elseOperationCount) ? IfConvertOperationCost(m_elseOperations[i]) : 0;
+            totalCost += thenCost + elseCost;
+
+            if (thenCost > costLimit || elseCost > costLimit || totalCost > costBudget)
             {
-                elseCost = m_elseOperation.node->AsOp()->GetReturnValue()->GetCostEx();
+                JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d (total %d)\n",
+                        thenCost, elseCost, totalCost);
+                return false;
             }
         }
-
-        // Cost to allow for "x = cond ? a + b : c + d".
-        if (thenCost > 7 || elseCost > 7)
-        {
-            JITDUMP("Skipping if-conversion that will evaluate RHS unconditionally at costs %d,%d\n", thenCost,
-                    elseCost);
-            return false;
-        }
     }
 
-    if (!m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_INNER_LOOPS, 25))
+    if (!isUnpredictable && !m_comp->compStressCompile(Compiler::STRESS_IF_CONVERSION_INNER_LOOPS, 25))
     {
         // Don't optimise the block if it is inside a loop. Loop-carried
         // dependencies can cause significant stalls if if-converted.
         // Detect via the block weight as that will be high when inside a loop.
+        // Branches that profile data shows to be unpredictable are still
+        // converted, as the cost of the mispredictions outweighs the stalls.
 
         if (m_startBlock->getBBWeight(m_comp) > BB_UNITY_WEIGHT * 1.05)
         {
@@ -672,71 +794,89 @@ bool OptIfConversionDsc::optIfConvert()
         }
     }
 
-    // Get the select node inputs.
-    var_types selectType;
-    GenTree*  selectTrueInput;
-    GenTree*  selectFalseInput;
-    if (m_mainOper == GT_STORE_LCL_VAR)
+    // Create a SELECT for each operation. Each one after the first gets its own
+    // copy of the condition.
+    for (int i = 0; i < m_thenOperationCount; i++)
     {
-        if (m_doElseConversion)
+        IfConvertOperation& thenOperation = m_thenOperations[i];
+        GenTree*            cond          = (i == 0) ? m_cond : m_comp->gtCloneExpr(m_cond);
+
+        // Get the select node inputs.
+        var_types selectType;
+        GenTree*  selectTrueInput;
+        GenTree*  selectFalseInput;
+        if (m_mainOper == GT_STORE_LCL_VAR)
         {
-            selectTrueInput  = m_elseOperation.node->AsLclVar()->Data();
-            selectFalseInput = m_thenOperation.node->AsLclVar()->Data();
+            if (m_doElseConversion)
+            {
+                selectTrueInput  = m_elseOperations[i].node->AsLclVar()->Data();
+                selectFalseInput = thenOperation.node->AsLclVar()->Data();
+            }
+            else // Duplicate the destination of the Then store.
+            {
+                GenTreeLclVar* store = thenOperation.node->AsLclVar();
+                selectTrueInput      = m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
+                selectFalseInput     = thenOperation.node->AsLclVar()->Data();
+            }
+
+            // Pick the type as the type of the local, which should always be compatible even for implicit
+            // coercions.
+            selectType = genActualType(thenOperation.node);
         }
-        else // Duplicate the destination of the Then store.
+        else
         {
-            GenTreeLclVar* store = m_thenOperation.node->AsLclVar();
-            selectTrueInput      = m_comp->gtNewLclVarNode(store->GetLclNum(), store->TypeGet());
-            selectFalseInput     = m_thenOperation.node->AsLclVar()->Data();
-        }
-
-        // Pick the type as the type of the local, which should always be compatible even for implicit coercions.
-        selectType = genActualType(m_thenOperation.node);
-    }
-    else
-    {
-        assert(m_mainOper == GT_RETURN);
-        assert(m_doElseConversion);
-        assert(m_thenOperation.node->TypeGet() == m_elseOperation.node->TypeGet());
+            assert(m_mainOper == GT_RETURN);
+            assert(m_doElseConversion);
+            assert(thenOperation.node->TypeGet() == m_elseOperations[i].node->TypeGet());
 
-        selectTrueInput  = m_elseOperation.node->AsOp()->GetReturnValue();
-        selectFalseInput = m_thenOperation.node->AsOp()->GetReturnValue();
-        selectType       = genActualType(m_thenOperation.node);
-    }
+            selectTrueInput  = m_elseOperations[i].node->AsOp()->GetReturnValue();
+            selectFalseInput = thenOperation.node->AsOp()->GetReturnValue();
+            selectType       = genActualType(thenOperation.node);
+        }
 
-    // Create a select node.
-    GenTreeConditional* select =
-        m_comp->gtNewConditionalNode(GT_SELECT, m_cond, selectTrueInput, selectFalseInput, selectType);
-    m_thenOperation.node->AddAllEffectsFlags(select);
+        // Create a select node.
+        GenTreeConditional* select =
+            m_comp->gtNewConditionalNode(GT_SELECT, cond, selectTrueInput, selectFalseInput, selectType);
+        thenOperation.node->AddAllEffectsFlags(select);
 
-    // Use the select as the source of the Then operation.
-    if (m_mainOper == GT_STORE_LCL_VAR)
-    {
-        m_thenOperation.node->AsLclVar()->Data() = select;
-    }
-    else
-    {
-        m_thenOperation.node->AsOp()->SetReturnValue(select);
+        // Use the select as the source of the Then operation.
+        if (m_mainOper == GT_STORE_LCL_VAR)
+        {
+            thenOperation.node->AsLclVar()->Data() = select;
+        }
+        else
+        {
+            thenOperation.node->AsOp()->SetReturnValue(select);
+        }
+        m_comp->gtSetEvalOrder(thenOperation.node);
+        m_comp->fgSetStmtSeq(thenOperation.stmt);
     }
-    m_comp->gtSetEvalOrder(m_thenOperation.node);
-    m_comp->fgSetStmtSeq(m_thenOperation.stmt);
 
     // Remove statements.
     last->gtBashToNOP();
     m_comp->gtSetEvalOrder(last);
     m_comp->fgSetStmtSeq(m_startBlock->lastStmt());
-    if (m_doElseConversion)
+    for (int i = 0; i < m_elseOperationCount; i++)
     {
-        m_elseOperation.node->gtBashToNOP();
-        m_comp->gtSetEvalOrder(m_elseOperation.node);
-        m_comp->fgSetStmtSeq(m_elseOperation.stmt);
+        m_elseOperations[i].node->gtBashToNOP();
+        m_comp->gtSetEvalOrder(m_elseOperations[i].node);
+        m_comp->fgSetStmtSeq(m_elseOperations[i].stmt);
     }
 
-    // Merge all the blocks.
-    IfConvertJoinStmts(m_thenOperation.block);
-    if (m_doElseConversion)
+    // Merge all the blocks holding operations.
+    for (int i = 0; i < m_thenOperationCount; i++)
     {
-        IfConvertJoinStmts(m_elseOperation.block);
+        if ((i == 0) || (m_thenOperations[i].block != m_thenOperations[i - 1].block))
+        {
+            IfConvertJoinStmts(m_thenOperations[i].block);
+        }
+    }
+    for (int i = 0; i < m_elseOperationCount; i++)
+    {
+        if ((i == 0) || (m_elseOperations[i].block != m_elseOperations[i - 1].block))
+        {
+            IfConvertJoinStmts(m_elseOperations[i].block);
+        }
     }
 
     // Update the flow from the original block.
@@ -3894,10 +3894,9 @@ GenTree* Compiler::impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORI
                 {
                     if (buffer[i] != 0)
                     {
-                        // Value is not all zeroes - bail out.
-                        // Although, We might eventually support that too.
-                        JITDUMP("value is not all zeros - bail out.");
-                        return nullptr;
+                        // Value is not all zeroes - see if we can initialize a temp field by field.
+                        JITDUMP("value is not all zeros ...");
+                        return impImportStaticReadOnlyStructFields(fieldClsHnd, buffer, totalSize);
                     }
                 }
 
@@ -3962,6 +3961,98 @@ GenTree* Compiler::impImportStaticReadOnlyField(CORINFO_FIELD_HANDLE field, CORI
     return nullptr;
 }
 
+//------------------------------------------------------------------------
+// impImportStaticReadOnlyStructFields: Import the content of a 'static readonly'
+//    struct field as a temp initialized with one constant per field.
+//
+// Arguments:
+//    fieldClsHnd - class handle of the struct
+//    buffer      - the struct's content
+//    totalSize   - size of the struct, in bytes
+//
+// Return Value:
+//    The tree representing the initialized temp, or nullptr if the struct's
+//    layout is not supported.
+//
+// Notes:
+//    Only structs with up to MAX_NumOfFieldsInPromotableStruct primitive fields
+//    that do not overlap and cover every byte of the struct are handled, so the
+//    temp stays promotable and the field values can be propagated from it.
+//
+GenTree* Compiler::impImportStaticReadOnlyStructFields(CORINFO_CLASS_HANDLE fieldClsHnd,
+                                                       uint8_t*             buffer,
+                                                       unsigned             totalSize)
+{
+    const unsigned fieldsCnt = info.compCompHnd->getClassNumInstanceFields(fieldClsHnd);
+    if ((fieldsCnt == 0) || (fieldsCnt > MAX_NumOfFieldsInPromotableStruct))
+    {
+        JITDUMP("struct has too many fields - bail out.");
+        return nullptr;
+    }
+
+    var_types fieldTypes[MAX_NumOfFieldsInPromotableStruct];
+    unsigned  fieldOffsets[MAX_NumOfFieldsInPromotableStruct];
+    unsigned  coveredSize = 0;
+
+    for (unsigned i = 0; i < fieldsCnt; i++)
+    {
+        CORINFO_FIELD_HANDLE innerField = info.compCompHnd->getFieldInClass(fieldClsHnd, i);
+        CORINFO_CLASS_HANDLE innerFieldClsHnd;
+        CorInfoType          innerFieldType = info.compCompHnd->getFieldType(innerField, &innerFieldClsHnd, fieldClsHnd);
+
+        fieldTypes[i]   = JITtype2varType(innerFieldType);
+        fieldOffsets[i] = info.compCompHnd->getFieldOffset(innerField);
+
+        if (!varTypeIsIntegral(fieldTypes[i]) && !varTypeIsFloating(fieldTypes[i]))
+        {
+            JITDUMP("struct has non-primitive fields - bail out.");
+            return nullptr;
+        }
+
+        const unsigned fieldEnd = fieldOffsets[i] + genTypeSize(fieldTypes[i]);
+        if (fieldEnd > totalSize)
+        {
+            JITDUMP("struct has complex layout - bail out.");
+            return nullptr;
+        }
+
+        for (unsigned j = 0; j < i; j++)
+        {
+            if ((fieldOffsets[i] < fieldOffsets[j] + genTypeSize(fieldTypes[j])) && (fieldOffsets[j] < fieldEnd))
+            {
+                JITDUMP("struct has overlapping fields - bail out.");
+                return nullptr;
+            }
+        }
+
+        coveredSize += genTypeSize(fieldTypes[i]);
+    }
+
+    if (coveredSize != totalSize)
+    {
+        // Padding would be left uninitialized in the temp
+        JITDUMP("struct has padding - bail out.");
+        return nullptr;
+    }
+
+    unsigned structTempNum = lvaGrabTemp(true DEBUGARG("folding static readonly field struct"));
+    lvaSetStruct(structTempNum, fieldClsHnd, false);
+
+    for (unsigned i = 0; i < fieldsCnt; i++)
+    {
+        GenTree* constValTree = gtNewGenericCon(fieldTypes[i], buffer + fieldOffsets[i]);
+        assert(constValTree != nullptr);
+
+        GenTree* fieldStoreTree = gtNewStoreLclFldNode(structTempNum, fieldTypes[i], fieldOffsets[i], constValTree);
+        impAppendTree(fieldStoreTree, CHECK_SPILL_NONE, impCurStmtDI);
+    }
+
+    JITDUMP("Folding 'static readonly %s' field to %u STORE_LCL_FLD(CNS) nodes\n", eeGetClassName(fieldClsHnd),
+            fieldsCnt);
+
+    return impCreateLocalNode(structTempNum DEBUGARG(0));
+}
+
 //------------------------------------------------------------------------
 // impImportStaticFieldAddress: Generate an address of a static field
 //
@@ -7112,8 +7203,6 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                 lclTyp       = JITtype2varType(info.compCompHnd->asCorInfoType(ldelemClsHnd));
 
                 // If it's a value class / pointer array, or a readonly access, we don't need a type check.
-                // TODO-CQ: adapt "gtCanSkipCovariantStoreCheck" to handle "ldelema"s and call it here to
-                // skip using the helper in more cases.
                 if ((lclTyp != TYP_REF) || ((prefixFlags & PREFIX_READONLY) != 0))
                 {
                     goto ARR_LD;
@@ -7127,11 +7216,28 @@ void Compiler::impImportBlockCode(BasicBlock* block)
                     return;
                 }
 
-                if (opts.OptimizationEnabled() && (gtGetArrayElementClassHandle(impStackTop(1).val) == ldelemClsHnd) &&
-                    info.compCompHnd->isExactType(ldelemClsHnd))
+                // The helper checks that the array's element type is exactly the requested one,
+                // which is known at compile time if either the array type or the element type is exact.
+                if (opts.OptimizationEnabled())
                 {
-                    JITDUMP("\nldelema of T[] with T exact: skipping covariant check\n");
-                    goto ARR_LD;
+                    bool                       isArrayExact = false;
+                    const CORINFO_CLASS_HANDLE arrayElemClsHnd =
+                        gtGetArrayElementClassHandle(impStackTop(1).val, &isArrayExact);
+
+                    if (arrayElemClsHnd == ldelemClsHnd)
+                    {
+                        if (info.compCompHnd->isExactType(ldelemClsHnd))
+                        {
+                            JITDUMP("\nldelema of T[] with T exact: skipping covariant check\n");
+                            goto ARR_LD;
+                        }
+
+                        if (isArrayExact)
+                        {
+                            JITDUMP("\nldelema of (exact) T[]: skipping covariant check\n");
+                            goto ARR_LD;
+                        }
+                    }
                 }
 
                 GenTree* index = impPopStack().val;
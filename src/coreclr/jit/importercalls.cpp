@@ -973,8 +973,15 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
         }
         else if (call->AsCall()->IsDelegateInvoke())
         {
-            considerGuardedDevirtualization(call->AsCall(), rawILOffset, false, NO_METHOD_HANDLE, NO_CLASS_HANDLE,
-                                            nullptr);
+            if (impDevirtualizeKnownDelegateInvoke(call->AsCall(), callInfo, &exactContextHnd))
+            {
+                methHnd = callInfo->hMethod;
+            }
+            else
+            {
+                considerGuardedDevirtualization(call->AsCall(), rawILOffset, false, NO_METHOD_HANDLE,
+                                                NO_CLASS_HANDLE, nullptr);
+            }
         }
     }
 
@@ -1008,6 +1015,8 @@ var_types Compiler::impImportCall(OPCODE                  opcode,
                 {
                     return TYP_UNDEF;
                 }
+
+                impNoteDelegateTarget(call->AsCall(), newobjThis, ldftnInfo);
             }
 
             if (!bIntrinsicImported)
@@ -3483,6 +3492,13 @@ GenTree* Compiler::impIntrinsic(CORINFO_CLASS_HANDLE    clsHnd,
                 break;
             }
 
+            case NI_System_String_Contains:
+            case NI_System_MemoryExtensions_Contains:
+            {
+                retNode = impUtf16ConstantContains(sig, methodFlags);
+                break;
+            }
+
             case NI_System_MemoryExtensions_AsSpan:
             case NI_System_String_op_Implicit:
             {
@@ -7289,6 +7305,151 @@ void Compiler::considerGuardedDevirtualization(GenTreeCall*            call,
     }
 }
 
+//------------------------------------------------------------------------
+// impNoteDelegateTarget: remember the target of a newly constructed delegate
+//
+// Arguments:
+//    ctorCall   - the (possibly optimized) delegate constructor call
+//    newobjThis - the "this" for the constructor, a temp holding the new delegate
+//    ldftnInfo  - the method pointer info for the target, if known
+//
+// Notes:
+//    Only delegates created via "ldftn" over an instance method are noted, as
+//    for those the invoked method and the target object are known exactly.
+//    Each store to the newobj temp constructs a delegate with the same target
+//    method, so invokes through that temp can later be devirtualized by
+//    impDevirtualizeKnownDelegateInvoke.
+//
+void Compiler::impNoteDelegateTarget(GenTreeCall* ctorCall, GenTree* newobjThis, methodPointerInfo* ldftnInfo)
+{
+    if ((ldftnInfo == nullptr) || !opts.OptimizationEnabled() || opts.IsReadyToRun() ||
+        (JitConfig.JitDevirtualizeKnownDelegates() == 0))
+    {
+        return;
+    }
+
+    if ((ctorCall->gtCallType != CT_USER_FUNC) || (ctorCall->gtArgs.CountArgs() < 3) ||
+        !ctorCall->gtArgs.GetArgByIndex(2)->GetNode()->OperIs(GT_FTN_ADDR))
+    {
+        // We either do not know the constructor or the target came from ldvirtftn.
+        return;
+    }
+
+    if (newobjThis->OperIs(GT_COMMA))
+    {
+        newobjThis = newobjThis->AsOp()->gtOp2;
+    }
+
+    if (!newobjThis->OperIs(GT_LCL_VAR))
+    {
+        return;
+    }
+
+    const unsigned              lclNum     = newobjThis->AsLclVarCommon()->GetLclNum();
+    const CORINFO_METHOD_HANDLE targetHnd  = ldftnInfo->m_token.hMethod;
+    LclNumToMethodMap* const    targetMap  = getImpDelegateTargetMap();
+    CORINFO_METHOD_HANDLE       currentHnd = NO_METHOD_HANDLE;
+
+    if (targetMap->Lookup(lclNum, &currentHnd) && (currentHnd != targetHnd))
+    {
+        // Temp is shared by delegates with different targets; give up on it.
+        targetMap->Set(lclNum, NO_METHOD_HANDLE, LclNumToMethodMap::Overwrite);
+        return;
+    }
+
+    JITDUMP("Delegate in V%02u has known target %s\n", lclNum, eeGetMethodFullName(targetHnd));
+    targetMap->Set(lclNum, targetHnd, LclNumToMethodMap::Overwrite);
+}
+
+//------------------------------------------------------------------------
+// impDevirtualizeKnownDelegateInvoke: devirtualize a delegate invoke whose
+//    delegate was constructed in this method (or an inlinee) with a known target
+//
+// Arguments:
+//    call               - a delegate invoke call
+//    callInfo           - [in/out] call info, updated for the new target on success
+//    exactContextHandle - [out] updated context handle on success
+//
+// Returns:
+//    true if the call was turned into a direct call to the delegate target.
+//
+// Notes:
+//    The direct call passes the delegate's target object as "this". Once it
+//    is inlined, a closure object that no longer escapes through the delegate
+//    call can be stack allocated and promoted.
+//
+bool Compiler::impDevirtualizeKnownDelegateInvoke(GenTreeCall*            call,
+                                                  CORINFO_CALL_INFO*      callInfo,
+                                                  CORINFO_CONTEXT_HANDLE* exactContextHandle)
+{
+    assert(call->IsDelegateInvoke());
+
+    if ((impInlineRoot()->impDelegateTargetMap == nullptr) ||
+        ((call->gtCallMoreFlags & GTF_CALL_M_WRAPPER_DELEGATE_INV) != 0))
+    {
+        return false;
+    }
+
+    CallArg* const thisArg     = call->gtArgs.GetThisArg();
+    GenTree* const delegateObj = thisArg->GetNode();
+    if (!delegateObj->OperIs(GT_LCL_VAR))
+    {
+        return false;
+    }
+
+    CORINFO_METHOD_HANDLE targetHnd = NO_METHOD_HANDLE;
+    if (!getImpDelegateTargetMap()->Lookup(delegateObj->AsLclVarCommon()->GetLclNum(), &targetHnd) ||
+        (targetHnd == NO_METHOD_HANDLE))
+    {
+        return false;
+    }
+
+    const unsigned targetAttribs = info.compCompHnd->getMethodAttribs(targetHnd);
+    if ((targetAttribs & CORINFO_FLG_STATIC) != 0)
+    {
+        JITDUMP("Known delegate target is static, not devirtualizing\n");
+        return false;
+    }
+
+    CORINFO_CLASS_HANDLE targetClass = info.compCompHnd->getMethodClass(targetHnd);
+    if ((info.compCompHnd->getClassAttribs(targetClass) & CORINFO_FLG_VALUECLASS) != 0)
+    {
+        JITDUMP("Known delegate target is on a value class, not devirtualizing\n");
+        return false;
+    }
+
+    CORINFO_SIG_INFO targetSig;
+    info.compCompHnd->getMethodSig(targetHnd, &targetSig);
+    if (targetSig.hasTypeArg() || !isCompatibleMethodGDV(call, targetHnd))
+    {
+        JITDUMP("Known delegate target needs a generic context or is incompatible, not devirtualizing\n");
+        return false;
+    }
+
+    JITDUMP("Devirtualizing delegate invoke [%06u] to known target %s\n", dspTreeID(call),
+            eeGetMethodFullName(targetHnd));
+
+    // The delegate was just constructed, so it is non-null and loading its
+    // target object cannot fault.
+    GenTree* offset  = gtNewIconNode((ssize_t)eeGetEEInfo()->offsetOfDelegateInstance, TYP_I_IMPL);
+    GenTree* newThis = gtNewOperNode(GT_ADD, TYP_BYREF, delegateObj, offset);
+    newThis          = gtNewIndir(TYP_REF, newThis, GTF_IND_NONFAULTING);
+    thisArg->SetEarlyNode(newThis);
+
+    call->gtFlags &= ~GTF_CALL_VIRT_KIND_MASK;
+    call->gtCallMethHnd = targetHnd;
+    call->gtCallType    = CT_USER_FUNC;
+    call->gtCallMoreFlags &= ~GTF_CALL_M_DELEGATE_INV;
+    INDEBUG(call->gtCallDebugFlags |= GTF_CALL_MD_DEVIRTUALIZED);
+
+    callInfo->hMethod       = targetHnd;
+    callInfo->methodFlags   = targetAttribs;
+    callInfo->contextHandle = MAKE_METHODCONTEXT(targetHnd);
+    *exactContextHandle     = callInfo->contextHandle;
+
+    return true;
+}
+
 //------------------------------------------------------------------------
 // addGuardedDevirtualizationCandidate: potentially mark the call as a guarded
 //    devirtualization candidate
@@ -10382,6 +10543,10 @@ NamedIntrinsic Compiler::lookupNamedIntrinsic(CORINFO_METHOD_HANDLE method)
                         {
                             result = NI_System_MemoryExtensions_EndsWith;
                         }
+                        else if (strcmp(methodName, "Contains") == 0)
+                        {
+                            result = NI_System_MemoryExtensions_Contains;
+                        }
                     }
                     break;
                 }
@@ -10498,6 +10663,10 @@ NamedIntrinsic Compiler::lookupNamedIntrinsic(CORINFO_METHOD_HANDLE method)
                         {
                             result = NI_System_String_EndsWith;
                         }
+                        else if (strcmp(methodName, "Contains") == 0)
+                        {
+                            result = NI_System_String_Contains;
+                        }
                     }
                     else if (strcmp(className, "SZArrayHelper") == 0)
                     {
@@ -29,6 +29,9 @@
 //   11) MemoryExtensions.EndsWith<char>(ROS<char>, ROS<char>)
 //   12) MemoryExtensions.EndsWith(ROS<char>, ROS<char>, Ordinal or OrdinalIgnoreCase)
 //
+//   13) "cns".Contains(char)
+//   14) MemoryExtensions.Contains<char>(ROS<char>, char)
+//
 // When one of the arguments is a constant string of a [0..32] size so we can inline
 // a vectorized comparison against it using SWAR or SIMD techniques (e.g. via two V256 vectors)
 //
@@ -710,3 +713,115 @@ GenTree* Compiler::impUtf16SpanComparison(StringComparisonKind kind, CORINFO_SIG
     }
     return unrolled;
 }
+
+//------------------------------------------------------------------------
+// impUtf16ConstantContains: Expand a search for a char in a short constant
+//    string into a set of comparisons:
+//    1) "cns".Contains(ch)
+//    2) MemoryExtensions.Contains<char>("cns", ch)
+//
+//    e.g. "\r\n".Contains(ch) becomes (ch == '\r') | (ch == '\n')
+//
+// Arguments:
+//    sig         - signature of the Contains method
+//    methodFlags - its flags
+//
+// Returns:
+//    GenTree representing the comparisons or nullptr
+//
+GenTree* Compiler::impUtf16ConstantContains(CORINFO_SIG_INFO* sig, unsigned methodFlags)
+{
+    const bool isStatic  = methodFlags & CORINFO_FLG_STATIC;
+    const int  argsCount = sig->numArgs + (isStatic ? 0 : 1);
+
+    // Max number of distinct chars to compare against
+    const int maxNeedleChecks = 8;
+
+    // Skip overloads taking a StringComparison
+    if (argsCount != 2)
+    {
+        return nullptr;
+    }
+
+    // For the generic Contains we need to make sure T is char
+    if (sig->sigInst.methInstCount != 0)
+    {
+        assert(sig->sigInst.methInstCount == 1);
+        CORINFO_CLASS_HANDLE targetElemHnd = sig->sigInst.methInst[0];
+        CorInfoType          typ           = info.compCompHnd->getTypeForPrimitiveValueClass(targetElemHnd);
+        if ((typ != CORINFO_TYPE_SHORT) && (typ != CORINFO_TYPE_USHORT) && (typ != CORINFO_TYPE_CHAR))
+        {
+            return nullptr;
+        }
+    }
+
+    GenTree* haystack = impStackTop(1).val;
+    GenTree* needle   = impStackTop(0).val;
+
+    // Skip the Contains(string) overload
+    if (!varTypeIsIntegral(needle))
+    {
+        return nullptr;
+    }
+
+    GenTreeStrCon* cnsStr = haystack->OperIs(GT_CNS_STR) ? haystack->AsStrCon() : impGetStrConFromSpan(haystack);
+    if ((cnsStr == nullptr) || cnsStr->IsStringEmptyField())
+    {
+        return nullptr;
+    }
+
+    char16_t  str[MaxPossibleUnrollSize];
+    const int cnsLength =
+        info.compCompHnd->getStringLiteral(cnsStr->gtScpHnd, cnsStr->gtSconCPX, str, MaxPossibleUnrollSize);
+    if ((cnsLength <= 0) || (cnsLength > maxNeedleChecks))
+    {
+        return nullptr;
+    }
+
+    JITDUMP("Expanding Contains(\"%s\", ch) into comparisons\n", convertUtf16ToUtf8ForPrinting((WCHAR*)str));
+
+    for (int i = 0; i < argsCount; i++)
+    {
+        impPopStack();
+    }
+
+    // We have to clean up GT_RET_EXPR for String.op_Implicit or MemoryExtensions.AsSpan
+    if (haystack->OperIs(GT_RET_EXPR))
+    {
+        GenTree* inlineCandidate = haystack->AsRetExpr()->gtInlineCandidate;
+        assert(inlineCandidate->IsCall());
+        inlineCandidate->gtBashToNOP();
+    }
+
+    // The needle is used once per comparison
+    if (!needle->OperIs(GT_LCL_VAR) && !needle->IsIntegralConst())
+    {
+        unsigned needleTmp = lvaGrabTemp(true DEBUGARG("Contains needle"));
+        impStoreToTemp(needleTmp, needle, CHECK_SPILL_ALL);
+        needle = gtNewLclvNode(needleTmp, genActualType(needle));
+    }
+
+    GenTree* result = nullptr;
+    for (int i = 0; i < cnsLength; i++)
+    {
+        bool isDuplicate = false;
+        for (int j = 0; j < i; j++)
+        {
+            isDuplicate |= (str[j] == str[i]);
+        }
+
+        if (isDuplicate)
+        {
+            continue;
+        }
+
+        GenTree* needleUse = (result == nullptr) ? needle : gtCloneExpr(needle);
+        GenTree* cmp       = gtNewOperNode(GT_EQ, TYP_INT, needleUse, gtNewIconNode(str[i]));
+        result             = (result == nullptr) ? cmp : gtNewOperNode(GT_OR, TYP_INT, result, cmp);
+    }
+
+    JITDUMP("... Successfully expanded to:\n")
+    DISPTREE(result)
+
+    return result;
+}
@@ -2673,6 +2673,190 @@ bool StrengthReductionContext::InsertionPointPostDominatesUses(BasicBlock*
     return true;
 }
 
+//------------------------------------------------------------------------
+// optRecognizeFillLoop: Recognize a loop whose only effect is to fill
+// consecutive memory with a constant and replace it by a call to the
+// vectorized memset/memzero helper in the preheader.
+//
+// Parameters:
+//   scevContext - Context for scalar evolution
+//   loop        - The loop
+//   loopLocals  - Locals of the loop
+//
+// Returns:
+//   True if the loop was replaced.
+//
+// Remarks:
+//   The recognized shape is a single block, bottom tested counted loop
+//   containing only IV updates, one store of a constant with a uniform byte
+//   pattern through an address that is an add recurrence stepping by the
+//   size of the store, and the exit test. For example:
+//
+//     for (int i = 0; i < n; i++) a[i] = 0;
+//
+//   Since the header is entered at least once from the preheader, the store
+//   runs (backedge count + 1) times. The fill is hoisted into the preheader
+//   and the exit test is folded so that the block executes exactly once.
+//
+bool Compiler::optRecognizeFillLoop(ScalarEvolutionContext& scevContext,
+                                    FlowGraphNaturalLoop*   loop,
+                                    LoopLocalOccurrences*   loopLocals)
+{
+#ifdef TARGET_64BIT
+    if (JitConfig.JitEnableFillLoopRecognition() == 0)
+    {
+        return false;
+    }
+
+    if (loop->NumLoopBlocks() != 1)
+    {
+        return false;
+    }
+
+    BasicBlock* header    = loop->GetHeader();
+    BasicBlock* preheader = loop->GetPreheader();
+    if (!header->KindIs(BBJ_COND) || !BasicBlock::sameEHRegion(preheader, header))
+    {
+        return false;
+    }
+
+    JITDUMP("  Checking if " FMT_LP " is a fill loop\n", loop->GetIndex());
+
+    Statement* fillStmt  = nullptr;
+    Statement* jtrueStmt = header->lastStmt();
+    for (Statement* stmt : header->Statements())
+    {
+        GenTree* root = stmt->GetRootNode();
+        if (root->OperIsLocalStore())
+        {
+            GenTreeLclVarCommon* lclStore = root->AsLclVarCommon();
+            if (!stmt->IsPhiDefnStmt() && ((lclStore->Data()->gtFlags & (GTF_SIDE_EFFECT | GTF_GLOB_REF)) != 0))
+            {
+                JITDUMP("    " FMT_STMT " has side effects or reads memory\n", stmt->GetID());
+                return false;
+            }
+
+            if (optLocalHasNonLoopUses(lclStore->GetLclNum(), loop, loopLocals))
+            {
+                JITDUMP("    V%02u is used outside the loop\n", lclStore->GetLclNum());
+                return false;
+            }
+
+            continue;
+        }
+
+        if (stmt == jtrueStmt)
+        {
+            assert(root->OperIs(GT_JTRUE));
+            if ((root->gtGetOp1()->gtFlags & (GTF_SIDE_EFFECT | GTF_GLOB_REF)) != 0)
+            {
+                JITDUMP("    Exit test has side effects or reads memory\n");
+                return false;
+            }
+
+            continue;
+        }
+
+        if ((fillStmt != nullptr) || !root->OperIs(GT_STOREIND))
+        {
+            JITDUMP("    " FMT_STMT " is not a fill candidate\n", stmt->GetID());
+            return false;
+        }
+
+        fillStmt = stmt;
+    }
+
+    if (fillStmt == nullptr)
+    {
+        return false;
+    }
+
+    GenTreeStoreInd* store = fillStmt->GetRootNode()->AsStoreInd();
+    var_types        type  = store->TypeGet();
+    if (!varTypeIsIntegral(type) || store->IsVolatile() || !store->Data()->IsCnsIntOrI() ||
+        ((store->Addr()->gtFlags & (GTF_SIDE_EFFECT | GTF_GLOB_REF)) != 0))
+    {
+        JITDUMP("    Store is not a non-volatile store of an integral constant\n");
+        return false;
+    }
+
+    // The helpers fill bytes, so the stored value must be a repeated byte.
+    unsigned size = genTypeSize(type);
+    uint64_t mask = (size == 8) ? UINT64_MAX : ((uint64_t(1) << (size * 8)) - 1);
+    uint64_t bits = uint64_t(store->Data()->AsIntConCommon()->IntegralValue()) & mask;
+    uint8_t  fill = uint8_t(bits);
+    if (bits != (fill * (UINT64_C(0x0101010101010101) & mask)))
+    {
+        JITDUMP("    Stored value 0x%llx is not a repeated byte\n", (unsigned long long)bits);
+        return false;
+    }
+
+    Scev* addr = scevContext.Analyze(header, store->Addr());
+    if (addr != nullptr)
+    {
+        addr = scevContext.Simplify(addr);
+    }
+
+    int64_t step;
+    if ((addr == nullptr) || !addr->OperIs(ScevOper::AddRec) ||
+        !((ScevAddRec*)addr)->Step->GetConstantValue(this, &step) || (step != (int64_t)size))
+    {
+        JITDUMP("    Store address is not a unit stride add recurrence\n");
+        return false;
+    }
+
+    Scev* backedgeCount = scevContext.ComputeExitNotTakenCount(header);
+    if (backedgeCount == nullptr)
+    {
+        JITDUMP("    Could not compute backedge count -- not a counted loop\n");
+        return false;
+    }
+
+    // Backedge counts wrap, so widen them as unsigned before forming the
+    // trip count.
+    if (backedgeCount->TypeIs(TYP_INT))
+    {
+        backedgeCount = scevContext.NewExtension(ScevOper::ZeroExtend, TYP_LONG, backedgeCount);
+    }
+
+    Scev* tripCount = scevContext.NewBinop(ScevOper::Add, backedgeCount, scevContext.NewConstant(TYP_LONG, 1));
+    Scev* byteCount =
+        scevContext.Simplify(scevContext.NewBinop(ScevOper::Mul, tripCount, scevContext.NewConstant(TYP_LONG, size)));
+
+    GenTree* dst = scevContext.Materialize(((ScevAddRec*)addr)->Start);
+    GenTree* len = scevContext.Materialize(byteCount);
+    if ((dst == nullptr) || (len == nullptr))
+    {
+        JITDUMP("    Could not materialize destination or length into IR\n");
+        return false;
+    }
+
+    JITDUMP("  Replacing fill loop " FMT_LP " by a call to %s\n", loop->GetIndex(), fill == 0 ? "memzero" : "memset");
+
+    GenTreeCall* call = (fill == 0) ? gtNewHelperCallNode(CORINFO_HELP_MEMZERO, TYP_VOID, dst, len)
+                                    : gtNewHelperCallNode(CORINFO_HELP_MEMSET, TYP_VOID, dst, gtNewIconNode(fill), len);
+    Statement* callStmt = fgNewStmtFromTree(call);
+    fgInsertStmtNearEnd(preheader, callStmt);
+    fgMorphBlockStmt(preheader, callStmt DEBUGARG(__FUNCTION__), /* invalidateDFSTreeOnFGChange */ false);
+
+    JITDUMP("  Inserted fill in preheader " FMT_BB ":\n", preheader->bbNum);
+    DISPSTMT(callStmt);
+
+    fgRemoveStmt(header, fillStmt);
+
+    // The remaining statements only update locals that are dead after the
+    // loop, so exit after the first iteration.
+    GenTree* cond = jtrueStmt->GetRootNode()->gtGetOp1();
+    cond->BashToConst(loop->ContainsBlock(header->GetTrueTarget()) ? 0 : 1);
+    fgMorphBlockStmt(header, jtrueStmt DEBUGARG(__FUNCTION__), /* invalidateDFSTreeOnFGChange */ false);
+
+    loopLocals->Invalidate(loop);
+    return true;
+#else
+    return false;
+#endif
+}
+
 //------------------------------------------------------------------------
 // optRemoveUnusedIVs: Remove IVs that are only used for self-updates.
 //
@@ -2830,6 +3014,14 @@ PhaseStatus Compiler::optInductionVariables()
             continue;
         }
 
+        if (optRecognizeFillLoop(scevContext, loop, &loopLocals))
+        {
+            // The loop no longer iterates; nothing else to do for it.
+            Metrics.FillLoopsRecognized++;
+            changed = true;
+            continue;
+        }
+
         StrengthReductionContext strengthReductionContext(this, scevContext, loop, loopLocals);
         if (strengthReductionContext.TryStrengthReduce())
         {
@@ -1455,6 +1455,11 @@ void ExtendedDefaultPolicy::NoteInt(InlineObservation obs, int value)
             }
             break;
         }
+        case InlineObservation::CALLSITE_WEIGHT:
+        {
+            m_CallsiteWeight = (value > 0) ? static_cast<unsigned>(value) : 0;
+            break;
+        }
         default:
             DefaultPolicy::NoteInt(obs, value);
             break;
@@ -1826,6 +1831,17 @@ double ExtendedDefaultPolicy::DetermineMultiplier()
             multiplier *= min(m_ProfileFrequency, 1.0) * profileScale;
         }
         JITDUMP("\nCallsite has profile data: %g.  Multiplier limited to %g.", m_ProfileFrequency, multiplier);
+
+        // The profile frequency is relative to the caller's entry, the call site weight tells
+        // how hot the call edge is for the whole process. Only dynamic PGO counts reflect this
+        // process, static profiles are scaled and collected elsewhere.
+        const unsigned hotCallCount = (unsigned)JitConfig.JitExtDefaultPolicyHotCallCount();
+        if ((hotCallCount > 0) && m_RootCompiler->fgHaveTrustedProfileWeights() &&
+            (m_RootCompiler->fgPgoSource == ICorJitInfo::PgoSource::Dynamic) && (m_CallsiteWeight >= hotCallCount))
+        {
+            multiplier *= (double)JitConfig.JitExtDefaultPolicyHotCallScale() / 10.0;
+            JITDUMP("\nCallsite weight %u is globally hot.  Multiplier scaled to %g.", m_CallsiteWeight, multiplier);
+        }
     }
 
     // Slow down if there are already too many locals
@@ -1892,6 +1908,7 @@ void ExtendedDefaultPolicy::OnDumpXml(FILE* file, unsigned indent) const
 {
     DefaultPolicy::OnDumpXml(file, indent);
     XATTR_R8(m_ProfileFrequency)
+    XATTR_I4(m_CallsiteWeight)
     XATTR_I4(m_BinaryExprWithCns)
     XATTR_I4(m_ArgCasted)
     XATTR_I4(m_ArgIsStructByValue)
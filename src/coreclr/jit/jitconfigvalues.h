@@ -72,6 +72,11 @@ CONFIG_INTEGER(JitDefaultFill, "JitDefaultFill", 0xdd) // In debug builds, initi
 // Minimum weight needed for the first block of a loop to make it a candidate for alignment.
 CONFIG_INTEGER(JitAlignLoopMinBlockWeight, "JitAlignLoopMinBlockWeight", DEFAULT_ALIGN_LOOP_MIN_BLOCK_WEIGHT)
 
+// Minimum average number of iterations per entry, measured by profile data, for a loop to be aligned.
+CONFIG_INTEGER(JitAlignLoopMinProfileIterations,
+               "JitAlignLoopMinProfileIterations",
+               DEFAULT_ALIGN_LOOP_MIN_PROFILE_ITERATIONS)
+
 // For non-adaptive alignment, minimum loop size (in bytes) for which alignment will be done.
 // Defaults to 3 blocks of 32 bytes chunks = 96 bytes.
 CONFIG_INTEGER(JitAlignLoopMaxCodeSize, "JitAlignLoopMaxCodeSize", DEFAULT_MAX_LOOPSIZE_FOR_ALIGN)
@@ -98,7 +103,17 @@ CONFIG_INTEGER(JitUnrollLoopMaxIterationCount,
 
 CONFIG_INTEGER(JitUnrollLoopsWithEH, "JitUnrollLoopsWithEH", 0) // If 0, don't unroll loops containing EH regions
 
+// If 0, don't partially unroll hot loops with a runtime trip count
+RELEASE_CONFIG_INTEGER(JitPartialUnrollLoops, "JitPartialUnrollLoops", 1)
+
 CONFIG_INTEGER(JitDirectAlloc, "JitDirectAlloc", 0)
+
+// If 0, don't devirtualize invokes of delegates constructed in the same method
+RELEASE_CONFIG_INTEGER(JitDevirtualizeKnownDelegates, "JitDevirtualizeKnownDelegates", 1)
+
+// Number of arena pages kept for reuse between compilations, in total across all JIT threads
+RELEASE_CONFIG_INTEGER(JitArenaPoolPages, "JitArenaPoolPages", 4)
+
 CONFIG_INTEGER(JitDoubleAlign, "JitDoubleAlign", 1)
 CONFIG_INTEGER(JitEmitPrintRefRegs, "JitEmitPrintRefRegs", 0)
 CONFIG_INTEGER(JitEnableDevirtualization, "JitEnableDevirtualization", 1)         // Enable devirtualization in importer
@@ -136,6 +151,10 @@ CONFIG_INTEGER(JitMinOptsInstrCount, "JITMinOptsInstrCount", DEFAULT_MIN_OPTS_IN
 CONFIG_INTEGER(JitMinOptsLvNumCount, "JITMinOptsLvNumcount", DEFAULT_MIN_OPTS_LV_NUM_COUNT)
 CONFIG_INTEGER(JitMinOptsLvRefCount, "JITMinOptsLvRefcount", DEFAULT_MIN_OPTS_LV_REF_COUNT)
 
+// Optimized methods with more IL instructions than this are compiled in throughput mode: loop cloning
+// is skipped and the CSE candidate and tracked local limits are halved. 0 disables throughput mode.
+RELEASE_CONFIG_INTEGER(JitThroughputModeInstrCount, "JitThroughputModeInstrCount", 8000)
+
 CONFIG_INTEGER(JitNoCSE, "JitNoCSE", 0)
 CONFIG_INTEGER(JitNoCSE2, "JitNoCSE2", 0)
 CONFIG_INTEGER(JitNoForceFallback, "JitNoForceFallback", 0) // Set to non-zero to prevent NOWAY assert testing.
@@ -443,6 +462,7 @@ RELEASE_CONFIG_INTEGER(EnableArm64Sve,              "EnableArm64Sve",
 RELEASE_CONFIG_INTEGER(EnableEmbeddedBroadcast,     "EnableEmbeddedBroadcast",   1) // Allows embedded broadcasts to be disabled
 RELEASE_CONFIG_INTEGER(EnableEmbeddedMasking,       "EnableEmbeddedMasking",     1) // Allows embedded masking to be disabled
 RELEASE_CONFIG_INTEGER(EnableApxNDD,                "EnableApxNDD",              0) // Allows APX NDD feature to be disabled
+RELEASE_CONFIG_INTEGER(EnableApxConditionalChaining, "EnableApxConditionalChaining", 0) // Allows APX conditional compare chaining to be disabled
 
 // clang-format on
 
@@ -664,6 +684,12 @@ RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyMaxBB, "JitExtDefaultPolicyMaxBB", 7)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfTrust, "JitExtDefaultPolicyProfTrust", 0x7)
 RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyProfScale, "JitExtDefaultPolicyProfScale", 0x2A)
 
+// Call sites whose profile count reaches JitExtDefaultPolicyHotCallCount are hot for the whole process, not just
+// relative to the caller, and get their benefit multiplier scaled by JitExtDefaultPolicyHotCallScale / 10.
+// Disabled when the count is 0. Only applied for dynamic PGO.
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyHotCallCount, "JitExtDefaultPolicyHotCallCount", 0)
+RELEASE_CONFIG_INTEGER(JitExtDefaultPolicyHotCallScale, "JitExtDefaultPolicyHotCallScale", 0xF)
+
 RELEASE_CONFIG_INTEGER(JitInlinePolicyModel, "JitInlinePolicyModel", 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfile, "JitInlinePolicyProfile", 0)
 RELEASE_CONFIG_INTEGER(JitInlinePolicyProfileThreshold, "JitInlinePolicyProfileThreshold", 40)
@@ -804,9 +830,18 @@ RELEASE_CONFIG_INTEGER(JitDoReversePostOrderLayout, "JitDoReversePostOrderLayout
 // Enable strength reduction
 RELEASE_CONFIG_INTEGER(JitEnableStrengthReduction, "JitEnableStrengthReduction", 1)
 
+// Enable replacing loops that fill memory with a constant by memset/memzero helper calls
+RELEASE_CONFIG_INTEGER(JitEnableFillLoopRecognition, "JitEnableFillLoopRecognition", 1)
+
+// Enable recreating spilled constants at their reload instead of storing them to spill temps
+RELEASE_CONFIG_INTEGER(JitEnableConstantRemat, "JitEnableConstantRemat", 1)
+
 // Enable IV optimizations
 RELEASE_CONFIG_INTEGER(JitEnableInductionVariableOpts, "JitEnableInductionVariableOpts", 1)
 
+// If 1, optimized code polls g_TrapReturningThreads on loop back edges that are not GC safe points
+RELEASE_CONFIG_INTEGER(JitLoopGCPolls, "JitLoopGCPolls", 0)
+
 // JitFunctionFile: Name of a file that contains a list of functions. If the currently compiled function is in the
 // file, certain other JIT config variables will be active. If the currently compiled function is not in the file,
 // the specific JIT config variables will not be active.
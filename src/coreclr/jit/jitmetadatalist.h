@@ -32,12 +32,14 @@ JITMETADATAMETRIC(AllocatedHotCodeBytes,                 int,              JIT_M
 JITMETADATAMETRIC(AllocatedColdCodeBytes,                int,              JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(ReadOnlyDataBytes,                     int,              JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(GCInfoBytes,                           int,              JIT_METADATA_LOWER_IS_BETTER)
+JITMETADATAMETRIC(ThroughputModeMethods,                 int,              0)
 JITMETADATAMETRIC(EHClauseCount,                         int,              0)
 JITMETADATAMETRIC(PhysicallyPromotedFields,              int,              0)
 JITMETADATAMETRIC(LoopsFoundDuringOpts,                  int,              0)
 JITMETADATAMETRIC(LoopsInverted,                         int,              0)
 JITMETADATAMETRIC(LoopsCloned,                           int,              0)
 JITMETADATAMETRIC(LoopsUnrolled,                         int,              0)
+JITMETADATAMETRIC(LoopsPartiallyUnrolled,                int,              0)
 JITMETADATAMETRIC(LoopAlignmentCandidates,               int,              0)
 JITMETADATAMETRIC(LoopsAligned,                          int,              0)
 JITMETADATAMETRIC(LoopsIVWidened,                        int,              0)
@@ -45,12 +47,15 @@ JITMETADATAMETRIC(WidenedIVs,                            int,              0)
 JITMETADATAMETRIC(UnusedIVsRemoved,                      int,              0)
 JITMETADATAMETRIC(LoopsMadeDownwardsCounted,             int,              0)
 JITMETADATAMETRIC(LoopsStrengthReduced,                  int,              0)
+JITMETADATAMETRIC(FillLoopsRecognized,                   int,              0)
 JITMETADATAMETRIC(VarsInSsa,                             int,              0)
 JITMETADATAMETRIC(HoistedExpressions,                    int,              0)
 JITMETADATAMETRIC(RedundantBranchesEliminated,           int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(JumpThreadingsPerformed,               int,              JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(CseCount,                              int,              0)
 JITMETADATAMETRIC(BasicBlocksAtCodegen,                  int,              0)
+JITMETADATAMETRIC(LayoutHotWeight,                       double,           0)
+JITMETADATAMETRIC(LayoutFallthroughWeight,               double,           JIT_METADATA_HIGHER_IS_BETTER)
 JITMETADATAMETRIC(PerfScore,                             double,           JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(BytesAllocated,                        int64_t,          JIT_METADATA_LOWER_IS_BETTER)
 JITMETADATAMETRIC(ImporterBranchFold,                    int,              0)
@@ -2998,6 +2998,11 @@ PhaseStatus Compiler::optCloneLoops()
         JITDUMP("  Loop cloning disabled\n");
         return PhaseStatus::MODIFIED_NOTHING;
     }
+    if (compThroughputMode)
+    {
+        JITDUMP("  Loop cloning skipped: method is compiled in throughput mode\n");
+        return PhaseStatus::MODIFIED_NOTHING;
+    }
 
     LoopCloneContext context((unsigned)m_loops->NumLoops(), getAllocator(CMK_LoopClone));
 
@@ -4470,7 +4470,7 @@ bool Lowering::TryLowerConditionToFlagsNode(GenTree* parent, GenTree* condition,
     {
         assert((condition->gtPrev->gtFlags & GTF_SET_FLAGS) != 0);
         GenTree* flagsDef = condition->gtPrev;
-#ifdef TARGET_ARM64
+#if defined(TARGET_ARM64) || defined(TARGET_AMD64)
         // CCMP is a flag producing node that also consumes flags, so find the
         // "root" of the flags producers and move the entire range.
         // We limit this to 10 nodes look back to avoid quadratic behavior.
@@ -4496,6 +4496,174 @@ bool Lowering::TryLowerConditionToFlagsNode(GenTree* parent, GenTree* condition,
     return false;
 }
 
+#if defined(TARGET_ARM64) || defined(TARGET_AMD64)
+//------------------------------------------------------------------------
+// IsConditionalCompareCandidate: Check whether a node can be turned into a CCMP.
+//
+// Arguments:
+//    node - the node
+//
+// Return Value:
+//    True if the node is an integral relop that a conditional compare can implement.
+//
+static bool IsConditionalCompareCandidate(GenTree* node)
+{
+    if (!node->OperIsCmpCompare() || !varTypeIsIntegralOrI(node->gtGetOp1()))
+    {
+        return false;
+    }
+
+#ifdef TARGET_AMD64
+    // The operands lose their containment and are compared at their actual size, so leave
+    // compares that lowering narrowed to small types alone.
+    if (varTypeIsSmall(node->gtGetOp1()) || varTypeIsSmall(node->gtGetOp2()))
+    {
+        return false;
+    }
+#endif
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// IsConditionalCompareFlagsDef: Check whether the condition checked by a CCMP
+// can come from a node.
+//
+// Arguments:
+//    node - the node that TryLowerConditionToFlagsNode will turn into a def of flags
+//
+// Return Value:
+//    True if the condition the node produces can be checked by a CCMP.
+//
+static bool IsConditionalCompareFlagsDef(GenTree* node)
+{
+#ifdef TARGET_AMD64
+    // The APX ccmp checks a single condition code and has no parity variants, so floating
+    // point conditions cannot be chained.
+    if (node->OperIsCompare())
+    {
+        return !varTypeIsFloating(node->gtGetOp1());
+    }
+
+    if (node->OperIs(GT_SETCC))
+    {
+        GenCondition cond = node->AsCC()->gtCondition;
+        return !cond.IsFloat() && (cond.GetCode() != GenCondition::P) && (cond.GetCode() != GenCondition::NP);
+    }
+#endif
+
+    return true;
+}
+
+//------------------------------------------------------------------------
+// TryLowerAndOrToCCMP : Lower AND/OR of two conditions into test + CCMP + SETCC nodes.
+//
+// Arguments:
+//    tree - pointer to the node
+//    next - [out] Next node to lower if this function returns true
+//
+// Return Value:
+//    false if no changes were made
+//
+bool Lowering::TryLowerAndOrToCCMP(GenTreeOp* tree, GenTree** next)
+{
+    assert(tree->OperIs(GT_AND, GT_OR));
+
+    if (!comp->opts.OptimizationEnabled())
+    {
+        return false;
+    }
+
+#ifdef TARGET_AMD64
+    if (!comp->canUseApxEncoding() || !JitConfig.EnableApxConditionalChaining())
+    {
+        return false;
+    }
+#endif
+
+    GenTree* op1 = tree->gtGetOp1();
+    GenTree* op2 = tree->gtGetOp2();
+
+    if ((op1->OperIsCmpCompare() && varTypeIsIntegralOrI(op1->gtGetOp1())) ||
+        (op2->OperIsCmpCompare() && varTypeIsIntegralOrI(op2->gtGetOp1())))
+    {
+        JITDUMP("[%06u] is a potential candidate for CCMP:\n", Compiler::dspTreeID(tree));
+        DISPTREERANGE(BlockRange(), tree);
+        JITDUMP("\n");
+    }
+
+    // Find out whether an operand is eligible to be converted to a conditional
+    // compare. It must be a normal integral relop; for example, we cannot
+    // conditionally perform a floating point comparison and there is no "ctst"
+    // instruction that would allow us to conditionally implement
+    // TEST_EQ/TEST_NE.
+    //
+    // For the other operand we can allow more arbitrary operations that set
+    // the condition flags; the final transformation into the flags def is done
+    // by TryLowerConditionToFlagsNode.
+    //
+    GenCondition cond1;
+    if (IsConditionalCompareCandidate(op2) && IsConditionalCompareFlagsDef(op1) && IsInvariantInRange(op2, tree) &&
+        TryLowerConditionToFlagsNode(tree, op1, &cond1))
+    {
+        // Fall through, converting op2 to the CCMP
+    }
+    else if (IsConditionalCompareCandidate(op1) && IsConditionalCompareFlagsDef(op2) && IsInvariantInRange(op1, tree) &&
+             TryLowerConditionToFlagsNode(tree, op2, &cond1))
+    {
+        std::swap(op1, op2);
+    }
+    else
+    {
+        JITDUMP("  ..could not turn [%06u] or [%06u] into a def of flags, bailing\n", Compiler::dspTreeID(op1),
+                Compiler::dspTreeID(op2));
+        return false;
+    }
+
+    BlockRange().Remove(op2);
+    BlockRange().InsertBefore(tree, op2);
+
+    GenCondition cond2 = GenCondition::FromRelop(op2);
+    op2->SetOper(GT_CCMP);
+    op2->gtType = TYP_VOID;
+    op2->gtFlags |= GTF_SET_FLAGS;
+
+    op2->gtGetOp1()->ClearContained();
+    op2->gtGetOp2()->ClearContained();
+
+    GenTreeCCMP* ccmp = op2->AsCCMP();
+
+    if (tree->OperIs(GT_AND))
+    {
+        // If the first comparison succeeds then do the second comparison.
+        ccmp->gtCondition = cond1;
+        // Otherwise set the condition flags to something that makes the second
+        // one fail.
+        ccmp->gtFlagsVal = TruthifyingFlags(GenCondition::Reverse(cond2));
+    }
+    else
+    {
+        // If the first comparison fails then do the second comparison.
+        ccmp->gtCondition = GenCondition::Reverse(cond1);
+        // Otherwise set the condition flags to something that makes the second
+        // one succeed.
+        ccmp->gtFlagsVal = TruthifyingFlags(cond2);
+    }
+
+    ContainCheckConditionalCompare(ccmp);
+
+    tree->SetOper(GT_SETCC);
+    tree->AsCC()->gtCondition = cond2;
+
+    JITDUMP("Conversion was legal. Result:\n");
+    DISPTREERANGE(BlockRange(), tree);
+    JITDUMP("\n");
+
+    *next = tree->gtNext;
+    return true;
+}
+#endif // TARGET_ARM64 || TARGET_AMD64
+
 //----------------------------------------------------------------------------------------------
 // LowerNodeCC: Lowers a node that produces a boolean value by setting the condition flags.
 //
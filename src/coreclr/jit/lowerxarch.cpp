@@ -318,11 +318,80 @@ GenTree* Lowering::LowerBinaryArithmetic(GenTreeOp* binOp)
     }
 #endif
 
+#ifdef TARGET_AMD64
+    if (binOp->OperIs(GT_AND, GT_OR))
+    {
+        GenTree* next;
+        if (TryLowerAndOrToCCMP(binOp, &next))
+        {
+            return next;
+        }
+    }
+#endif
+
     ContainCheckBinary(binOp);
 
     return binOp->gtNext;
 }
 
+#ifdef TARGET_AMD64
+//------------------------------------------------------------------------
+// TruthifyingFlags: Get a default flags value that will make a specified condition true.
+//
+// Arguments:
+//    condition - the condition.
+//
+// Returns:
+//    A ccmp default flags value that, if those flags were set, would cause the specified condition to be true.
+//
+insCflags Lowering::TruthifyingFlags(GenCondition condition)
+{
+    switch (condition.GetCode())
+    {
+        case GenCondition::EQ:
+            return INS_FLAGS_ZF;
+        case GenCondition::NE:
+            return INS_FLAGS_NONE;
+        case GenCondition::SGE: // SF == OF
+            return INS_FLAGS_NONE;
+        case GenCondition::SGT: // ZF == 0 && SF == OF
+            return INS_FLAGS_NONE;
+        case GenCondition::SLT: // SF != OF
+            return INS_FLAGS_SF;
+        case GenCondition::SLE: // ZF == 1 || SF != OF
+            return INS_FLAGS_ZF;
+        case GenCondition::UGE: // CF == 0
+            return INS_FLAGS_NONE;
+        case GenCondition::UGT: // CF == 0 && ZF == 0
+            return INS_FLAGS_NONE;
+        case GenCondition::ULT: // CF == 1
+            return INS_FLAGS_CF;
+        case GenCondition::ULE: // CF == 1 || ZF == 1
+            return INS_FLAGS_ZF;
+        default:
+            NO_WAY("unexpected condition type");
+            return INS_FLAGS_NONE;
+    }
+}
+
+//------------------------------------------------------------------------
+// ContainCheckConditionalCompare: determine whether the source of a compare within a compare chain should be contained.
+//
+// Arguments:
+//    node - pointer to the node
+//
+void Lowering::ContainCheckConditionalCompare(GenTreeCCMP* cmp)
+{
+    GenTree* op2 = cmp->gtOp2;
+
+    // ccmp takes a sign extended 32-bit immediate
+    if (op2->IsCnsIntOrI() && !op2->AsIntCon()->ImmedValNeedsReloc(comp) && op2->AsIntCon()->FitsInI32())
+    {
+        MakeSrcContained(cmp, op2);
+    }
+}
+#endif // TARGET_AMD64
+
 //------------------------------------------------------------------------
 // LowerBlockStore: Lower a block store node
 //
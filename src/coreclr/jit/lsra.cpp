@@ -218,9 +218,16 @@ weight_t LinearScan::getWeight(RefPosition* refPos)
             // the basic block weight in which they appear.
             // However, it is generally more harmful to spill tree temps, so we
             // double that.
+            // Constants that codegen rematerializes are not stored on spill,
+            // so they don't get the boost.
             const unsigned TREE_TEMP_REF_COUNT    = 2;
             const unsigned TREE_TEMP_BOOST_FACTOR = 2;
-            weight = TREE_TEMP_REF_COUNT * TREE_TEMP_BOOST_FACTOR * blockInfo[refPos->bbNum].weight;
+            weight = TREE_TEMP_REF_COUNT * blockInfo[refPos->bbNum].weight;
+            if (!refPos->isIntervalRef() || !refPos->getInterval()->isConstant ||
+                !treeNode->IsRematerializableConstant())
+            {
+                weight *= TREE_TEMP_BOOST_FACTOR;
+            }
         }
     }
     else
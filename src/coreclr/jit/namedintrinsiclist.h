@@ -128,6 +128,7 @@ enum NamedIntrinsic : unsigned short
     NI_System_String_op_Implicit,
     NI_System_String_StartsWith,
     NI_System_String_EndsWith,
+    NI_System_String_Contains,
     NI_System_Span_get_Item,
     NI_System_Span_get_Length,
     NI_System_SpanHelpers_ClearWithoutReferences,
@@ -141,6 +142,7 @@ enum NamedIntrinsic : unsigned short
     NI_System_MemoryExtensions_SequenceEqual,
     NI_System_MemoryExtensions_StartsWith,
     NI_System_MemoryExtensions_EndsWith,
+    NI_System_MemoryExtensions_Contains,
 
     NI_System_Threading_Interlocked_And,
     NI_System_Threading_Interlocked_Or,
@@ -478,6 +478,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
     m_DefinitelyStackPointingPointers = BitVecOps::MakeEmpty(&m_bitVecTraits);
     const bool isReadyToRun           = comp->opts.IsReadyToRun() && !comp->IsTargetAbi(CORINFO_NATIVEAOT_ABI);
 
+    // Single-def locals set to a constant earlier in the current block, so that
+    // arrays sized by them (say, by an inlinee local) can be given a fixed size.
+    LocalToConstantMap constantLocals(comp->getAllocator(CMK_ObjectAllocator));
+
     for (BasicBlock* const block : comp->Blocks())
     {
         const bool basicBlockHasNewObj       = block->HasFlag(BBF_HAS_NEWOBJ);
@@ -489,6 +493,8 @@ bool ObjectAllocator::MorphAllocObjNodes()
             continue;
         }
 
+        constantLocals.Clear();
+
         for (Statement* const stmt : block->Statements())
         {
             GenTree* stmtExpr = stmt->GetRootNode();
@@ -496,6 +502,18 @@ bool ObjectAllocator::MorphAllocObjNodes()
 
             ObjectAllocationType allocType = OAT_NONE;
 
+            if (stmtExpr->OperIs(GT_STORE_LCL_VAR) && varTypeIsIntegral(stmtExpr) &&
+                stmtExpr->AsLclVar()->Data()->IsCnsIntOrI())
+            {
+                const unsigned int storeLclNum = stmtExpr->AsLclVar()->GetLclNum();
+
+                if (comp->lvaGetDesc(storeLclNum)->lvSingleDef)
+                {
+                    constantLocals.AddOrUpdate(storeLclNum, stmtExpr->AsLclVar()->Data()->AsIntCon()->IconValue());
+                }
+                continue;
+            }
+
             if (stmtExpr->OperIs(GT_STORE_LCL_VAR) && stmtExpr->TypeIs(TYP_REF))
             {
                 data = stmtExpr->AsLclVar()->Data();
@@ -513,8 +531,10 @@ bool ObjectAllocator::MorphAllocObjNodes()
                         case CORINFO_HELP_NEWARR_1_DIRECT:
                         case CORINFO_HELP_NEWARR_1_ALIGN8:
                         {
+                            ssize_t length = 0;
                             if ((data->AsCall()->gtArgs.CountUserArgs() == 2) &&
-                                data->AsCall()->gtArgs.GetUserArgByIndex(1)->GetNode()->IsCnsIntOrI())
+                                IsConstantArrayLength(data->AsCall()->gtArgs.GetUserArgByIndex(1)->GetNode(),
+                                                      constantLocals, &length))
                             {
                                 allocType = OAT_NEWARR;
                             }
@@ -582,6 +602,7 @@ bool ObjectAllocator::MorphAllocObjNodes()
                         assert(len != nullptr);
 
                         unsigned int blockSize = 0;
+                        ssize_t      length    = 0;
                         comp->Metrics.NewArrayHelperCalls++;
 
                         if (!isExact || !isNonNull)
@@ -589,13 +610,13 @@ bool ObjectAllocator::MorphAllocObjNodes()
                             onHeapReason = "[array type is either non-exact or null]";
                             canStack     = false;
                         }
-                        else if (!len->IsCnsIntOrI())
+                        else if (!IsConstantArrayLength(len, constantLocals, &length))
                         {
                             onHeapReason = "[non-constant size]";
                             canStack     = false;
                         }
-                        else if (!CanAllocateLclVarOnStack(lclNum, clsHnd, allocType, len->AsIntCon()->IconValue(),
-                                                           &blockSize, &onHeapReason))
+                        else if (!CanAllocateLclVarOnStack(lclNum, clsHnd, allocType, length, &blockSize,
+                                                           &onHeapReason))
                         {
                             // reason set by the call
                             canStack = false;
@@ -605,9 +626,8 @@ bool ObjectAllocator::MorphAllocObjNodes()
                             JITDUMP("Allocating V%02u on the stack\n", lclNum);
                             canStack = true;
                             const unsigned int stackLclNum =
-                                MorphNewArrNodeIntoStackAlloc(data->AsCall(), clsHnd,
-                                                              (unsigned int)len->AsIntCon()->IconValue(), blockSize,
-                                                              block, stmt);
+                                MorphNewArrNodeIntoStackAlloc(data->AsCall(), clsHnd, (unsigned int)length,
+                                                              blockSize, block, stmt);
 
                             // Note we do not want to rewrite uses of the array temp, so we
                             // do not update m_HeapLocalToStackLocalMap.
@@ -788,6 +808,41 @@ GenTree* ObjectAllocator::MorphAllocObjNodeIntoHelperCall(GenTreeAllocObj* alloc
     return helperCall;
 }
 
+//------------------------------------------------------------------------
+// IsConstantArrayLength: Check whether the length operand of a newarr
+//                        helper call is known to be a constant.
+//
+// Arguments:
+//    len            - length operand of the helper call
+//    constantLocals - single-def locals stored a constant earlier in the block
+//    length         - [out] the constant length, if any
+//
+// Return Value:
+//    true if the length is constant.
+//
+// Notes:
+//    Besides constants this accepts single-def locals whose only store is a
+//    constant, seen earlier in the same block. The store then reaches the
+//    newarr on every path, so the array has the same size whenever it is
+//    allocated. Inlinees often size an array this way.
+//
+bool ObjectAllocator::IsConstantArrayLength(GenTree* len, LocalToConstantMap& constantLocals, ssize_t* length)
+{
+    if (len->IsCnsIntOrI())
+    {
+        *length = len->AsIntCon()->IconValue();
+        return true;
+    }
+
+    if (len->OperIs(GT_LCL_VAR) && constantLocals.TryGetValue(len->AsLclVar()->GetLclNum(), length))
+    {
+        JITDUMP("Array length V%02u is known to be %zd\n", len->AsLclVar()->GetLclNum(), *length);
+        return true;
+    }
+
+    return false;
+}
+
 //------------------------------------------------------------------------
 // MorphNewArrNodeIntoStackAlloc: Morph a newarray helper call node into stack allocation.
 //
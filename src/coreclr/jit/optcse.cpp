@@ -714,7 +714,7 @@ unsigned Compiler::optValnumCSE_Index(GenTree* tree, Statement* stmt)
     {
         /* Not found, create a new entry (unless we have too many already) */
 
-        if (optCSECandidateCount < MAX_CSE_CNT)
+        if (optCSECandidateCount < optCSEMaxCandidateCount())
         {
             if (optCSEhashCount == optCSEhashMaxCountBeforeResize)
             {
@@ -781,7 +781,7 @@ unsigned Compiler::optValnumCSE_Index(GenTree* tree, Statement* stmt)
 
         /* Create a new CSE (unless we have the maximum already) */
 
-        if (optCSECandidateCount == MAX_CSE_CNT)
+        if (optCSECandidateCount == optCSEMaxCandidateCount())
         {
 #ifdef DEBUG
             if (verbose)
@@ -4480,7 +4480,7 @@ bool CSE_Heuristic::PromotionCheck(CSE_Candidate* candidate)
             }
 
             // If we have maxed out lvaTrackedCount then this CSE may end up as an untracked variable
-            if (m_pCompiler->lvaTrackedCount == (unsigned)JitConfig.JitMaxLocalsToTrack())
+            if (m_pCompiler->lvaTrackedCount == m_pCompiler->lvaMaxTrackedCount())
             {
                 cse_def_cost += 1;
                 cse_use_cost += 1;
@@ -1219,7 +1219,9 @@ bool Compiler::optComputeLoopRep(int        constInit,
 // Loops must be of the form:
 //   for (i=icon; i<icon; i++) { ... }
 //
-// Loops handled are fully unrolled; there is no partial unrolling.
+// Loops handled here are fully unrolled. Hot loops with a trip count only
+// known at runtime may instead be partially unrolled; see
+// optTryPartiallyUnrollLoop.
 //
 // Limitations: only the following loop types are handled:
 // 1. constant initializer, constant bound
@@ -1262,8 +1264,9 @@ PhaseStatus Compiler::optUnrollLoops()
 
     // Look for loop unrolling candidates
 
-    int  unrollCount = 0;
-    bool anyIRchange = false;
+    int  unrollCount        = 0;
+    int  partialUnrollCount = 0;
+    bool anyIRchange        = false;
 
     int passes = 0;
 
@@ -1283,7 +1286,17 @@ PhaseStatus Compiler::optUnrollLoops()
                 continue;
             }
 
-            if (!optTryUnrollLoop(loop, &anyIRchange))
+            bool unrolled = optTryUnrollLoop(loop, &anyIRchange);
+
+            // Loops are only partially unrolled on the first pass; the remainder
+            // loop left behind would otherwise be a candidate again.
+            if (!unrolled && (passes == 0) && optTryPartiallyUnrollLoop(loop, &anyIRchange))
+            {
+                partialUnrollCount++;
+                unrolled = true;
+            }
+
+            if (!unrolled)
             {
                 continue;
             }
@@ -1315,7 +1328,8 @@ PhaseStatus Compiler::optUnrollLoops()
     {
         assert(anyIRchange);
 
-        Metrics.LoopsUnrolled += unrollCount;
+        Metrics.LoopsUnrolled += unrollCount - partialUnrollCount;
+        Metrics.LoopsPartiallyUnrolled += partialUnrollCount;
 
 #ifdef DEBUG
         if (verbose)
@@ -1708,6 +1722,273 @@ bool Compiler::optTryUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR)
     return true;
 }
 
+//-----------------------------------------------------------------------------
+// optTryPartiallyUnrollLoop: Do legality and profitability checks and try to
+// partially unroll a single loop whose trip count is not a constant.
+//
+// Parameters:
+//   loop      - The loop to try unrolling
+//   changedIR - [out] Whether or not the IR was changed. Can be true even if
+//               the function returns false.
+//
+// Returns:
+//   True if the loop was partially unrolled, in which case the flow graph was
+//   changed.
+//
+// Remarks:
+//   The loop body is duplicated "factor" times and the copies are chained
+//   together. Only the last copy keeps an IV test, which checks that another
+//   "factor" iterations can run before branching back to the first copy:
+//
+//     if ((long)i + (factor - 1) * step < (long)limit) goto unrolled; // guard
+//     original loop...                                               // remainder
+//   unrolled:
+//     body; i += step;                                                // copy 0
+//     ...
+//     body; i += step;                                                // copy factor-1
+//     if ((long)i + (factor - 1) * step < (long)limit) goto unrolled;
+//     if (i < limit) goto original loop; else goto exit;
+//
+//   The original loop is kept to run the remaining iterations. The wide
+//   comparison cannot overflow, so all the removed tests are known to pass.
+//
+//   Only innermost loops with a single backedge (from the IV test) are
+//   handled, and only when profile data says the loop iterates enough for the
+//   unrolled copies to be worthwhile. Loop cloning runs before this, so the
+//   copies of a cloned fast loop carry no bounds checks.
+//
+bool Compiler::optTryPartiallyUnrollLoop(FlowGraphNaturalLoop* loop, bool* changedIR)
+{
+    static const int UNROLL_LIMIT_SZ[COUNT_OPT_CODE + 1] = {
+        150, // BLENDED_CODE
+        0,   // SMALL_CODE
+        300, // FAST_CODE
+        0    // COUNT_OPT_CODE
+    };
+
+    assert(UNROLL_LIMIT_SZ[SMALL_CODE] == 0);
+    assert(UNROLL_LIMIT_SZ[COUNT_OPT_CODE] == 0);
+
+    const unsigned maxUnrollFactor = 8;
+
+    if ((JitConfig.JitPartialUnrollLoops() == 0) || compThroughputMode || !fgIsUsingProfileWeights())
+    {
+        return false;
+    }
+
+    if ((loop->GetChild() != nullptr) || (loop->BackEdges().size() != 1))
+    {
+        return false;
+    }
+
+    BasicBlock* const header    = loop->GetHeader();
+    BasicBlock* const preheader = loop->EntryEdge(0)->getSourceBlock();
+
+    if (!header->hasProfileWeight() || (preheader->bbWeight <= BB_ZERO_WEIGHT))
+    {
+        return false;
+    }
+
+    // Estimate the average trip count from the profile; we want at least two
+    // rounds of the smallest unroll factor.
+    const weight_t tripEstimate = header->bbWeight / preheader->bbWeight;
+    if (tripEstimate < 4)
+    {
+        return false;
+    }
+
+    NaturalLoopIterInfo iterInfo;
+    if (!loop->AnalyzeIteration(&iterInfo))
+    {
+        return false;
+    }
+
+    // Constant trip count loops are left to the full unroller.
+    if (iterInfo.HasConstInit && iterInfo.HasConstLimit)
+    {
+        return false;
+    }
+
+    BasicBlock* const testBlock = iterInfo.TestBlock;
+    if (loop->BackEdge(0)->getSourceBlock() != testBlock)
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": IV test is not the only backedge\n", loop->GetIndex());
+        return false;
+    }
+
+    if (!iterInfo.IterTree->OperIs(GT_STORE_LCL_VAR) || (iterInfo.IterOperType() != TYP_INT) ||
+        (lvaGetDesc(iterInfo.IterVar)->TypeGet() != TYP_INT) ||
+        (testBlock->lastStmt()->GetRootNode()->gtGetOp1() != iterInfo.TestTree))
+    {
+        return false;
+    }
+
+    const bool isUnsigned = iterInfo.TestTree->IsUnsigned();
+    if (!iterInfo.IsIncreasingLoop() && (isUnsigned || !iterInfo.IsDecreasingLoop()))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": IV is not monotonic\n", loop->GetIndex());
+        return false;
+    }
+
+    const int64_t step =
+        (iterInfo.IterOper() == GT_ADD) ? (int64_t)iterInfo.IterConst() : -(int64_t)iterInfo.IterConst();
+
+    INDEBUG(const char* reason);
+    if (!loop->CanDuplicate(INDEBUG(&reason)))
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": %s\n", loop->GetIndex(), reason);
+        return false;
+    }
+
+    // After this point, assume we've changed the IR. In particular, we call
+    // gtSetStmtInfo() which can modify the IR.
+    *changedIR = true;
+
+    ClrSafeInt<unsigned> loopCostSz;
+
+    loop->VisitLoopBlocksReversePostOrder([=, &loopCostSz](BasicBlock* block) {
+        for (Statement* const stmt : block->Statements())
+        {
+            gtSetStmtInfo(stmt);
+            loopCostSz += stmt->GetCostSz();
+        }
+
+        return BasicBlockVisit::Continue;
+    });
+
+    // Pick the largest factor that fits the size budget and that the loop is
+    // expected to iterate at least twice per entry.
+    const int unrollLimitSz = UNROLL_LIMIT_SZ[compCodeOpt()];
+    unsigned  factor        = maxUnrollFactor;
+    while (factor >= 2)
+    {
+        ClrSafeInt<unsigned> unrollCostSz = loopCostSz * ClrSafeInt<unsigned>(factor);
+        if (!unrollCostSz.IsOverflow() && (unrollCostSz.Value() <= (unsigned)unrollLimitSz) &&
+            (tripEstimate >= (2 * factor)))
+        {
+            break;
+        }
+
+        factor /= 2;
+    }
+
+    if (factor < 2)
+    {
+        JITDUMP("Failed to partially unroll loop " FMT_LP ": size constraint or trip estimate %f (heuristic)\n",
+                loop->GetIndex(), tripEstimate);
+        return false;
+    }
+
+    JITDUMP("\nPartially unrolling loop " FMT_LP " by %u, estimated trip count %f\n", loop->GetIndex(), factor,
+            tripEstimate);
+    JITDUMPEXEC(FlowGraphNaturalLoop::Dump(loop));
+
+    // The condition under which another "factor" iterations can run:
+    //   (long)i + (factor - 1) * step RELOP (long)limit
+    auto makeUnrolledTest = [=, &iterInfo]() {
+        GenTree* iter  = gtNewCastNode(TYP_LONG, gtNewLclvNode(iterInfo.IterVar, TYP_INT), isUnsigned, TYP_LONG);
+        GenTree* ahead = gtNewOperNode(GT_ADD, TYP_LONG, iter, gtNewLconNode((int64_t)(factor - 1) * step));
+        GenTree* limit = gtNewCastNode(TYP_LONG, gtCloneExpr(iterInfo.Limit()), isUnsigned, TYP_LONG);
+        GenTree* relop = gtNewOperNode(iterInfo.TestOper(), TYP_INT, ahead, limit);
+        if (isUnsigned)
+        {
+            relop->gtFlags |= GTF_UNSIGNED;
+        }
+        return gtNewOperNode(GT_JTRUE, TYP_VOID, relop);
+    };
+
+    BasicBlock* const exiting            = testBlock;
+    const weight_t    backEdgeLikelihood = loop->BackEdge(0)->getLikelihood();
+
+    // Most iterations now run in the unrolled copies; the original loop only
+    // runs what is left over.
+    const weight_t remainderScale = min(1.0, factor / (2 * tripEstimate));
+    const weight_t copyScale      = (1.0 - remainderScale) / factor;
+
+    BlockToBlockMap blockMap(getAllocator(CMK_LoopUnroll));
+    BasicBlock*     insertAfter   = loop->GetLexicallyBottomMostBlock();
+    BasicBlock*     firstHeader   = nullptr;
+    BasicBlock*     prevTestBlock = nullptr;
+
+    for (unsigned i = 0; i < factor; i++)
+    {
+        loop->Duplicate(&insertAfter, &blockMap, copyScale);
+
+        BasicBlock* const copyHeader = blockMap[header];
+        if (firstHeader == nullptr)
+        {
+            firstHeader = copyHeader;
+        }
+        else
+        {
+            // Intermediate tests are known to pass.
+            optRedirectPrevUnrollIteration(loop, prevTestBlock, copyHeader);
+        }
+
+        prevTestBlock = blockMap[exiting];
+    }
+
+    loop->VisitLoopBlocks([=](BasicBlock* block) {
+        block->scaleBBWeight(remainderScale);
+        return BasicBlockVisit::Continue;
+    });
+
+    // The last copy branches back to the first copy if another round fits,
+    // otherwise to a copy of the original test that picks between the
+    // remainder loop and the exit.
+    BasicBlock* const remainderCheck = fgNewBBafter(BBJ_COND, insertAfter, /*extendRegion*/ true);
+    remainderCheck->inheritWeight(preheader);
+
+    FlowEdge* const remainderTrueEdge = fgAddRefPred(exiting->GetTrueTarget(), remainderCheck);
+    remainderTrueEdge->setLikelihood(exiting->GetTrueEdge()->getLikelihood());
+    FlowEdge* const remainderFalseEdge = fgAddRefPred(exiting->GetFalseTarget(), remainderCheck);
+    remainderFalseEdge->setLikelihood(exiting->GetFalseEdge()->getLikelihood());
+    remainderCheck->SetCond(remainderTrueEdge, remainderFalseEdge);
+
+    Statement* const remainderStmt = fgNewStmtFromTree(gtCloneExpr(exiting->lastStmt()->GetRootNode()));
+    fgInsertStmtAtEnd(remainderCheck, remainderStmt);
+    fgMorphBlockStmt(remainderCheck, remainderStmt DEBUGARG("Partial unroll remainder check"));
+
+    assert(prevTestBlock->KindIs(BBJ_COND));
+    fgRedirectTrueEdge(prevTestBlock, firstHeader);
+    fgRedirectFalseEdge(prevTestBlock, remainderCheck);
+
+    const weight_t stayLikelihood = pow(backEdgeLikelihood, (weight_t)factor);
+    prevTestBlock->GetTrueEdge()->setLikelihood(stayLikelihood);
+    prevTestBlock->GetFalseEdge()->setLikelihood(1.0 - stayLikelihood);
+
+    Statement* const lastTestStmt = prevTestBlock->lastStmt();
+    lastTestStmt->SetRootNode(makeUnrolledTest());
+    fgMorphBlockStmt(prevTestBlock, lastTestStmt DEBUGARG("Partial unroll loop test"));
+
+    // Finally guard entry into the unrolled copies.
+    BasicBlock* const guard = fgNewBBafter(BBJ_COND, preheader, /*extendRegion*/ true);
+    guard->inheritWeight(preheader);
+
+    fgReplaceJumpTarget(preheader, header, guard);
+
+    const weight_t  enterLikelihood = min(0.9, max(0.1, 1.0 - (factor - 1) / tripEstimate));
+    FlowEdge* const guardTrueEdge   = fgAddRefPred(firstHeader, guard);
+    guardTrueEdge->setLikelihood(enterLikelihood);
+    FlowEdge* const guardFalseEdge = fgAddRefPred(header, guard);
+    guardFalseEdge->setLikelihood(1.0 - enterLikelihood);
+    guard->SetCond(guardTrueEdge, guardFalseEdge);
+
+    Statement* const guardStmt = fgNewStmtFromTree(makeUnrolledTest());
+    fgInsertStmtAtEnd(guard, guardStmt);
+    fgMorphBlockStmt(guard, guardStmt DEBUGARG("Partial unroll guard"));
+
+#ifdef DEBUG
+    if (verbose)
+    {
+        printf("Partially unrolled loop:\n");
+        fgDumpTrees(firstHeader, remainderCheck);
+    }
+#endif // DEBUG
+
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 // optRedirectPrevUnrollIteration:
 //   Redirect the previous unrolled loop iteration (or entry) to a new target.
@@ -4470,6 +4751,114 @@ void Compiler::optHoistLoopBlocks(FlowGraphNaturalLoop*    loop,
             return vnIsInvariant;
         }
 
+        //------------------------------------------------------------------------
+        // IsNonNullAtLoopEntry: determine if a loop invariant object is known to
+        //   be non-null whenever the loop is entered.
+        //
+        // Arguments:
+        //   vn -- conservative normal VN of the object
+        //
+        // Returns:
+        //   true if the VN is known non-null, or if the preheader is only reached
+        //   through the non-null exit of a dominating "vn ==/!= null" test.
+        //
+        bool IsNonNullAtLoopEntry(ValueNum vn)
+        {
+            if (!m_compiler->optVNIsLoopInvariant(vn, m_loop, &m_hoistContext->m_curLoopVnInvariantCache))
+            {
+                return false;
+            }
+
+            ValueNumStore* const vnStore = m_compiler->vnStore;
+            if (vnStore->IsKnownNonNull(vn))
+            {
+                return true;
+            }
+
+            // Look for a guard among the closest dominators of the preheader,
+            // for example the "arr != null" condition from loop cloning.
+            const unsigned    maxGuardSearchDepth = 8;
+            BasicBlock* const preheader           = m_loop->EntryEdge(0)->getSourceBlock();
+            unsigned          depth               = 0;
+
+            for (BasicBlock* dom = preheader->bbIDom; (dom != nullptr) && (depth < maxGuardSearchDepth);
+                 dom             = dom->bbIDom, depth++)
+            {
+                if (!dom->KindIs(BBJ_COND) || dom->TrueTargetIs(dom->GetFalseTarget()))
+                {
+                    continue;
+                }
+
+                GenTree* const relop = dom->lastStmt()->GetRootNode()->gtGetOp1();
+                if (!relop->OperIs(GT_EQ, GT_NE))
+                {
+                    continue;
+                }
+
+                ValueNum op1VN = vnStore->VNConservativeNormalValue(relop->gtGetOp1()->gtVNPair);
+                ValueNum op2VN = vnStore->VNConservativeNormalValue(relop->gtGetOp2()->gtVNPair);
+                if (!((op1VN == vn) && (op2VN == ValueNumStore::VNForNull())) &&
+                    !((op2VN == vn) && (op1VN == ValueNumStore::VNForNull())))
+                {
+                    continue;
+                }
+
+                BasicBlock* const nonNullTarget = relop->OperIs(GT_NE) ? dom->GetTrueTarget() : dom->GetFalseTarget();
+                if ((nonNullTarget->GetUniquePred(m_compiler) == dom) &&
+                    m_compiler->m_domTree->Dominates(nonNullTarget, preheader))
+                {
+                    JITDUMP("      " FMT_VN " is non-null on entry due to guard in " FMT_BB "\n", vn, dom->bbNum);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        //------------------------------------------------------------------------
+        // CanOnlyThrowOnNonNull: determine if the only exceptions a tree may
+        //   throw are null dereferences of objects known to be non-null when the
+        //   loop is entered. Such trees cannot throw when hoisted, so they can be
+        //   moved past side effects.
+        //
+        // Arguments:
+        //   tree -- tree in question
+        //
+        // Returns:
+        //   true if the tree cannot throw when evaluated in the preheader.
+        //
+        bool CanOnlyThrowOnNonNull(GenTree* tree)
+        {
+            ValueNumStore* const vnStore = m_compiler->vnStore;
+            ValueNum             excSet  = vnStore->VNExceptionSet(tree->gtVNPair.GetConservative());
+
+            if (excSet == vnStore->VNForEmptyExcSet())
+            {
+                // We cannot tell what the exception is.
+                return false;
+            }
+
+            while (excSet != vnStore->VNForEmptyExcSet())
+            {
+                VNFuncApp excSetApp;
+                if (!vnStore->GetVNFunc(excSet, &excSetApp) || (excSetApp.m_func != VNF_ExcSetCons))
+                {
+                    return false;
+                }
+
+                VNFuncApp excApp;
+                if (!vnStore->GetVNFunc(excSetApp.m_args[0], &excApp) || (excApp.m_func != VNF_NullPtrExc) ||
+                    !IsNonNullAtLoopEntry(excApp.m_args[0]))
+                {
+                    return false;
+                }
+
+                excSet = excSetApp.m_args[1];
+            }
+
+            return true;
+        }
+
         bool IsHoistableOverExcepSibling(GenTree* node, bool siblingHasExcep)
         {
             JITDUMP("      [%06u]", dspTreeID(node));
@@ -4759,10 +5148,10 @@ void Compiler::optHoistLoopBlocks(FlowGraphNaturalLoop*    loop,
                     {
                         // For now, we give up on an expression that might raise an exception if it is after the
                         // first possible global side effect (and we assume we're after that if we're not in the first
-                        // block).
-                        // TODO-CQ: this is when we might do loop cloning.
+                        // block), unless a guard on loop entry (e.g. from loop cloning) shows the exception cannot
+                        // happen.
                         //
-                        if ((tree->gtFlags & GTF_EXCEPT) != 0)
+                        if (((tree->gtFlags & GTF_EXCEPT) != 0) && !CanOnlyThrowOnNonNull(tree))
                         {
                             INDEBUG(failReason = "side effect ordering constraint";)
                             treeIsHoistable = false;
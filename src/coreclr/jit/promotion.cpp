@@ -470,8 +470,7 @@ public:
 
         JITDUMP("Picking promotions for V%02u\n", lclNum);
 
-        AggregateInfo* agg     = nullptr;
-        int            numReps = 0;
+        jitstd::vector<size_t> candidates(comp->getAllocator(CMK_Promotion));
         for (size_t i = 0; i < m_accesses.size(); i++)
         {
             const Access& access = m_accesses[i];
@@ -486,25 +485,93 @@ public:
                 continue;
             }
 
-            if (agg == nullptr)
+            candidates.push_back(i);
+        }
+
+        if (candidates.size() <= 0)
+        {
+            JITDUMP("\n");
+            return 0;
+        }
+
+        // For wide structs with more profitable fields than we are willing to
+        // promote, keep the hottest ones. The replacements must still be
+        // created in offset order.
+        if (candidates.size() > PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT)
+        {
+            jitstd::sort(candidates.begin(), candidates.end(), [this](size_t left, size_t right) {
+                if (m_accesses[left].CountWtd != m_accesses[right].CountWtd)
+                {
+                    return m_accesses[left].CountWtd > m_accesses[right].CountWtd;
+                }
+
+                return left < right;
+            });
+
+            JITDUMP("  %zu profitable fields in V%02u; promoting the %d hottest\n", candidates.size(), lclNum,
+                    PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT);
+
+            candidates.resize(PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT, 0);
+            jitstd::sort(candidates.begin(), candidates.end(), [](size_t left, size_t right) {
+                return left < right;
+            });
+        }
+
+        AggregateInfo* agg = new (comp, CMK_Promotion) AggregateInfo(comp->getAllocator(CMK_Promotion), lclNum);
+        aggregates.Add(agg);
+
+        for (size_t index : candidates)
+        {
+            const Access& access = m_accesses[index];
+            agg->Replacements.push_back(Replacement(access.Offset, access.AccessType));
+        }
+
+        JITDUMP("\n");
+        return (int)candidates.size();
+    }
+
+    //------------------------------------------------------------------------
+    // PrimitiveAccessCount:
+    //   Get the number of primitive accesses recorded for this struct local,
+    //   which bounds the number of promotions that can be picked for it.
+    //
+    // Returns:
+    //   Number of accesses that are not struct accesses.
+    //
+    unsigned PrimitiveAccessCount()
+    {
+        unsigned count = 0;
+        for (const Access& access : m_accesses)
+        {
+            if (access.AccessType != TYP_STRUCT)
             {
-                agg = new (comp, CMK_Promotion) AggregateInfo(comp->getAllocator(CMK_Promotion), lclNum);
-                aggregates.Add(agg);
+                count++;
             }
+        }
 
-            agg->Replacements.push_back(Replacement(access.Offset, access.AccessType));
-            numReps++;
+        return count;
+    }
 
-            if (agg->Replacements.size() >= PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT)
+    //------------------------------------------------------------------------
+    // PrimitiveAccessWeight:
+    //   Get the total weighted count of primitive accesses recorded for this
+    //   struct local.
+    //
+    // Returns:
+    //   Sum of the weighted counts of the accesses that are not struct accesses.
+    //
+    weight_t PrimitiveAccessWeight()
+    {
+        weight_t weight = 0;
+        for (const Access& access : m_accesses)
+        {
+            if (access.AccessType != TYP_STRUCT)
             {
-                JITDUMP("  Promoted %zu fields in V%02u; will not promote more\n", agg->Replacements.size(),
-                        agg->LclNum);
-                break;
+                weight += access.CountWtd;
             }
         }
 
-        JITDUMP("\n");
-        return numReps;
+        return weight;
     }
 
     //------------------------------------------------------------------------
@@ -1164,16 +1231,44 @@ public:
         // to the next struct, but PHYSICAL_PROMOTION_MAX_PROMOTIONS_PER_STRUCT
         // puts a limit on the number of promotions in each struct so this is
         // fine to avoid the pathological cases.
-        const int maxTotalNumPromotions = JitConfig.JitMaxLocalsToTrack();
+        const int maxTotalNumPromotions = (int)m_compiler->lvaMaxTrackedCount();
 
+        // Visit the structs in local number order, unless their accesses may
+        // exceed the limit. In that case visit them hottest first, so that
+        // the limit is spent on the structs used in hot blocks.
+        jitstd::vector<unsigned> lclNums(m_compiler->getAllocator(CMK_Promotion));
+        unsigned                 maxPossiblePromotions = 0;
         for (unsigned lclNum = 0; lclNum < m_compiler->lvaCount; lclNum++)
         {
-            LocalUses* uses = m_uses[lclNum];
-            if (uses == nullptr)
+            if (m_uses[lclNum] != nullptr)
             {
-                continue;
+                lclNums.push_back(lclNum);
+                maxPossiblePromotions += m_uses[lclNum]->PrimitiveAccessCount();
+            }
+        }
+
+        if (maxPossiblePromotions >= (unsigned)maxTotalNumPromotions)
+        {
+            jitstd::vector<weight_t> weights(m_compiler->lvaCount, 0.0, m_compiler->getAllocator(CMK_Promotion));
+            for (unsigned lclNum : lclNums)
+            {
+                weights[lclNum] = m_uses[lclNum]->PrimitiveAccessWeight();
             }
 
+            jitstd::sort(lclNums.begin(), lclNums.end(), [&weights](unsigned left, unsigned right) {
+                if (weights[left] != weights[right])
+                {
+                    return weights[left] > weights[right];
+                }
+
+                return left < right;
+            });
+        }
+
+        for (unsigned lclNum : lclNums)
+        {
+            LocalUses* uses = m_uses[lclNum];
+
 #ifdef DEBUG
             if (m_compiler->verbose)
             {
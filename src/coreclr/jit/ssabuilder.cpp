@@ -298,6 +298,15 @@ void SsaBuilder::InsertPhiFunctions()
     // Use the same IDF vector for all blocks to avoid unnecessary memory allocations
     BlkVector blockIDF(m_allocator);
 
+    // The set of locals each block already has a phi for, indexed by post order number and
+    // allocated on first use. This avoids walking the (possibly long) phi prefix of the block
+    // every time a def reaches it through the dominance frontier.
+    VARSET_TP* blockPhiVars = m_allocator.allocate<VARSET_TP>(count);
+    for (unsigned i = 0; i < count; ++i)
+    {
+        blockPhiVars[i] = VarSetOps::UninitVal();
+    }
+
     JITDUMP("Inserting phi functions:\n");
 
     for (unsigned i = 0; i < count; ++i)
@@ -353,11 +362,20 @@ void SsaBuilder::InsertPhiFunctions()
                 }
 
                 // Check if we've already inserted a phi node.
-                if (GetPhiNode(bbInDomFront, lclNum) == nullptr)
+                VARSET_TP& phiVars = blockPhiVars[bbInDomFront->bbPostorderNum];
+                if (VarSetOps::MayBeUninit(phiVars))
                 {
+                    phiVars = VarSetOps::MakeEmpty(m_pCompiler);
+                }
+
+                if (!VarSetOps::IsMember(m_pCompiler, phiVars, varIndex))
+                {
+                    assert(GetPhiNode(bbInDomFront, lclNum) == nullptr);
+
                     // We have a variable i that is defined in block j and live at l, and l belongs to dom frontier of
                     // j. So insert a phi node at l.
                     InsertPhi(m_pCompiler, bbInDomFront, lclNum);
+                    VarSetOps::AddElemD(m_pCompiler, phiVars, varIndex);
                 }
             }
         }
@@ -770,6 +770,37 @@ private:
         virtual int Compare(const CMethodSemanticsMap *psFirst, const CMethodSemanticsMap *psSecond);
     };
 
+    struct CTypeDefNameMap
+    {
+        ULONG           m_ulNameHash;       // Hash of the TypeDef name.
+        RID             m_ridTypeDef;       // RID of the TypeDef record.
+    };
+    CTypeDefNameMap *m_pTypeDefNameMap;     // Possible array of TypeDefs, ordered by name hash and then RID.
+
+#ifndef DACCESS_COMPILE
+    class CTypeDefNameMapSorter : public CQuickSort<CTypeDefNameMap>
+    {
+    public:
+         CTypeDefNameMapSorter(CTypeDefNameMap *pBase, int iCount) : CQuickSort<CTypeDefNameMap>(pBase, iCount) {}
+         virtual int Compare(CTypeDefNameMap *psFirst, CTypeDefNameMap *psSecond);
+    };
+#endif //!DACCESS_COMPILE
+
+    class CTypeDefNameMapSearcher : public CBinarySearch<CTypeDefNameMap>
+    {
+    public:
+        CTypeDefNameMapSearcher(const CTypeDefNameMap *pBase, int iCount) : CBinarySearch<CTypeDefNameMap>(pBase, iCount) {}
+        virtual int Compare(const CTypeDefNameMap *psFirst, const CTypeDefNameMap *psSecond);
+    };
+
+    __checkReturn
+    HRESULT IsTypeDefMatch(
+        RID         ridTypeDef,             // [IN] TypeDef to check.
+        LPCSTR      szTypeDefNamespace,     // [IN] Namespace for the TypeDef.
+        LPCSTR      szTypeDefName,          // [IN] Name of the TypeDef.
+        mdToken     tkEnclosingClass,       // [IN] TypeDef of enclosing class, or nil.
+        BOOL       *pfMatch);               // [OUT] Whether the TypeDef matches.
+
     static BOOL CompareSignatures(PCCOR_SIGNATURE pvFirstSigBlob, DWORD cbFirstSigBlob,
                                   PCCOR_SIGNATURE pvSecondSigBlob, DWORD cbSecondSigBlob,
                                   void* SigARguments);
@@ -481,6 +481,23 @@ ep_rt_config_value_get_output_streaming (void)
     return false;
 }
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_output_file_size_mb (void)
+{
+    STATIC_CONTRACT_NOTHROW;
+
+    uint64_t value;
+    if (RhConfig::Environment::TryGetIntegerValue("EventPipeOutputFileSizeMB", &value))
+    {
+        EP_ASSERT(value <= UINT32_MAX);
+        return static_cast<uint32_t>(value);
+    }
+
+    return 0;
+}
+
 static
 inline
 bool
@@ -149,6 +149,8 @@ void GCToEEInterface::GcEnumAllocContexts(enum_alloc_context_func* fn, void* par
         }
     }
     END_FOREACH_THREAD
+
+    Thread::EnumRecycledAllocContexts(fn, param);
 }
 
 // EE can perform post stack scanning action, while the user threads are still suspended
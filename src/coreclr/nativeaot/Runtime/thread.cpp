@@ -363,12 +363,76 @@ uint64_t Thread::GetDeadThreadsNonAllocBytes()
 #endif
 }
 
+ee_alloc_context Thread::s_RecycledAllocContexts[Thread::MaxRecycledAllocContexts];
+uint32_t Thread::s_RecycledAllocContextCount = 0;
+
+void Thread::EnumRecycledAllocContexts(enum_alloc_context_func* fn, void* param)
+{
+    // The GC may run this enumeration on multiple threads concurrently, so the entries are not modified here.
+    // The ones the GC has fixed are dropped when the list is next updated.
+    for (uint32_t i = 0; i < s_RecycledAllocContextCount; i++)
+    {
+        (*fn) (s_RecycledAllocContexts[i].GetGCAllocContext(), param);
+    }
+}
+
+static bool HasUnusedSpace(gc_alloc_context* context)
+{
+    return context->alloc_ptr != context->alloc_limit;
+}
+
+void Thread::AdoptRecycledAllocContext()
+{
+    while (s_RecycledAllocContextCount > 0)
+    {
+        gc_alloc_context* recycled = s_RecycledAllocContexts[--s_RecycledAllocContextCount].GetGCAllocContext();
+        if (!HasUnusedSpace(recycled))
+            continue;
+
+        gc_alloc_context* context = GetAllocContext();
+        ASSERT(context->alloc_ptr == NULL && context->alloc_bytes == 0);
+
+        // The unused space was accounted as dead when the previous owner detached. It is allocatable again and
+        // counts as handed to this thread, so that its allocated bytes start at zero.
+        size_t unused = recycled->alloc_limit - recycled->alloc_ptr;
+        s_DeadThreadsNonAllocBytes -= unused;
+
+        *context = *recycled;
+        context->alloc_bytes = unused;
+        context->alloc_bytes_uoh = 0;
+        GetEEAllocContext()->UpdateCombinedLimit(ee_alloc_context::IsRandomizedSamplingEnabled());
+        return;
+    }
+}
+
 void Thread::Detach()
 {
     // clean up the alloc context
     gc_alloc_context* context = GetAllocContext();
     s_DeadThreadsNonAllocBytes += context->alloc_limit - context->alloc_ptr;
-    GCHeapUtilities::GetGCHeap()->FixAllocContext(context, NULL, NULL);
+
+    if (HasUnusedSpace(context))
+    {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < s_RecycledAllocContextCount; i++)
+        {
+            if (HasUnusedSpace(s_RecycledAllocContexts[i].GetGCAllocContext()))
+                s_RecycledAllocContexts[count++] = s_RecycledAllocContexts[i];
+        }
+        s_RecycledAllocContextCount = count;
+    }
+
+    if (HasUnusedSpace(context) && s_RecycledAllocContextCount < MaxRecycledAllocContexts)
+    {
+        // Keep the context alive for the next thread that attaches; it stays visible to the GC
+        // through EnumRecycledAllocContexts
+        *s_RecycledAllocContexts[s_RecycledAllocContextCount++].GetGCAllocContext() = *context;
+        context->init();
+    }
+    else
+    {
+        GCHeapUtilities::GetGCHeap()->FixAllocContext(context, NULL, NULL);
+    }
 
     SetDetached();
 }
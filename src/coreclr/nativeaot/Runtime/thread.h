@@ -9,6 +9,7 @@
 #include <minipal/xoshiro128pp.h>
 
 struct gc_alloc_context;
+typedef void enum_alloc_context_func(gc_alloc_context*, void*);
 class RuntimeInstance;
 class ThreadStore;
 class CLREventStatic;
@@ -250,11 +251,26 @@ private:
     // Used for GC.GetTotalAllocatedBytes
     static uint64_t s_DeadThreadsNonAllocBytes;
 
+    // Allocation contexts of dead threads that still have unused space, handed to the next threads that attach
+    // so that short-lived threads don't each have to acquire a new allocation context from the GC.
+    // Only accessed with the thread store lock held.
+    static const uint32_t MaxRecycledAllocContexts = 16;
+    static ee_alloc_context s_RecycledAllocContexts[MaxRecycledAllocContexts];
+    static uint32_t s_RecycledAllocContextCount;
+
 public:
     bool InlineSuspend(NATIVE_CONTEXT* interruptedContext);
 
     static uint64_t GetDeadThreadsNonAllocBytes();
 
+    // Enumerates the recycled allocation contexts so that the GC fixes them together with the ones of live threads.
+    // Executed with thread store lock taken.
+    static void EnumRecycledAllocContexts(enum_alloc_context_func* fn, void* param);
+
+    // Takes over a recycled allocation context, if there is one, for a thread that is attaching.
+    // Executed with thread store lock taken so GC cannot happen.
+    void AdoptRecycledAllocContext();
+
     // First phase of thread destructor, disposes stuff related to GC.
     // Executed with thread store lock taken so GC cannot happen.
     void Detach();
@@ -137,6 +137,12 @@ void ThreadStore::AttachCurrentThread(bool fAcquireThreadStoreLock)
     pAttachingThread->m_ThreadStateFlags = Thread::TSF_Attached;
 
     pTS->m_ThreadList.PushHead(pAttachingThread);
+
+    // GC threads that attach while the GC holds the lock never allocate
+    if (fAcquireThreadStoreLock)
+    {
+        pAttachingThread->AdoptRecycledAllocContext();
+    }
 }
 
 // static
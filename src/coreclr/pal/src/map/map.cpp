@@ -2301,6 +2301,19 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
     // the first "section" for our purposes is the header
     prevSectionEndAligned = ALIGN_UP((char*)loadedHeader + headerSize, GetVirtualPageSize());
 
+    // If PAL_MAP_PE_READAHEAD is set to 1, ask the kernel to read the executable sections in ahead of use,
+    // rather than faulting them in a page at a time. This helps cold starts from slow storage.
+    bool readAheadExecutableSections;
+    readAheadExecutableSections = false;
+    {
+        char* readAhead = EnvironGetenv("PAL_MAP_PE_READAHEAD");
+        if (readAhead != NULL)
+        {
+            readAheadExecutableSections = (strcmp(readAhead, "1") == 0);
+            free(readAhead);
+        }
+    }
+
     for (unsigned i = 0; i < numSections; ++i)
     {
         //for each section, map the section of the file to the correct virtual offset.  Gather the
@@ -2381,6 +2394,14 @@ void * MAPMapPEFile(HANDLE hFile, off_t offset)
             goto doneReleaseMappingCriticalSection;
         }
 
+#ifdef MADV_WILLNEED
+        if (readAheadExecutableSections && ((prot & PROT_EXEC) != 0))
+        {
+            // This is only a hint, a failure does not affect the mapping.
+            madvise(sectionBaseAligned, (char*)sectionBase + currentHeader.SizeOfRawData - (char*)sectionBaseAligned, MADV_WILLNEED);
+        }
+#endif // MADV_WILLNEED
+
 #if _DEBUG
         {
             // Ensure null termination of section name (which is allowed to not be null terminated if exactly 8 characters long)
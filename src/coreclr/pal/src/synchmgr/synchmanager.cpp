@@ -39,6 +39,16 @@ SET_DEFAULT_DEBUG_CHANNEL(SYNC); // some headers have code with asserts, so do t
 #include "pal/fakepoll.h"
 #endif // HAVE_POLL
 
+// On Linux, the per-thread native wait uses the wait predicate directly as a futex word,
+// instead of a condition variable and its mutex
+#if defined(__linux__) && HAVE_CLOCK_MONOTONIC && HAVE_PTHREAD_CONDATTR_SETCLOCK
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 1
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#else
+#define SYNCHMGR_FUTEX_NATIVE_WAIT 0
+#endif
+
 #include <algorithm>
 #include <new>
 
@@ -459,6 +469,41 @@ namespace CorUnix
             }
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Atomically consume the predicate, and block on it while it is not set. When the wait
+        // times out racing with a signaling, the predicate is left set for the next native wait
+        // (see the comments on the condition variable path below, and in BlockThread).
+        while (FALSE == __atomic_exchange_n(&ptnwdNativeWaitData->iPred, FALSE, __ATOMIC_ACQUIRE))
+        {
+            // FUTEX_WAIT_BITSET takes an absolute CLOCK_MONOTONIC timeout, like the
+            // monotonic condition variables used otherwise
+            iRet = syscall(SYS_futex,
+                           &ptnwdNativeWaitData->iPred,
+                           FUTEX_WAIT_BITSET | FUTEX_PRIVATE_FLAG,
+                           FALSE,
+                           (INFINITE == dwTimeout) ? NULL : &tsAbsTmo,
+                           NULL,
+                           FUTEX_BITSET_MATCH_ANY);
+            if (-1 == iRet)
+            {
+                if (ETIMEDOUT == errno)
+                {
+                    _ASSERT_MSG(INFINITE != dwTimeout,
+                                "Got ETIMEDOUT despite timeout being INFINITE\n");
+                    iWaitRet = ETIMEDOUT;
+                    break;
+                }
+                else if (EAGAIN != errno && EINTR != errno)
+                {
+                    ERROR("futex wait returned %d [errno=%d (%s)]\n",
+                           iRet, errno, strerror(errno));
+                    iWaitRet = errno;
+                    palErr = ERROR_INTERNAL_ERROR;
+                    break;
+                }
+            }
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Lock the mutex
         iRet = pthread_mutex_lock(&ptnwdNativeWaitData->mutex);
         if (0 != iRet)
@@ -529,6 +574,7 @@ namespace CorUnix
         }
 
         _ASSERT_MSG(ETIMEDOUT != iRet || INFINITE != dwTimeout, "Got timeout return code with INFINITE timeout\n");
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         if (0 == iWaitRet)
         {
@@ -2175,6 +2221,29 @@ namespace CorUnix
             return ERROR_INTERNAL_ERROR;
         }
 
+#if SYNCHMGR_FUTEX_NATIVE_WAIT
+        // Set the predicate, publishing the wakeup reason and object index
+        // stored by the caller
+        __atomic_store_n(&ptnwdNativeWaitData->iPred, TRUE, __ATOMIC_RELEASE);
+
+        // Wake up the target thread. The mutex is still taken around it
+        // for the sake of the suspension locks (see AcquireSuspensionLocks).
+        iRet = syscall(SYS_futex,
+                       &ptnwdNativeWaitData->iPred,
+                       FUTEX_WAKE_PRIVATE,
+                       1,
+                       NULL,
+                       NULL,
+                       0);
+        if (-1 == iRet)
+        {
+            ERROR("Failed to signal condition: futex wake "
+                  "returned %d [errno=%d (%s)]\n", iRet, errno,
+                  strerror(errno));
+            palErr = ERROR_INTERNAL_ERROR;
+            // Continue in order to unlock the mutex anyway
+        }
+#else // SYNCHMGR_FUTEX_NATIVE_WAIT
         // Set the predicate
         ptnwdNativeWaitData->iPred = TRUE;
 
@@ -2188,6 +2257,7 @@ namespace CorUnix
             palErr = ERROR_INTERNAL_ERROR;
             // Continue in order to unlock the mutex anyway
         }
+#endif // SYNCHMGR_FUTEX_NATIVE_WAIT
 
         // Unlock the mutex
         iRet = pthread_mutex_unlock(&ptnwdNativeWaitData->mutex);
@@ -83,6 +83,7 @@ void CommandLine::DumpHelp(const char* program)
     printf("         h - method hash to uniquely identify a method across MCH files\n");
     printf("         n - method number inside the source MCH\n");
     printf("         t - method throughput time\n");
+    printf("         c - method executed JIT instruction count (requires the JIT to run under an instrumentor)\n");
     printf("         * - all available method stats\n");
     printf("\n");
     printf(" -details <file name.csv>\n");
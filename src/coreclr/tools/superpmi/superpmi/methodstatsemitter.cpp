@@ -33,7 +33,12 @@ MethodStatsEmitter::~MethodStatsEmitter()
     }
 }
 
-void MethodStatsEmitter::Emit(int methodNumber, MethodContext* mc, ULONGLONG firstTime, ULONGLONG secondTime)
+void MethodStatsEmitter::Emit(int            methodNumber,
+                              MethodContext* mc,
+                              ULONGLONG      firstTime,
+                              ULONGLONG      secondTime,
+                              uint64_t       firstInstructions,
+                              uint64_t       secondInstructions)
 {
     if (hStatsFile != INVALID_HANDLE_VALUE)
     {
@@ -83,6 +88,12 @@ void MethodStatsEmitter::Emit(int methodNumber, MethodContext* mc, ULONGLONG fir
             charCount +=
                 sprintf_s(rowData + charCount, ARRAY_SIZE(rowData) - charCount, "%llu,%llu,", firstTime, secondTime);
         }
+        if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 'c') != NULL || strchr(statsTypes, 'C') != NULL)
+        {
+            // Only non-zero when the JIT is run under an instrumentor (e.g. SPMI_ENABLE_INSTRUMENTATION with Pin)
+            charCount += sprintf_s(rowData + charCount, ARRAY_SIZE(rowData) - charCount, "%llu,%llu,",
+                                   (unsigned long long)firstInstructions, (unsigned long long)secondInstructions);
+        }
 
         // get rid of the final ',' and replace it with a '\n'
         rowData[charCount - 1] = '\n';
@@ -115,6 +126,8 @@ void MethodStatsEmitter::SetStatsTypes(char* types)
             charCount += sprintf_s(rowHeader + charCount, ARRAY_SIZE(rowHeader) - charCount, "ASM_CODE_SIZE,");
         if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 't') != NULL || strchr(statsTypes, 'T') != NULL)
             charCount += sprintf_s(rowHeader + charCount, ARRAY_SIZE(rowHeader) - charCount, "Time1,Time2,");
+        if (strchr(statsTypes, '*') != NULL || strchr(statsTypes, 'c') != NULL || strchr(statsTypes, 'C') != NULL)
+            charCount += sprintf_s(rowHeader + charCount, ARRAY_SIZE(rowHeader) - charCount, "Instructions1,Instructions2,");
 
         // get rid of the final ',' and replace it with a '\n'
         rowHeader[charCount - 1] = '\n';
@@ -21,7 +21,12 @@ public:
     MethodStatsEmitter(char* nameOfInput);
     ~MethodStatsEmitter();
 
-    void Emit(int methodNumber, MethodContext* mc, ULONGLONG firstTime, ULONGLONG secondTime);
+    void Emit(int            methodNumber,
+              MethodContext* mc,
+              ULONGLONG      firstTime,
+              ULONGLONG      secondTime,
+              uint64_t       firstInstructions,
+              uint64_t       secondInstructions);
     void SetStatsTypes(char* types);
 };
 
@@ -624,7 +624,8 @@ int __cdecl main(int argc, char* argv[])
                         if (methodStatsEmitter != nullptr)
                         {
                             methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, crl->clockCyclesToCompile,
-                                                     mc->cr->clockCyclesToCompile);
+                                                     mc->cr->clockCyclesToCompile, res.NumExecutedInstructions,
+                                                     res2.NumExecutedInstructions);
                         }
                     }
                     else
@@ -635,7 +636,8 @@ int __cdecl main(int argc, char* argv[])
                             mc->cr->clockCyclesToCompile = jit->times[0];
                         if (methodStatsEmitter != nullptr)
                         {
-                            methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, mc->cr->clockCyclesToCompile, 0);
+                            methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, mc->cr->clockCyclesToCompile, 0,
+                                                     res.NumExecutedInstructions, 0);
                         }
                     }
                 }
@@ -643,7 +645,8 @@ int __cdecl main(int argc, char* argv[])
                 if (!collectThroughput && methodStatsEmitter != nullptr)
                 {
                     // We have a separate call to Emit for collectThroughput
-                    methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, -1, -1);
+                    methodStatsEmitter->Emit(reader->GetMethodContextIndex(), mc, -1, -1, res.NumExecutedInstructions,
+                                             res2.NumExecutedInstructions);
                 }
 
                 if (o.applyDiff)
@@ -20,13 +20,9 @@ bool ExecutableAllocator::g_isWXorXEnabled = false;
 ExecutableAllocator::FatalErrorHandler ExecutableAllocator::g_fatalErrorHandler = NULL;
 ExecutableAllocator* ExecutableAllocator::g_instance = NULL;
 
-#ifndef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-#define EXECUTABLE_ALLOCATOR_CACHE_SIZE ARRAY_SIZE(m_cachedMapping)
-#else
 int ExecutableAllocator::g_cachedMappingSize = 0;
 
 #define EXECUTABLE_ALLOCATOR_CACHE_SIZE ExecutableAllocator::g_cachedMappingSize
-#endif
 
 #ifdef LOG_EXECUTABLE_ALLOCATOR_STATISTICS
 int64_t ExecutableAllocator::g_mapTimeSum = 0;
@@ -241,24 +237,13 @@ HRESULT ExecutableAllocator::StaticInitialize(FatalErrorHandler fatalErrorHandle
 {
     LIMITED_METHOD_CONTRACT;
 
-#ifdef VARIABLE_SIZED_CACHEDMAPPING_SIZE
-    g_cachedMappingSize = ARRAY_SIZE(m_cachedMapping);
-    auto envString = getenv("EXECUTABLE_ALLOCATOR_CACHE_SIZE");
-    if (envString != NULL)
+    // Out of range values fall back to the default size
+    DWORD cachedMappingSize = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_WriteXorExecuteMappingCacheSize);
+    if ((cachedMappingSize == 0) || (cachedMappingSize > ARRAY_SIZE(m_cachedMapping)))
     {
-        int customCacheSize = atoi(envString);
-        if (customCacheSize != 0)
-        {
-            if ((customCacheSize > ARRAY_SIZE(m_cachedMapping)) || (customCacheSize <= 0))
-            {
-                printf("Invalid value in 'EXECUTABLE_ALLOCATOR_CACHE_SIZE' environment variable'\n");
-                return E_FAIL;
-            }
-            
-            g_cachedMappingSize = customCacheSize;
-        }
+        cachedMappingSize = CLRConfig::UNSUPPORTED_WriteXorExecuteMappingCacheSize.defaultValue;
     }
-#endif
+    g_cachedMappingSize = (int)cachedMappingSize;
 
     g_fatalErrorHandler = fatalErrorHandler;
     g_isWXorXEnabled = Configuration::GetKnobBooleanValue(W("System.Runtime.EnableWriteXorExecute"), CLRConfig::EXTERNAL_EnableWriteXorExecute);
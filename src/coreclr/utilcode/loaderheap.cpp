@@ -934,6 +934,108 @@ UnlockedLoaderHeap::UnlockedLoaderHeap(DWORD dwReserveBlockSize,
     }
 }
 
+//
+// Reservations released by destroyed loader heaps (for instance when a collectible LoaderAllocator is
+// unloaded) are decommitted and cached here, so that loader heaps created later can reuse
+// them instead of reserving more address space. Only the physical memory is returned to the OS
+// at unload; the cache is bounded so that at most a few reservations are kept.
+//
+#define LOADERHEAP_RESERVATION_CACHE_SIZE 16
+
+static LoaderHeapBlock *s_reservationCache[LOADERHEAP_RESERVATION_CACHE_SIZE];
+static CRITSEC_COOKIE s_reservationCacheLock = NULL;
+
+// Returns the lock protecting s_reservationCache, creating it on first use, or NULL if it could not be created
+static CRITSEC_COOKIE GetReservationCacheLock()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (s_reservationCacheLock == NULL)
+    {
+        // Loader heaps are created and destroyed in any GC mode, and the lock is not held across any other lock
+        CRITSEC_COOKIE lock = ClrCreateCriticalSection(CrstLeafLock, CRST_UNSAFE_ANYMODE);
+        if (lock != NULL)
+        {
+            if (InterlockedCompareExchangeT(&s_reservationCacheLock, lock, NULL) != NULL)
+            {
+                ClrDeleteCriticalSection(lock);
+            }
+        }
+    }
+
+    return s_reservationCacheLock;
+}
+
+// Decommits the reservation described by pBlock and adds it to the cache. Returns FALSE if the
+// reservation could not be cached, in which case the caller still owns it and must release it.
+static BOOL TryCacheReservation(LoaderHeapBlock *pBlock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef HOST_APPLE
+    // Decommitting would drop the MAP_JIT flag of executable reservations
+    return FALSE;
+#else // HOST_APPLE
+    // Double mapped memory cannot be decommitted in place
+    if (ExecutableAllocator::IsWXORXEnabled())
+    {
+        return FALSE;
+    }
+
+    CRITSEC_COOKIE lock = GetReservationCacheLock();
+    if (lock == NULL)
+    {
+        return FALSE;
+    }
+
+    CRITSEC_Holder lockHolder(lock);
+
+    for (int i = 0; i < LOADERHEAP_RESERVATION_CACHE_SIZE; i++)
+    {
+        if (s_reservationCache[i] == NULL)
+        {
+            if (!ClrVirtualFree(pBlock->pVirtualAddress, pBlock->dwVirtualSize, MEM_DECOMMIT))
+            {
+                return FALSE;
+            }
+
+            pBlock->pNext = NULL;
+            s_reservationCache[i] = pBlock;
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+#endif // HOST_APPLE
+}
+
+// Removes a cached reservation of exactly dwSizeToReserve bytes from the cache, or returns NULL if there is none.
+static LoaderHeapBlock *TryTakeCachedReservation(size_t dwSizeToReserve)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Nothing can have been cached before the lock exists
+    CRITSEC_COOKIE lock = s_reservationCacheLock;
+    if (lock == NULL)
+    {
+        return NULL;
+    }
+
+    CRITSEC_Holder lockHolder(lock);
+
+    for (int i = 0; i < LOADERHEAP_RESERVATION_CACHE_SIZE; i++)
+    {
+        LoaderHeapBlock *pBlock = s_reservationCache[i];
+        if (pBlock != NULL && pBlock->dwVirtualSize == dwSizeToReserve)
+        {
+            s_reservationCache[i] = NULL;
+            return pBlock;
+        }
+    }
+
+    return NULL;
+}
+
 // ~LoaderHeap is not synchronised (obviously)
 UnlockedLoaderHeap::~UnlockedLoaderHeap()
 {
@@ -961,6 +1063,11 @@ UnlockedLoaderHeap::~UnlockedLoaderHeap()
 
         if (fReleaseMemory)
         {
+            if (TryCacheReservation(pSearch))
+            {
+                continue;
+            }
+
             ExecutableAllocator::Instance()->Release(pVirtualAddress);
         }
 
@@ -1082,6 +1189,7 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
 
     ReservedMemoryHolder pData = NULL;
     BOOL fReleaseMemory = TRUE;
+    NewHolder<LoaderHeapBlock> pNewBlock = NULL;
 
     // We were provided with a reserved memory block at instance creation time, so use it if it's big enough.
     if (m_reservedBlock.pVirtualAddress != NULL &&
@@ -1111,17 +1219,26 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
 
         _ASSERTE(dwSizeToCommit <= dwSizeToReserve);
 
-        //
-        // Reserve pages
-        //
-
-        // Reserve the memory for even non-executable stuff close to the executable code, as it has profound effect
-        // on e.g. a static variable access performance.
-        pData = (BYTE *)ExecutableAllocator::Instance()->Reserve(dwSizeToReserve);
-        if (pData == NULL)
+        // Reuse a reservation that was released by a destroyed loader heap if one of the right size is available
+        pNewBlock = TryTakeCachedReservation(dwSizeToReserve);
+        if (pNewBlock != NULL)
         {
-            _ASSERTE(!"Unable to reserve memory range for a loaderheap");
-            return FALSE;
+            pData = (PTR_BYTE)pNewBlock->pVirtualAddress;
+        }
+        else
+        {
+            //
+            // Reserve pages
+            //
+
+            // Reserve the memory for even non-executable stuff close to the executable code, as it has profound effect
+            // on e.g. a static variable access performance.
+            pData = (BYTE *)ExecutableAllocator::Instance()->Reserve(dwSizeToReserve);
+            if (pData == NULL)
+            {
+                _ASSERTE(!"Unable to reserve memory range for a loaderheap");
+                return FALSE;
+            }
         }
     }
 
@@ -1149,10 +1266,13 @@ BOOL UnlockedLoaderHeap::UnlockedReservePages(size_t dwSizeToCommit)
         return FALSE;
     }
 
-    NewHolder<LoaderHeapBlock> pNewBlock = new (nothrow) LoaderHeapBlock;
     if (pNewBlock == NULL)
     {
-        return FALSE;
+        pNewBlock = new (nothrow) LoaderHeapBlock;
+        if (pNewBlock == NULL)
+        {
+            return FALSE;
+        }
     }
 
     // Record reserved range in range list, if one is specified
@@ -0,0 +1,405 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: AssemblyPrefetch.cpp
+//
+// ===========================================================================
+
+#include "common.h"
+#include "assemblyprefetch.h"
+#include "peimage.h"
+#include "bundle.h"
+#include "stringarraylist.h"
+
+// Profile layout: ProfileHeader, followed by ProfileHeader::count entries of { DWORD length; WCHAR path[length]; }
+#define ASSEMBLY_PREFETCH_PROFILE_MAGIC 0x50465041 // 'APFP'
+#define ASSEMBLY_PREFETCH_PROFILE_VERSION 1
+
+namespace
+{
+    struct ProfileHeader
+    {
+        DWORD magic;
+        DWORD version;
+        DWORD count;
+    };
+}
+
+CrstStatic AssemblyPrefetcher::s_lock;
+SString* AssemblyPrefetcher::s_pProfilePath;
+bool AssemblyPrefetcher::s_isRecording;
+bool AssemblyPrefetcher::s_isProfileStale;
+StringArrayList* AssemblyPrefetcher::s_pRecordedPaths;
+StringArrayList* AssemblyPrefetcher::s_pPrefetchPaths;
+SArray<PEImage*>* AssemblyPrefetcher::s_pPrefetchedImages;
+COUNT_T AssemblyPrefetcher::s_unclaimedImageCount;
+CLREvent* AssemblyPrefetcher::s_pAllImagesClaimed;
+
+void AssemblyPrefetcher::StaticInitialize()
+{
+    STANDARD_VM_CONTRACT;
+
+    NewArrayHolder<WCHAR> profilePath(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_AssemblyPrefetchProfile));
+    if (profilePath == NULL || *profilePath == W('\0'))
+        return;
+
+    // Bundled assemblies are mapped from the bundle that the host has already opened
+    if (Bundle::AppIsBundle())
+        return;
+
+    s_lock.Init(CrstLeafLock);
+    s_pProfilePath = new SString(profilePath);
+
+    // The load order is always recorded, so that a profile that no longer matches what the app
+    // loads is refreshed at shutdown
+    s_pRecordedPaths = new StringArrayList();
+    s_isRecording = true;
+
+    NewHolder<StringArrayList> pPaths(new StringArrayList());
+    HRESULT hr = ReadProfile(s_pProfilePath->GetUnicode(), pPaths);
+    if (FAILED(hr))
+    {
+        // A missing or truncated profile is (re)recorded during this run
+        s_isProfileStale = true;
+        return;
+    }
+
+    s_pPrefetchPaths = pPaths.Extract();
+
+    // Prefetching only pays off when there is another core to do it on
+    if (s_pPrefetchPaths->GetCount() == 0 || g_SystemInfo.dwNumberOfProcessors < 2)
+        return;
+
+    s_pPrefetchedImages = new SArray<PEImage*>();
+    s_pAllImagesClaimed = new CLREvent();
+    s_pAllImagesClaimed->CreateManualEvent(FALSE);
+
+    EX_TRY
+    {
+        StartPrefetchThread();
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
+HRESULT AssemblyPrefetcher::ReadProfile(LPCWSTR pFileName, StringArrayList* pPaths)
+{
+    STANDARD_VM_CONTRACT;
+
+    HandleHolder hFile(WszCreateFile(pFileName, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL));
+    if (hFile == INVALID_HANDLE_VALUE)
+        return COR_E_FILENOTFOUND;
+
+    DWORD fileSize = SafeGetFileSize(hFile, NULL);
+    if (fileSize == 0xffffffff || fileSize < sizeof(ProfileHeader))
+        return COR_E_BADIMAGEFORMAT;
+
+    NewArrayHolder<BYTE> pBuffer(new BYTE[fileSize]);
+    DWORD cbRead = 0;
+    if (!::ReadFile(hFile, pBuffer, fileSize, &cbRead, NULL) || cbRead != fileSize)
+        return CLDB_E_FILE_BADREAD;
+
+    ProfileHeader* pHeader = (ProfileHeader*)(BYTE*)pBuffer;
+    if (pHeader->magic != ASSEMBLY_PREFETCH_PROFILE_MAGIC
+        || pHeader->version != ASSEMBLY_PREFETCH_PROFILE_VERSION
+        || pHeader->count > MaxRecordedImages)
+    {
+        return COR_E_BADIMAGEFORMAT;
+    }
+
+    DWORD offset = sizeof(ProfileHeader);
+    for (DWORD i = 0; i < pHeader->count; i++)
+    {
+        DWORD length;
+        if (fileSize - offset < sizeof(length))
+            return COR_E_BADIMAGEFORMAT;
+
+        memcpy(&length, pBuffer + offset, sizeof(length));
+        offset += sizeof(length);
+
+        if (length == 0 || length > (fileSize - offset) / sizeof(WCHAR))
+            return COR_E_BADIMAGEFORMAT;
+
+        SString path;
+        path.Set((const WCHAR*)(pBuffer + offset), length);
+        offset += length * sizeof(WCHAR);
+
+        pPaths->Append(path);
+    }
+
+    return S_OK;
+}
+
+static bool ContainsPath(StringArrayList* pPaths, const SString& path)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    for (DWORD i = 0; i < pPaths->GetCount(); i++)
+    {
+        if (pPaths->Get(i).Equals(path))
+            return true;
+    }
+
+    return false;
+}
+
+void AssemblyPrefetcher::RecordImageAcquire(PEImage* pImage)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!s_isRecording || !pImage->IsFile() || pImage->IsInBundle())
+        return;
+
+    bool claimed = false;
+    EX_TRY
+    {
+        CrstHolder lock(&s_lock);
+
+        if (s_isRecording && s_pRecordedPaths->GetCount() < MaxRecordedImages)
+            s_pRecordedPaths->AppendIfNotThere(pImage->GetPath());
+
+        claimed = TryClaimPrefetchedImage(pImage);
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    // The binder holds its own reference now. Releasing can take the PEImage cache lock, so it
+    // is done outside of ours.
+    if (claimed)
+        pImage->Release();
+}
+
+bool AssemblyPrefetcher::TryClaimPrefetchedImage(PEImage* pImage)
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(s_lock.OwnedByCurrentThread());
+
+    if (s_pPrefetchedImages == NULL)
+        return false;
+
+    for (COUNT_T i = 0; i < s_pPrefetchedImages->GetCount(); i++)
+    {
+        if ((*s_pPrefetchedImages)[i] == pImage)
+        {
+            (*s_pPrefetchedImages)[i] = NULL;
+            if (--s_unclaimedImageCount == 0)
+                s_pAllImagesClaimed->Set();
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool AssemblyPrefetcher::RecordedOrderMatchesProfile()
+{
+    LIMITED_METHOD_CONTRACT;
+    _ASSERTE(s_lock.OwnedByCurrentThread());
+
+    if (s_pPrefetchPaths == NULL || s_pPrefetchPaths->GetCount() != s_pRecordedPaths->GetCount())
+        return false;
+
+    for (DWORD i = 0; i < s_pRecordedPaths->GetCount(); i++)
+    {
+        if (!s_pRecordedPaths->Get(i).Equals(s_pPrefetchPaths->Get(i)))
+            return false;
+    }
+
+    return true;
+}
+
+void AssemblyPrefetcher::WriteProfile()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!s_isRecording)
+        return;
+
+    EX_TRY
+    {
+        CrstHolder lock(&s_lock);
+
+        // Only the first shutdown writes the profile
+        s_isRecording = false;
+
+        // Leave a profile that still matches alone, and refresh one with entries that failed
+        // to prefetch or that no longer reflects what the app loads
+        if (!s_isProfileStale && RecordedOrderMatchesProfile())
+            return;
+
+        HandleHolder hFile(WszCreateFile(s_pProfilePath->GetUnicode(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL));
+        if (hFile != INVALID_HANDLE_VALUE)
+        {
+            ProfileHeader header = { ASSEMBLY_PREFETCH_PROFILE_MAGIC, ASSEMBLY_PREFETCH_PROFILE_VERSION, s_pRecordedPaths->GetCount() };
+
+            // A failed write leaves a truncated profile behind, which the next run rejects and records again
+            DWORD cbWritten;
+            BOOL success = ::WriteFile(hFile, &header, sizeof(header), &cbWritten, NULL);
+            for (DWORD i = 0; success && i < s_pRecordedPaths->GetCount(); i++)
+            {
+                const SString& path = s_pRecordedPaths->Get(i);
+                DWORD length = path.GetCount();
+
+                success = ::WriteFile(hFile, &length, sizeof(length), &cbWritten, NULL)
+                    && ::WriteFile(hFile, path.GetUnicode(), length * sizeof(WCHAR), &cbWritten, NULL);
+            }
+        }
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+}
+
+void AssemblyPrefetcher::StartPrefetchThread()
+{
+    STANDARD_VM_CONTRACT;
+
+    Thread* pThread = SetupUnstartedThread();
+    _ASSERTE(pThread != NULL);
+
+    pThread->SetBackground(TRUE);
+
+    if (!pThread->CreateNewThread(0, PrefetchThreadStart, pThread, W(".NET Assembly Prefetch")))
+    {
+        pThread->DecExternalCount(FALSE);
+        ThrowOutOfMemory();
+    }
+
+    pThread->StartThread();
+}
+
+DWORD WINAPI AssemblyPrefetcher::PrefetchThreadStart(LPVOID args)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_ANY;
+        ENTRY_POINT;
+    }
+    CONTRACTL_END;
+
+    Thread* pThread = (Thread*)args;
+    if (pThread->HasStarted())
+    {
+        // Disable calling managed code in background thread
+        ThreadStateNCStackHolder holder(TRUE, Thread::TSNC_CallingManagedCodeDisabled);
+
+        PrefetchImages();
+        ReleaseUnclaimedImages();
+    }
+
+    DestroyThread(pThread);
+    return 0;
+}
+
+void AssemblyPrefetcher::PrefetchImages()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    for (DWORD i = 0; i < s_pPrefetchPaths->GetCount(); i++)
+    {
+        // An entry that can no longer be opened or mapped is skipped, the binder will report
+        // any failure when the assembly is actually requested. The profile is re-recorded so
+        // that later runs don't keep trying it.
+        bool failed = true;
+        EX_TRY
+        {
+            PEImageHolder pImage(PEImage::OpenImage(s_pPrefetchPaths->Get(i).GetUnicode(), MDInternalImport_Default));
+            if (SUCCEEDED(pImage->TryOpenFile()))
+            {
+                // Creates the same layout the binder would and touches the ReadyToRun header
+                PEImageLayout* pLayout = pImage->GetOrCreateLayout(PEImageLayout::LAYOUT_ANY);
+                if (pLayout->CheckCorHeader())
+                    pLayout->HasReadyToRunHeader();
+
+                failed = false;
+
+                // The binder may already have acquired the image, in which case we don't keep it
+                CrstHolder lock(&s_lock);
+                if (!ContainsPath(s_pRecordedPaths, pImage->GetPath()))
+                {
+                    s_pPrefetchedImages->Append(pImage.Extract());
+                    s_unclaimedImageCount++;
+                }
+            }
+        }
+        EX_CATCH
+        {
+        }
+        EX_END_CATCH(SwallowAllExceptions);
+
+        if (failed)
+        {
+            CrstHolder lock(&s_lock);
+            s_isProfileStale = true;
+        }
+    }
+}
+
+void AssemblyPrefetcher::ReleaseUnclaimedImages()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    // Images the binder asks for are released as it acquires them. Give it until the end of startup
+    // to ask for the rest, then release them so they don't stay mapped for the life of the process.
+    {
+        CrstHolder lock(&s_lock);
+        if (s_unclaimedImageCount == 0)
+            s_pAllImagesClaimed->Set();
+    }
+
+    s_pAllImagesClaimed->Wait(UnclaimedImageReleaseDelayMs, FALSE);
+
+    InlineSArray<PEImage*, 16> unclaimed;
+    EX_TRY
+    {
+        CrstHolder lock(&s_lock);
+        for (COUNT_T i = 0; i < s_pPrefetchedImages->GetCount(); i++)
+        {
+            PEImage* pImage = (*s_pPrefetchedImages)[i];
+            if (pImage != NULL)
+                unclaimed.Append(pImage);
+        }
+
+        s_pPrefetchedImages->Clear();
+        s_unclaimedImageCount = 0;
+    }
+    EX_CATCH
+    {
+    }
+    EX_END_CATCH(SwallowAllExceptions);
+
+    for (COUNT_T i = 0; i < unclaimed.GetCount(); i++)
+        unclaimed[i]->Release();
+}
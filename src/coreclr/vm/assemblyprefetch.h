@@ -0,0 +1,61 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: AssemblyPrefetch.h
+//
+// ===========================================================================
+
+#ifndef ASSEMBLY_PREFETCH_H
+#define ASSEMBLY_PREFETCH_H
+
+class PEImage;
+class StringArrayList;
+
+// AssemblyPrefetcher takes assembly image opening and mapping off the startup path.
+//
+// When DOTNET_AssemblyPrefetchProfile is set, the order in which the binder first acquires images is recorded
+// and written to that file at shutdown, unless the file already holds the same order. On later startups, a
+// background thread walks the recorded order and opens and maps each image through the PEImage cache,
+// so that by the time the binder asks for an assembly its file is already open and its layout created.
+// Each prefetched image is released once the binder has acquired it, and any the binder has not asked
+// for by the end of startup are released then. A profile with entries that fail to prefetch, or that no
+// longer matches the order the app loads images in, is recorded again.
+class AssemblyPrefetcher
+{
+public:
+    static void StaticInitialize();
+
+    // Called by the binder when it acquires an image
+    static void RecordImageAcquire(PEImage* pImage);
+
+    // Called during shutdown to persist the recorded load order
+    static void WriteProfile();
+
+private:
+    static HRESULT ReadProfile(LPCWSTR pFileName, StringArrayList* pPaths);
+    static void StartPrefetchThread();
+    static DWORD WINAPI PrefetchThreadStart(LPVOID args);
+    static void PrefetchImages();
+    static void ReleaseUnclaimedImages();
+    static bool TryClaimPrefetchedImage(PEImage* pImage);
+    static bool RecordedOrderMatchesProfile();
+
+private:
+    static const DWORD MaxRecordedImages = 4096;
+    static const DWORD UnclaimedImageReleaseDelayMs = 30 * 1000;
+
+    static CrstStatic s_lock;
+    static SString* s_pProfilePath;
+    static bool s_isRecording;
+    static bool s_isProfileStale;
+    static StringArrayList* s_pRecordedPaths;
+    static StringArrayList* s_pPrefetchPaths;
+
+    // Prefetched images are kept alive until the binder acquires them, so that it finds them in the PEImage
+    // cache. Claimed entries are set to NULL.
+    static SArray<PEImage*>* s_pPrefetchedImages;
+    static COUNT_T s_unclaimedImageCount;
+    static CLREvent* s_pAllImagesClaimed;
+};
+
+#endif // ASSEMBLY_PREFETCH_H
@@ -12,6 +12,7 @@
 BASEARRAYREF* CastCache::s_pTableRef = NULL;
 OBJECTHANDLE CastCache::s_sentinelTable = NULL;
 DWORD CastCache::s_lastFlushSize     = INITIAL_CACHE_SIZE;
+DWORD CastCache::s_maximumCacheSize  = MAXIMUM_CACHE_SIZE;
 const DWORD CastCache::INITIAL_CACHE_SIZE;
 
 BASEARRAYREF CastCache::CreateCastCache(DWORD size)
@@ -125,6 +126,19 @@ void CastCache::Initialize()
     }
     CONTRACTL_END;
 
+    DWORD configuredMaximumSize = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_CastCacheMaximumSize);
+    if (configuredMaximumSize != 0)
+    {
+        // round up to a power of two, which the table layout requires
+        DWORD maximumSize = INITIAL_CACHE_SIZE;
+        while ((maximumSize < configuredMaximumSize) && (maximumSize < MAXIMUM_CONFIGURED_CACHE_SIZE))
+        {
+            maximumSize *= 2;
+        }
+
+        s_maximumCacheSize = maximumSize;
+    }
+
     FieldDesc* pTableField = CoreLibBinder::GetField(FIELD__CASTCACHE__TABLE);
 
     GCX_COOP();
@@ -188,6 +188,10 @@ private:
     static const DWORD MAXIMUM_CACHE_SIZE = 4096; // 4096 * sizeof(CastCacheEntry) is 98304 bytes on 64bit. We will rarely need this much though.
 #endif
 
+// Upper bound for the CastCacheMaximumSize setting. Apps that check casts against thousands of
+// types can raise the limit so that hot entries are not continually evicted.
+    static const DWORD MAXIMUM_CONFIGURED_CACHE_SIZE = 1 << 20;
+
 // Lower bucket size will cause the table to resize earlier
 // Higher bucket size will increase upper bound cost of Get
 //
@@ -206,6 +210,9 @@ private:
 
     static DWORD          s_lastFlushSize;
 
+    // MAXIMUM_CACHE_SIZE unless overridden by CastCacheMaximumSize
+    static DWORD          s_maximumCacheSize;
+
     FORCEINLINE static TypeHandle::CastResult TryGetFromCache(TADDR source, TADDR target)
     {
         CONTRACTL
@@ -251,7 +258,7 @@ private:
         CONTRACTL_END;
 
         DWORD newSize = CacheElementCount(tableData) * 2;
-        if (newSize <= MAXIMUM_CACHE_SIZE)
+        if (newSize <= s_maximumCacheSize)
         {
             return MaybeReplaceCacheWithLarger(newSize);
         }
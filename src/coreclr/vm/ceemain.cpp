@@ -162,6 +162,8 @@
 #include "jithost.h"
 #include "pgo.h"
 #include "pendingload.h"
+#include "assemblyprefetch.h"
+#include "runtimemetrics.h"
 #include "cdacplatformmetadata.hpp"
 
 #ifndef TARGET_UNIX
@@ -642,6 +644,8 @@ void EEStartupHelper()
 
         IfFailGo(EEConfig::Setup());
 
+        CrstBase::InitializeContentionStats();
+
 
 #ifdef HOST_WINDOWS
         InitializeCrashDump();
@@ -805,6 +809,8 @@ void EEStartupHelper()
 
         InitializeGarbageCollector();
 
+        RuntimeMetrics::StaticInitialize();
+
         if (!GCHandleUtilities::GetGCHandleManager()->Initialize())
         {
             IfFailGo(E_OUTOFMEMORY);
@@ -934,6 +940,8 @@ void EEStartupHelper()
 
         SystemDomain::System()->Init();
 
+        AssemblyPrefetcher::StaticInitialize();
+
 #ifdef PROFILING_SUPPORTED
         // <TODO>This is to compensate for the DefaultDomain workaround contained in
         // SystemDomain::Attach in which the first user domain is created before profiling
@@ -1519,6 +1527,10 @@ void STDMETHODCALLTYPE EEShutDown(BOOL fIsDllUnloading)
 #ifdef FEATURE_MULTICOREJIT
         MulticoreJitManager::StopProfileAll();
 #endif
+
+        AssemblyPrefetcher::WriteProfile();
+
+        CrstBase::WriteContentionStats();
     }
 
     if (GetThreadNULLOk())
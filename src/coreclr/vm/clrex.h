@@ -56,6 +56,8 @@ struct StackTraceElement
 
 class StackTraceInfo
 {
+    static const size_t InitialStackTraceCapacity = 8;
+
     static OBJECTREF GetKeepAliveObject(MethodDesc* pMethod);
     static void EnsureStackTraceArray(StackTraceArray *pStackTrace, size_t neededSize);
     static void EnsureKeepAliveArray(PTRARRAYREF *ppKeepAliveArray, size_t neededSize);
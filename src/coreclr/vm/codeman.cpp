@@ -2456,6 +2456,11 @@ HeapList* LoaderCodeHeap::CreateCodeHeap(CodeHeapRequestInfo *pInfo, LoaderHeap
 
     pHp->pLoaderAllocator = pInfo->m_pAllocator;
 
+#ifdef FEATURE_JIT_COLD_CODE
+    pHp->coldCodeAllocPtr = 0;
+    pHp->coldCodeLimit    = 0;
+#endif
+
     LOG((LF_JIT, LL_INFO100,
          "Created new CodeHeap(" FMT_ADDR ".." FMT_ADDR ")\n",
          DBG_ADDR(pHp->startAddress), DBG_ADDR(pHp->startAddress+pHp->maxCodeHeapSize)
@@ -2504,6 +2509,7 @@ void CodeHeapRequestInfo::Init()
         m_pAllocator = m_pMD->GetLoaderAllocator();
     m_isDynamicDomain = (m_pMD != NULL) && m_pMD->IsLCGMethod();
     m_isCollectible = m_pAllocator->IsCollectible();
+    m_isTier1 = false;
     m_throwOnOutOfMemoryWithinRange = true;
 }
 
@@ -2619,6 +2625,8 @@ HeapList* EEJitManager::NewCodeHeap(CodeHeapRequestInfo *pInfo, DomainCodeHeapLi
     _ASSERTE (pHp != NULL);
     _ASSERTE (pHp->maxCodeHeapSize >= initialRequestSize);
 
+    pHp->isTier1 = pInfo->IsTier1();
+
     pHp->SetNext(GetCodeHeapList());
 
     EX_TRY
@@ -2689,6 +2697,11 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap;
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = NULL;
     }
+    else if (pInfo->IsTier1())
+    {
+        pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedTier1CodeHeap;
+        pInfo->m_pAllocator->m_pLastUsedTier1CodeHeap = NULL;
+    }
     else
     {
         pCodeHeap = (HeapList *)pInfo->m_pAllocator->m_pLastUsedCodeHeap;
@@ -2749,6 +2762,10 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     {
         pInfo->m_pAllocator->m_pLastUsedDynamicCodeHeap = pCodeHeap;
     }
+    else if (pInfo->IsTier1())
+    {
+        pInfo->m_pAllocator->m_pLastUsedTier1CodeHeap = pCodeHeap;
+    }
     else
     {
         pInfo->m_pAllocator->m_pLastUsedCodeHeap = pCodeHeap;
@@ -2768,11 +2785,98 @@ void* EEJitManager::allocCodeRaw(CodeHeapRequestInfo *pInfo,
     RETURN(mem);
 }
 
-void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+#ifdef FEATURE_JIT_COLD_CODE
+
+// The cold parts of split methods are packed into chunks of this size carved from
+// the code heap of the hot part, so that they do not dilute the hot code around them.
+#define COLD_CODE_CHUNK_SIZE (64 * 1024)
+
+// Every cold part starts on its own nibble map bucket, right after its header.
+#define COLD_CODE_ALLOC_SIZE(coldCodeSize) \
+    (ALIGN_UP(sizeof(ColdCodeHeader) + (coldCodeSize), BYTES_PER_BUCKET) + BYTES_PER_BUCKET)
+
+// Worst case the code heap needs to provide for an exact fit allocation of the cold
+// part, including the alignment and nibble map padding of the heap.
+#define COLD_CODE_RESERVE_SIZE(coldCodeSize) \
+    (COLD_CODE_ALLOC_SIZE(coldCodeSize) + 2 * BYTES_PER_BUCKET)
+
+static bool IsColdCodeInRange(TADDR hotCode, size_t hotCodeSize, TADDR coldCode, size_t coldCodeSize)
+{
+    LIMITED_METHOD_CONTRACT;
+
+#ifdef TARGET_ARM64
+    // Branches between the hot and the cold part are emitted as B/BL (+/-128MB)
+    TADDR lo = min(hotCode, coldCode);
+    TADDR hi = max(hotCode + hotCodeSize, coldCode + coldCodeSize);
+    return (hi - lo) < (128 * 1024 * 1024);
+#else
+    // A single code heap is always within rel32 range
+    return true;
+#endif
+}
+
+//*****************************************************************************
+// Allocates the cold part of a split method from the code heap that holds its hot
+// part. The caller reserved enough space in the heap for an exact fit allocation,
+// so this only fails if the reservation was insufficient.
+//*****************************************************************************
+ColdCodeHeader* EEJitManager::allocColdCode(HeapList *pCodeHeap, TADDR hotCode, size_t hotCodeSize, size_t coldCodeSize)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        PRECONDITION(m_CodeHeapCritSec.OwnedByCurrentThread());
+    } CONTRACTL_END;
+
+    TADDR pCode = ALIGN_UP(pCodeHeap->coldCodeAllocPtr + sizeof(ColdCodeHeader), BYTES_PER_BUCKET);
+
+    if ((pCodeHeap->coldCodeAllocPtr == 0) ||
+        (pCode + coldCodeSize > pCodeHeap->coldCodeLimit) ||
+        !IsColdCodeInRange(hotCode, hotCodeSize, pCode, coldCodeSize))
+    {
+        size_t exactSize = COLD_CODE_ALLOC_SIZE(coldCodeSize);
+        size_t chunkSize = max((size_t)COLD_CODE_CHUNK_SIZE, exactSize);
+
+        // The chunk is allocated without a reserve so that it does not eat into the
+        // space set aside for the exact fit
+        TADDR pChunk = (TADDR)pCodeHeap->pHeap->AllocMemForCode_NoThrow(0, chunkSize, BYTES_PER_BUCKET, 0);
+        if (pChunk == 0)
+        {
+            chunkSize = exactSize;
+            pChunk = (TADDR)pCodeHeap->pHeap->AllocMemForCode_NoThrow(0, chunkSize, BYTES_PER_BUCKET, 0);
+            if (pChunk == 0)
+                return NULL;
+        }
+
+        _ASSERTE(pChunk >= pCodeHeap->startAddress);
+
+        if (pChunk + chunkSize > (TADDR)pCodeHeap->endAddress)
+        {
+            // Update the CodeHeap endAddress
+            pCodeHeap->endAddress = pChunk + chunkSize;
+        }
+
+        pCodeHeap->coldCodeLimit = pChunk + chunkSize;
+        pCode = ALIGN_UP(pChunk + sizeof(ColdCodeHeader), BYTES_PER_BUCKET);
+
+        _ASSERTE(pCode + coldCodeSize <= pCodeHeap->coldCodeLimit);
+    }
+
+    pCodeHeap->coldCodeAllocPtr = pCode + coldCodeSize;
+
+    return ((ColdCodeHeader *)pCode) - 1;
+}
+
+#endif // FEATURE_JIT_COLD_CODE
+
+void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isTier1, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                              size_t* pAllocatedSize, HeapList** ppCodeHeap
                            , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
                            , UINT nUnwindInfos
+#endif
+#ifdef FEATURE_JIT_COLD_CODE
+                           , size_t coldCodeSize, ColdCodeHeader** ppColdCodeHeader
 #endif
                            )
 {
@@ -2820,9 +2924,29 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
     {
         requestInfo.SetDynamicDomain();
     }
+#endif
+#ifdef FEATURE_TIERED_COMPILATION
+    if (isTier1 && !requestInfo.IsDynamicDomain() && g_pConfig->TieredCompilation_SeparateTier1CodeHeaps())
+    {
+        // Keep the optimized code of hot methods packed together instead of interleaving it with the
+        // tier0 code of everything else, which reduces the instruction TLB and cache footprint of the
+        // steady state.
+        requestInfo.SetTier1();
+    }
 #endif
     requestInfo.setReserveForJumpStubs(reserveForJumpStubs);
 
+#ifdef FEATURE_JIT_COLD_CODE
+    if (coldCodeSize > 0)
+    {
+        // The cold part must be placed in the same code heap as the hot part so that
+        // both share the unwind info base address. Reserve room for it on top of the
+        // jump stubs so that allocColdCode can always fall back to an exact fit.
+        _ASSERTE(!requestInfo.IsDynamicDomain());
+        requestInfo.setReserveForJumpStubs(reserveForJumpStubs + COLD_CODE_RESERVE_SIZE(coldCodeSize));
+    }
+#endif // FEATURE_JIT_COLD_CODE
+
 #ifdef FEATURE_EH_FUNCLETS
     SIZE_T realHeaderSize = offsetof(RealCodeHeader, unwindInfos[0]) + (sizeof(T_RUNTIME_FUNCTION) * nUnwindInfos);
 #else
@@ -2887,6 +3011,17 @@ void EEJitManager::allocCode(MethodDesc* pMD, size_t blockSize, size_t reserveFo
 #ifdef FEATURE_EH_FUNCLETS
         pCodeHdrRW->SetNumberOfUnwindInfos(nUnwindInfos);
 #endif
+#ifdef FEATURE_JIT_COLD_CODE
+        pCodeHdrRW->SetColdCode(0, 0, 0);
+
+        *ppColdCodeHeader = NULL;
+        if (coldCodeSize > 0)
+        {
+            *ppColdCodeHeader = allocColdCode(*ppCodeHeap, pCode, blockSize, coldCodeSize);
+            if (*ppColdCodeHeader == NULL)
+                ThrowOutOfMemory();
+        }
+#endif // FEATURE_JIT_COLD_CODE
 
         if (requestInfo.IsDynamicDomain())
         {
@@ -2953,6 +3088,12 @@ bool EEJitManager::CanUseCodeHeap(CodeHeapRequestInfo *pInfo, HeapList *pCodeHea
 
     bool retVal = false;
 
+    // Tier1 code and everything else (tier0 code, jump stubs, ...) never share a code heap
+    if (pCodeHeap->isTier1 != pInfo->IsTier1())
+    {
+        return false;
+    }
+
     if ((pInfo->m_loAddr == 0) && (pInfo->m_hiAddr == 0))
     {
         // We have no constraint so this non empty heap will be able to satisfy our request
@@ -3873,6 +4014,12 @@ PCODE EEJitManager::GetCodeAddressForRelOffset(const METHODTOKEN& MethodToken, D
     WRAPPER_NO_CONTRACT;
 
     CodeHeader * pHeader = GetCodeHeader(MethodToken);
+#ifdef FEATURE_JIT_COLD_CODE
+    if ((pHeader->GetColdCodeStartAddress() != (TADDR)0) && (relOffset >= pHeader->GetHotCodeSize()))
+    {
+        return pHeader->GetColdCodeStartAddress() + (relOffset - pHeader->GetHotCodeSize());
+    }
+#endif // FEATURE_JIT_COLD_CODE
     return pHeader->GetCodeStartAddress() + relOffset;
 }
 
@@ -3905,12 +4052,24 @@ BOOL EEJitManager::JitCodeToMethodInfo(
 
     if (pCodeInfo)
     {
-        pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pCHdr));
+#ifdef FEATURE_JIT_COLD_CODE
+        if (pCHdr->IsColdCodeHeader())
+        {
+            // The method token is always the header of the hot part, and offsets
+            // into the cold part continue where the hot part ends.
+            PTR_CodeHeader pHotCHdr = PTR_ColdCodeHeader(start - sizeof(ColdCodeHeader))->pHotCodeHeader;
+            pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pHotCHdr));
+            pCodeInfo->m_relOffset = pCHdr->GetHotCodeSize() + (DWORD)(PCODEToPINSTR(currentPC) - start);
+        }
+        else
+#endif // FEATURE_JIT_COLD_CODE
+        {
+            pCodeInfo->m_methodToken = METHODTOKEN(pRangeSection, dac_cast<TADDR>(pCHdr));
 
-        // This can be counted on for Jitted code. For NGEN code in the case
-        // where we have hot/cold splitting this isn't valid and we need to
-        // take into account cold code.
-        pCodeInfo->m_relOffset = (DWORD)(PCODEToPINSTR(currentPC) - pCHdr->GetCodeStartAddress());
+            // This can be counted on for Jitted code that is not split. For
+            // split code the cold part is handled above.
+            pCodeInfo->m_relOffset = (DWORD)(PCODEToPINSTR(currentPC) - pCHdr->GetCodeStartAddress());
+        }
 
 #ifdef FEATURE_EH_FUNCLETS
         // Computed lazily by code:EEJitManager::LazyGetFunctionEntry
@@ -4207,12 +4366,20 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
 
     CodeHeader * pHeader = GetCodeHeader(pCodeInfo->GetMethodToken());
 
-    DWORD address = RUNTIME_FUNCTION__BeginAddress(pHeader->GetUnwindInfo(0)) + pCodeInfo->GetRelOffset();
-
     // We need the module base address to calculate the end address of a function from the functionEntry.
     // Thus, save it off right now.
     TADDR baseAddress = pCodeInfo->GetModuleBase();
 
+    DWORD address = RUNTIME_FUNCTION__BeginAddress(pHeader->GetUnwindInfo(0)) + pCodeInfo->GetRelOffset();
+
+#ifdef FEATURE_JIT_COLD_CODE
+    if ((pHeader->GetColdCodeStartAddress() != (TADDR)0) && (pCodeInfo->GetRelOffset() >= pHeader->GetHotCodeSize()))
+    {
+        // The cold part does not follow the hot part in memory
+        address = (DWORD)(pHeader->GetColdCodeStartAddress() - baseAddress) + (pCodeInfo->GetRelOffset() - pHeader->GetHotCodeSize());
+    }
+#endif // FEATURE_JIT_COLD_CODE
+
     // NOTE: We could binary search here, if it would be helpful (e.g., large number of funclets)
     for (UINT iUnwindInfo = 0; iUnwindInfo < pHeader->GetNumberOfUnwindInfos(); iUnwindInfo++)
     {
@@ -4227,6 +4394,27 @@ PTR_RUNTIME_FUNCTION EEJitManager::LazyGetFunctionEntry(EECodeInfo * pCodeInfo)
     return NULL;
 }
 
+#if defined(FEATURE_JIT_COLD_CODE) && defined(TARGET_AMD64)
+BOOL EEJitManager::IsFunclet(EECodeInfo * pCodeInfo)
+{
+    CONTRACTL {
+        NOTHROW;
+        GC_NOTRIGGER;
+        SUPPORTS_DAC;
+    } CONTRACTL_END;
+
+    // Chained unwind info is used only for the cold part of the main body
+    PTR_RUNTIME_FUNCTION pFunctionEntry = pCodeInfo->GetFunctionEntry();
+    PTR_UNWIND_INFO pUnwindInfo = dac_cast<PTR_UNWIND_INFO>(pCodeInfo->GetModuleBase() + RUNTIME_FUNCTION__GetUnwindInfoAddress(pFunctionEntry));
+    if ((pUnwindInfo->Flags & UNW_FLAG_CHAININFO) != 0)
+    {
+        return FALSE;
+    }
+
+    return IJitManager::IsFunclet(pCodeInfo);
+}
+#endif // FEATURE_JIT_COLD_CODE && TARGET_AMD64
+
 DWORD EEJitManager::GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD* pStartFuncletOffsets, DWORD dwLength)
 {
     CONTRACTL
@@ -4259,6 +4447,16 @@ DWORD EEJitManager::GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD
         DWORD funcletBeginRva = RUNTIME_FUNCTION__BeginAddress(pFunctionEntry);
         DWORD relParentOffsetToFunclet = funcletBeginRva - parentBeginRva;
 
+#ifdef FEATURE_JIT_COLD_CODE
+        TADDR coldCodeStart = pCH->GetColdCodeStartAddress();
+        if ((coldCodeStart != (TADDR)0) && (moduleBase + funcletBeginRva >= coldCodeStart))
+        {
+            // Like for ReadyToRun code, the cold part of the main body is reported
+            // along with the funclets. Offsets continue after the hot part.
+            relParentOffsetToFunclet = pCH->GetHotCodeSize() + (DWORD)(moduleBase + funcletBeginRva - coldCodeStart);
+        }
+#endif // FEATURE_JIT_COLD_CODE
+
         if (nFunclets < dwLength)
             pStartFuncletOffsets[nFunclets] = relParentOffsetToFunclet;
         nFunclets++;
@@ -4714,6 +4912,12 @@ LPCWSTR ExecutionManager::GetJitName()
 }
 #endif // !FEATURE_MERGE_JIT_AND_ENGINE
 
+#ifndef DACCESS_COMPILE
+// The last non-collectible RangeSection found by this thread. Stack walks tend
+// to look up many addresses in the same code heap or R2R image in a row.
+static thread_local RangeSection* t_pLastNonCollectibleRangeSection = NULL;
+#endif // DACCESS_COMPILE
+
 RangeSection* ExecutionManager::GetRangeSection(TADDR addr, RangeSectionLockState *pLockState)
 {
     CONTRACTL {
@@ -4722,7 +4926,25 @@ RangeSection* ExecutionManager::GetRangeSection(TADDR addr, RangeSectionLockStat
         SUPPORTS_DAC;
     } CONTRACTL_END;
 
+#ifndef DACCESS_COMPILE
+    // Only collectible RangeSections are ever removed from the map (see
+    // RangeSectionMap::RemoveRangeSection), and ranges never overlap, so a
+    // cached non-collectible hit stays valid without taking the lock.
+    RangeSection* pLastRangeSection = t_pLastNonCollectibleRangeSection;
+    if ((pLastRangeSection != NULL) && pLastRangeSection->_range.IsInRange(addr))
+    {
+        return pLastRangeSection;
+    }
+
+    RangeSection* pRangeSection = GetCodeRangeMap()->LookupRangeSection(addr, pLockState);
+    if ((pRangeSection != NULL) && !(pRangeSection->_flags & RangeSection::RANGE_SECTION_COLLECTIBLE))
+    {
+        t_pLastNonCollectibleRangeSection = pRangeSection;
+    }
+    return pRangeSection;
+#else
     return GetCodeRangeMap()->LookupRangeSection(addr, pLockState);
+#endif // DACCESS_COMPILE
 }
 
 /* static */
@@ -121,6 +121,11 @@ enum StubCodeBlockKind : int
 typedef DPTR(struct _hpRealCodeHdr) PTR_RealCodeHeader;
 typedef DPTR(struct _hpCodeHdr) PTR_CodeHeader;
 
+// Jitted code may be split into a hot and a cold part (see EEJitManager::allocColdCode)
+#if defined(TARGET_AMD64) || defined(TARGET_ARM64)
+#define FEATURE_JIT_COLD_CODE
+#endif
+
 typedef struct _hpRealCodeHdr
 {
 public:
@@ -137,6 +142,15 @@ public:
 
     PTR_MethodDesc      phdrMDesc;
 
+#ifdef FEATURE_JIT_COLD_CODE
+    // Start of the cold part of the method, or 0 if the method was not split.
+    // The code offsets reported by the JIT treat the cold part as directly
+    // following the hot part.
+    TADDR               phdrColdCode;
+    DWORD               phdrHotCodeSize;
+    DWORD               phdrColdCodeSize;
+#endif // FEATURE_JIT_COLD_CODE
+
 #ifdef FEATURE_EH_FUNCLETS
     DWORD               nUnwindInfos;
     T_RUNTIME_FUNCTION  unwindInfos[0];
@@ -227,6 +241,36 @@ public:
         pRealCodeHeader = (PTR_RealCodeHeader)kind;
     }
 
+#ifdef FEATURE_JIT_COLD_CODE
+    TADDR                   GetColdCodeStartAddress()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrColdCode;
+    }
+    DWORD                   GetHotCodeSize()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrHotCodeSize;
+    }
+    DWORD                   GetColdCodeSize()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrColdCodeSize;
+    }
+    // True if this header precedes the cold part of a split method
+    BOOL                    IsColdCodeHeader()
+    {
+        SUPPORTS_DAC;
+        return pRealCodeHeader->phdrColdCode == GetCodeStartAddress();
+    }
+    void SetColdCode(TADDR pColdCode, DWORD hotCodeSize, DWORD coldCodeSize)
+    {
+        pRealCodeHeader->phdrColdCode     = pColdCode;
+        pRealCodeHeader->phdrHotCodeSize  = hotCodeSize;
+        pRealCodeHeader->phdrColdCodeSize = coldCodeSize;
+    }
+#endif // FEATURE_JIT_COLD_CODE
+
 #if defined(FEATURE_EH_FUNCLETS)
     UINT                    GetNumberOfUnwindInfos()
     {
@@ -253,6 +297,22 @@ public:
 
 } CodeHeader;
 
+#ifdef FEATURE_JIT_COLD_CODE
+//-----------------------------------------------------------------------------
+// Header which exists just before the cold part of a split method. The
+// embedded CodeHeader shares the RealCodeHeader of the hot part so that a
+// lookup from a cold address finds the method; pHotCodeHeader gives back the
+// method token, which is always the header of the hot part.
+
+typedef DPTR(struct _hpColdCodeHdr) PTR_ColdCodeHeader;
+
+typedef struct _hpColdCodeHdr
+{
+    PTR_CodeHeader      pHotCodeHeader;
+    CodeHeader          codeHeader;     // Must be last, the cold code follows it
+} ColdCodeHeader;
+#endif // FEATURE_JIT_COLD_CODE
+
 
 //-----------------------------------------------------------------------------
 // This is a structure used to consolidate the information that we
@@ -271,6 +331,7 @@ struct CodeHeapRequestInfo
     size_t       m_reserveForJumpStubs; // Amount to reserve for jump stubs (won't be allocated)
     bool         m_isDynamicDomain;
     bool         m_isCollectible;
+    bool         m_isTier1;         // tier1 code is kept apart from tier0 code, see TC_SeparateTier1CodeHeaps
     bool         m_throwOnOutOfMemoryWithinRange;
 
     bool   IsDynamicDomain()                    { return m_isDynamicDomain;    }
@@ -278,6 +339,9 @@ struct CodeHeapRequestInfo
 
     bool   IsCollectible()                      { return m_isCollectible;      }
 
+    bool   IsTier1()                            { return m_isTier1;            }
+    void   SetTier1()                           { m_isTier1 = true;            }
+
     size_t getRequestSize()                     { return m_requestSize;        }
     void   setRequestSize(size_t requestSize)   { m_requestSize = requestSize; }
 
@@ -381,6 +445,11 @@ struct HeapList
     size_t              reserveForJumpStubs; // Amount of memory reserved for jump stubs in this block
 
     PTR_LoaderAllocator pLoaderAllocator; // LoaderAllocator of HeapList
+    bool                isTier1;        // Only tier1 code is allocated in this heap
+#ifdef FEATURE_JIT_COLD_CODE
+    TADDR               coldCodeAllocPtr;   // Next free byte in the chunk the cold parts of split methods are carved from
+    TADDR               coldCodeLimit;      // End of that chunk
+#endif
 #if defined(TARGET_AMD64) || defined(TARGET_ARM64) || defined(TARGET_LOONGARCH64) || defined(TARGET_RISCV64)
     BYTE*               CLRPersonalityRoutine;  // jump thunk to personality routine
 #endif
@@ -1800,11 +1869,14 @@ public:
 
     BOOL                LoadJIT();
 
-    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
+    void                allocCode(MethodDesc* pFD, size_t blockSize, size_t reserveForJumpStubs, CorJitAllocMemFlag flag, bool isTier1, CodeHeader** ppCodeHeader, CodeHeader** ppCodeHeaderRW,
                                   size_t* pAllocatedSize, HeapList** ppCodeHeap
                                 , BYTE** ppRealHeader
 #ifdef FEATURE_EH_FUNCLETS
                                 , UINT nUnwindInfos
+#endif
+#ifdef FEATURE_JIT_COLD_CODE
+                                , size_t coldCodeSize, ColdCodeHeader** ppColdCodeHeader
 #endif
                                 );
     BYTE *              allocGCInfo(CodeHeader* pCodeHeader, DWORD blockSize, size_t * pAllocationSize);
@@ -1827,6 +1899,10 @@ public:
     virtual DWORD                   GetFuncletStartOffsets(const METHODTOKEN& MethodToken, DWORD* pStartFuncletOffsets, DWORD dwLength);
 #endif // FEATURE_EH_FUNCLETS
 
+#if defined(FEATURE_JIT_COLD_CODE) && defined(TARGET_AMD64)
+    virtual BOOL                    IsFunclet(EECodeInfo * pCodeInfo);
+#endif
+
     virtual StubCodeBlockKind       GetStubCodeBlockKind(RangeSection * pRangeSection, PCODE currentPC);
 
 #if defined(DACCESS_COMPILE)
@@ -1878,6 +1954,9 @@ private :
     void*       allocCodeRaw(CodeHeapRequestInfo *pInfo,
                              size_t header, size_t blockSize, unsigned align,
                              HeapList ** ppCodeHeap);
+#ifdef FEATURE_JIT_COLD_CODE
+    ColdCodeHeader* allocColdCode(HeapList *pCodeHeap, TADDR hotCode, size_t hotCodeSize, size_t coldCodeSize);
+#endif
 
     DomainCodeHeapList *GetCodeHeapList(CodeHeapRequestInfo *pInfo, LoaderAllocator *pAllocator, BOOL fDynamicOnly = FALSE);
     DomainCodeHeapList *CreateCodeHeapList(CodeHeapRequestInfo *pInfo);
@@ -2328,6 +2407,16 @@ inline void EEJitManager::JitTokenToMethodRegionInfo(const METHODTOKEN& MethodTo
     methodRegionInfo->hotSize          = GetCodeManager()->GetFunctionSize(GetGCInfoToken(MethodToken));
     methodRegionInfo->coldStartAddress = 0;
     methodRegionInfo->coldSize         = 0;
+
+#ifdef FEATURE_JIT_COLD_CODE
+    CodeHeader * pCH = GetCodeHeader(MethodToken);
+    if (pCH->GetColdCodeStartAddress() != (TADDR)0)
+    {
+        methodRegionInfo->hotSize          = pCH->GetHotCodeSize();
+        methodRegionInfo->coldStartAddress = pCH->GetColdCodeStartAddress();
+        methodRegionInfo->coldSize         = pCH->GetColdCodeSize();
+    }
+#endif // FEATURE_JIT_COLD_CODE
 }
 
 #if defined(FEATURE_READYTORUN)
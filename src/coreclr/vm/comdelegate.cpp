@@ -2188,12 +2188,27 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 
         DWORD dwLoopCounterNum = pCode->NewLocal(ELEMENT_TYPE_I4);
 
+        // The invocation list and count of a multicast delegate never change, so read them once
+        // up front instead of reloading both fields from the delegate on every iteration.
+        LocalDesc invocationListDesc(ELEMENT_TYPE_OBJECT);
+        invocationListDesc.MakeArray();
+        DWORD dwInvocationListNum = pCode->NewLocal(invocationListDesc);
+        DWORD dwInvocationCountNum = pCode->NewLocal(ELEMENT_TYPE_I);
+
         DWORD dwReturnValNum = -1;
         if (fReturnVal)
             dwReturnValNum = pCode->NewLocal(sig.GetRetTypeHandleNT());
 
         ILCodeLabel *nextDelegate = pCode->NewCodeLabel();
 
+        // snapshot the invocation list and count
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitSTLOC(dwInvocationListNum);
+        pCode->EmitLoadThis();
+        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitSTLOC(dwInvocationCountNum);
+
         // initialize counter
         pCode->EmitLDC(0);
         pCode->EmitSTLOC(dwLoopCounterNum);
@@ -2218,8 +2233,7 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 #endif // DEBUGGING_SUPPORTED
 
         // Load next delegate from array using LoopCounter as index
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_LIST)));
+        pCode->EmitLDLOC(dwInvocationListNum);
         pCode->EmitLDLOC(dwLoopCounterNum);
         pCode->EmitLDELEM_REF();
 
@@ -2242,8 +2256,7 @@ extern "C" PCODE QCALLTYPE Delegate_GetMulticastInvokeSlow(MethodTable* pDelegat
 
         // compare LoopCounter with InvocationCount. If less then branch to nextDelegate
         pCode->EmitLDLOC(dwLoopCounterNum);
-        pCode->EmitLoadThis();
-        pCode->EmitLDFLD(pCode->GetToken(CoreLibBinder::GetField(FIELD__MULTICAST_DELEGATE__INVOCATION_COUNT)));
+        pCode->EmitLDLOC(dwInvocationCountNum);
         pCode->EmitBLT(nextDelegate);
 
         // load the return value. return value from the last delegate call is returned
@@ -1299,6 +1299,31 @@ uint64_t GCInterface::GetGenerationBudget(int generation)
     return GCHeapUtilities::GetGCHeap()->GetGenerationBudget(generation);
 }
 
+extern "C" set_dynamic_adaptation_status QCALLTYPE GCInterface_SetDynamicAdaptationSettings(INT32 minHeapCount, INT32 maxHeapCount, float targetTcp)
+{
+    set_dynamic_adaptation_status status = set_dynamic_adaptation_succeed;
+    QCALL_CONTRACT;
+
+    BEGIN_QCALL;
+    status = GCInterface::SetDynamicAdaptationSettings(minHeapCount, maxHeapCount, targetTcp);
+    END_QCALL;
+
+    return status;
+}
+
+set_dynamic_adaptation_status GCInterface::SetDynamicAdaptationSettings(INT32 minHeapCount, INT32 maxHeapCount, float targetTcp)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    return GCHeapUtilities::GetGCHeap()->SetDynamicAdaptationSettings(minHeapCount, maxHeapCount, targetTcp);
+}
+
 #ifdef HOST_64BIT
 const unsigned MIN_MEMORYPRESSURE_BUDGET = 4 * 1024 * 1024;        // 4 MB
 #else // HOST_64BIT
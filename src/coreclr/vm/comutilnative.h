@@ -198,6 +198,7 @@ public:
     static int  RefreshMemoryLimit();
     static enable_no_gc_region_callback_status EnableNoGCRegionCallback(NoGCRegionCallbackFinalizerWorkItem* callback, INT64 totalSize);
     static uint64_t GetGenerationBudget(int generation);
+    static set_dynamic_adaptation_status SetDynamicAdaptationSettings(INT32 minHeapCount, INT32 maxHeapCount, float targetTcp);
 
 private:
     // Out-of-line helper to avoid EH prolog/epilog in functions that otherwise don't throw.
@@ -243,6 +244,8 @@ extern "C" enable_no_gc_region_callback_status QCALLTYPE GCInterface_EnableNoGCR
 
 extern "C" uint64_t QCALLTYPE GCInterface_GetGenerationBudget(int generation);
 
+extern "C" set_dynamic_adaptation_status QCALLTYPE GCInterface_SetDynamicAdaptationSettings(INT32 minHeapCount, INT32 maxHeapCount, float targetTcp);
+
 class COMInterlocked
 {
 public:
@@ -18,6 +18,7 @@
 #include "domainassembly.h"
 #include "holder.h"
 #include "bundle.h"
+#include "assemblyprefetch.h"
 #include "strongnameinternal.h"
 
 #include "../binder/inc/assemblyidentity.hpp"
@@ -119,6 +120,8 @@ STDAPI BinderAcquireImport(PEImage                  *pPEImage,
 
     EX_TRY
     {
+        AssemblyPrefetcher::RecordImageAcquire(pPEImage);
+
         PEImageLayout* pLayout = pPEImage->GetOrCreateLayout(PEImageLayout::LAYOUT_ANY);
 
         // CheckCorHeader includes check of NT headers too
@@ -40,7 +40,7 @@ Volatile<LONG> g_ShutdownCrstUsageCount = 0;
 //-----------------------------------------------------------------
 // Initialize critical section
 //-----------------------------------------------------------------
-VOID CrstBase::InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags)
+VOID CrstBase::InitWorker(CrstType crstType, CrstFlags flags)
 {
     CONTRACTL {
         THROWS;
@@ -60,6 +60,9 @@ VOID CrstBase::InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags)
     SetFlags(flags);
     SetCrstInitialized();
 
+    m_crstType = crstType;
+    m_enterTimestamp = 0;
+
 #ifdef _DEBUG
     DebugInit(crstType, flags);
 #endif
@@ -100,6 +103,152 @@ void CrstBase::Destroy()
     ResetFlags();
 }
 
+//-----------------------------------------------------------------
+// Contention statistics
+//-----------------------------------------------------------------
+
+// Wait and hold times are bucketed by powers of two microseconds: bucket 0 counts times under 1us,
+// bucket i counts times in [2^(i-1), 2^i) us and the last bucket everything longer.
+static const int CrstContentionStatsBuckets = 20;
+
+struct CrstContentionStats
+{
+    LONG64 acquisitions;
+    LONG64 waitTicks;
+    LONG64 holdTicks;
+    LONG64 waitHistogram[CrstContentionStatsBuckets];
+    LONG64 holdHistogram[CrstContentionStatsBuckets];
+};
+
+static bool g_fCrstCollectContentionStats;
+static CrstContentionStats* g_pCrstContentionStats;
+static LPWSTR g_pCrstContentionStatsFile;
+static uint64_t g_crstTicksPerMicrosecond;
+
+static uint64_t GetCrstTimestamp()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    LARGE_INTEGER li;
+    QueryPerformanceCounter(&li);
+    return (uint64_t)li.QuadPart;
+}
+
+static void AddToCrstContentionHistogram(LONG64* histogram, uint64_t ticks)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint64_t microseconds = ticks / g_crstTicksPerMicrosecond;
+    int bucket = 0;
+    while (microseconds != 0 && bucket < CrstContentionStatsBuckets - 1)
+    {
+        microseconds >>= 1;
+        bucket++;
+    }
+
+    InterlockedIncrement64(&histogram[bucket]);
+}
+
+void CrstBase::InitializeContentionStats()
+{
+    STANDARD_VM_CONTRACT;
+
+    NewArrayHolder<WCHAR> statsFile(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_CrstContentionStatsFile));
+    if (statsFile == NULL || *statsFile == W('\0'))
+        return;
+
+    LARGE_INTEGER li;
+    if (!QueryPerformanceFrequency(&li) || li.QuadPart < 1000 * 1000)
+        return;
+
+    g_crstTicksPerMicrosecond = (uint64_t)li.QuadPart / (1000 * 1000);
+    g_pCrstContentionStats = new CrstContentionStats[kNumberOfCrstTypes]();
+    g_pCrstContentionStatsFile = statsFile.Extract();
+
+    // Locks entered before this point have no timestamp, and are not accounted for when they are left
+    g_fCrstCollectContentionStats = true;
+}
+
+void CrstBase::WriteContentionStats()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (!g_fCrstCollectContentionStats)
+        return;
+
+    HandleHolder hFile(WszCreateFile(g_pCrstContentionStatsFile, GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL));
+    if (hFile == INVALID_HANDLE_VALUE)
+        return;
+
+    char buffer[2048];
+    DWORD cbWritten;
+    int length = sprintf_s(buffer, ARRAY_SIZE(buffer), "CrstType,Name,Acquisitions,WaitUs,HoldUs,WaitHistogram,HoldHistogram\n");
+    if (!::WriteFile(hFile, buffer, (DWORD)length, &cbWritten, NULL))
+        return;
+
+    for (int crstType = 0; crstType < kNumberOfCrstTypes; crstType++)
+    {
+        const CrstContentionStats& stats = g_pCrstContentionStats[crstType];
+        if (stats.acquisitions == 0)
+            continue;
+
+        // Type names are only compiled into debug builds, the numbers match the CrstType enum otherwise
+#ifdef _DEBUG
+        LPCSTR name = GetCrstName((CrstType)crstType);
+#else
+        LPCSTR name = "";
+#endif
+
+        length = sprintf_s(buffer, ARRAY_SIZE(buffer), "%d,%s,%lld,%llu,%llu,", crstType, name, (long long)stats.acquisitions,
+            (unsigned long long)stats.waitTicks / g_crstTicksPerMicrosecond, (unsigned long long)stats.holdTicks / g_crstTicksPerMicrosecond);
+
+        // Histogram buckets are separated by spaces to keep one CSV column per histogram. The buffer is large
+        // enough for all the buckets.
+        for (int i = 0; i < CrstContentionStatsBuckets; i++)
+            length += sprintf_s(buffer + length, ARRAY_SIZE(buffer) - length, i == 0 ? "%lld" : " %lld", (long long)stats.waitHistogram[i]);
+        for (int i = 0; i < CrstContentionStatsBuckets; i++)
+            length += sprintf_s(buffer + length, ARRAY_SIZE(buffer) - length, i == 0 ? ",%lld" : " %lld", (long long)stats.holdHistogram[i]);
+        length += sprintf_s(buffer + length, ARRAY_SIZE(buffer) - length, "\n");
+
+        if (!::WriteFile(hFile, buffer, (DWORD)length, &cbWritten, NULL))
+            return;
+    }
+}
+
+void CrstBase::RecordContentionStatsEnter(uint64_t waitStartTimestamp)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint64_t now = GetCrstTimestamp();
+    CrstContentionStats& stats = g_pCrstContentionStats[m_crstType];
+
+    InterlockedIncrement64(&stats.acquisitions);
+    InterlockedExchangeAdd64(&stats.waitTicks, (LONG64)(now - waitStartTimestamp));
+    AddToCrstContentionHistogram(stats.waitHistogram, now - waitStartTimestamp);
+
+    // The hold time of a reentrant lock would need the recursion count, only the wait time is recorded for those
+    if ((m_dwFlags & CRST_REENTRANCY) == 0)
+        m_enterTimestamp = now;
+}
+
+void CrstBase::RecordContentionStatsLeave()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    uint64_t holdTicks = GetCrstTimestamp() - m_enterTimestamp;
+    m_enterTimestamp = 0;
+
+    CrstContentionStats& stats = g_pCrstContentionStats[m_crstType];
+    InterlockedExchangeAdd64(&stats.holdTicks, (LONG64)holdTicks);
+    AddToCrstContentionHistogram(stats.holdHistogram, holdTicks);
+}
+
 extern void WaitForEndOfShutdown();
 
 //-----------------------------------------------------------------
@@ -319,8 +468,15 @@ void CrstBase::Enter(INDEBUG(NoLevelCheckFlag noLevelCheckFlag/* = CRST_LEVEL_CH
         }
     }
 
+    uint64_t waitStartTimestamp = g_fCrstCollectContentionStats ? GetCrstTimestamp() : 0;
+
     EnterCriticalSection(&m_criticalsection);
 
+    if (waitStartTimestamp != 0)
+    {
+        RecordContentionStatsEnter(waitStartTimestamp);
+    }
+
 #ifdef _DEBUG
     PostEnter();
 #endif
@@ -350,6 +506,11 @@ void CrstBase::Leave()
     Thread * pThread = GetThreadNULLOk();
 #endif
 
+    if (m_enterTimestamp != 0)
+    {
+        RecordContentionStatsLeave();
+    }
+
     LeaveCriticalSection(&m_criticalsection);
 
     // Check for both rare case using one if-check
@@ -593,7 +754,6 @@ void CrstBase::DebugInit(CrstType crstType, CrstFlags flags)
 {
     LIMITED_METHOD_CONTRACT;
 
-    m_crstType = crstType;
     m_tag = GetCrstName(crstType);
     m_crstlevel = GetCrstLevel(crstType);
     m_holderthreadid.Clear();
@@ -142,7 +142,14 @@ public:
     };
 #endif
 
+    // Wait and hold times of each CrstType are optionally collected, see DOTNET_CrstContentionStatsFile
+    static void InitializeContentionStats();
+    static void WriteContentionStats();
+
 private:
+    void RecordContentionStatsEnter(uint64_t waitStartTimestamp);
+    void RecordContentionStatsLeave();
+
     // Some Crsts have a "shutdown" mode.
     // A Crst in shutdown mode can only be taken / released by special
     // (the helper / finalizer / shutdown) threads. Any other thread that tries to take
@@ -275,7 +282,7 @@ public:
 
 protected:
 
-    VOID InitWorker(INDEBUG_COMMA(CrstType crstType) CrstFlags flags);
+    VOID InitWorker(CrstType crstType, CrstFlags flags);
 
 #ifdef _DEBUG
     void DebugInit(CrstType crstType, CrstFlags flags);
@@ -295,9 +302,10 @@ protected:
         // rest of the flags are CrstFlags
     } CrstReservedFlags;
     DWORD               m_dwFlags;            // Re-entrancy and same level
+    CrstType            m_crstType;           // Type enum (should have a descriptive name for debugging)
+    uint64_t            m_enterTimestamp;     // Performance counter at the last Enter, when contention stats are collected
 #ifdef _DEBUG
     UINT                m_entercount;       // # of unmatched Enters.
-    CrstType            m_crstType;         // Type enum (should have a descriptive name for debugging)
     const char         *m_tag;              // Stringized form of the tag for easy debugging
     int                 m_crstlevel;        // what level is the crst in?
     EEThreadId          m_holderthreadid;   // current holder (or NULL)
@@ -438,8 +446,7 @@ public:
     {
         WRAPPER_NO_CONTRACT;
 
-        // throw away the debug-only parameter in retail
-        InitWorker(INDEBUG_COMMA(crstType) flags);
+        InitWorker(crstType, flags);
     }
 
     //-----------------------------------------------------------------
@@ -478,8 +485,7 @@ public:
 
         _ASSERTE((flags & CRST_INITIALIZED) == 0);
 
-        // throw away the debug-only parameter in retail
-        InitWorker(INDEBUG_COMMA(crstType) flags);
+        InitWorker(crstType, flags);
     }
 
     bool InitNoThrow(CrstType crstType, CrstFlags flags = CRST_DEFAULT)
@@ -494,8 +500,7 @@ public:
 
         EX_TRY
         {
-            // throw away the debug-only parameter in retail
-            InitWorker(INDEBUG_COMMA(crstType) flags);
+            InitWorker(crstType, flags);
             fSuccess = true;
         }
         EX_CATCH
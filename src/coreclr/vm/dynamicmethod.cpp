@@ -466,6 +466,11 @@ HeapList* HostCodeHeap::InitializeHeapList(CodeHeapRequestInfo *pInfo)
     pHp->mapBase = ROUND_DOWN_TO_PAGE(pHp->startAddress);  // round down to next lower page align
     pHp->pHdrMap = NULL;
     pHp->endAddress = pHp->startAddress;
+#ifdef FEATURE_JIT_COLD_CODE
+    // Dynamic methods are never split
+    pHp->coldCodeAllocPtr = 0;
+    pHp->coldCodeLimit = 0;
+#endif
 
     pHp->maxCodeHeapSize = m_TotalBytesAvailable - (pTracker ? pTracker->size : 0);
     pHp->reserveForJumpStubs = 0;
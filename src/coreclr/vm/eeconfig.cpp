@@ -211,8 +211,10 @@ HRESULT EEConfig::Init()
     fTieredCompilation_QuickJitForLoops = false;
     fTieredCompilation_CallCounting = false;
     fTieredCompilation_UseCallCountingStubs = false;
+    fTieredCompilation_SeparateTier1CodeHeaps = false;
     tieredCompilation_CallCountThreshold = 1;
     tieredCompilation_BackgroundWorkerTimeoutMs = 0;
+    tieredCompilation_BackgroundWorkerCount = 1;
     tieredCompilation_CallCountingDelayMs = 0;
     tieredCompilation_DeleteCallCountingStubsAfter = 0;
 #endif
@@ -229,11 +231,14 @@ HRESULT EEConfig::Init()
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = 10;
+    dwOSR_FrameHitLimit = 3;
     dwOSR_CounterBump = 5000;
 #endif
 
     backpatchEntryPointSlots = false;
 
+    dwGenericMethodDictionarySlots = 0;
+
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
     pszGDBJitElfDump = NULL;
 #endif // FEATURE_GDBJIT && _DEBUG
@@ -661,6 +666,14 @@ HRESULT EEConfig::sync()
         tieredCompilation_BackgroundWorkerTimeoutMs =
             CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_BackgroundWorkerTimeoutMs);
 
+        tieredCompilation_BackgroundWorkerCount = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_BackgroundWorkerCount);
+        if (tieredCompilation_BackgroundWorkerCount == 0)
+        {
+            // Leave at least half of the processors to foreground work
+            int processorCount = GetCurrentProcessCpuCount();
+            tieredCompilation_BackgroundWorkerCount = (DWORD)min(max(processorCount / 2, 1), 4);
+        }
+
         fTieredCompilation_CallCounting = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_TC_CallCounting) != 0;
 
         DWORD tieredCompilation_ConfiguredCallCountThreshold =
@@ -707,6 +720,9 @@ HRESULT EEConfig::sync()
             }
         }
 
+        fTieredCompilation_SeparateTier1CodeHeaps =
+            CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TC_SeparateTier1CodeHeaps) != 0;
+
         if (CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_TC_AggressiveTiering) != 0)
         {
             // TC_AggressiveTiering may be used in some benchmarks to have methods be tiered up more quickly, for example when
@@ -748,6 +764,7 @@ HRESULT EEConfig::sync()
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     dwOSR_HitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_HitLimit);
+    dwOSR_FrameHitLimit = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_FrameHitLimit);
     dwOSR_CounterBump = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_OSR_CounterBump);
 #endif
 
@@ -758,6 +775,8 @@ HRESULT EEConfig::sync()
 
     backpatchEntryPointSlots = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_BackpatchEntryPointSlots) != 0;
 
+    dwGenericMethodDictionarySlots = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_GenericMethodDictionarySlots);
+
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
     {
         LPWSTR pszGDBJitElfDumpW = NULL;
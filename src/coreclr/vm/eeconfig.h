@@ -82,11 +82,13 @@ public:
     bool          TieredCompilation_QuickJit() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJit; }
     bool          TieredCompilation_QuickJitForLoops() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_QuickJitForLoops; }
     DWORD         TieredCompilation_BackgroundWorkerTimeoutMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerTimeoutMs; }
+    DWORD         TieredCompilation_BackgroundWorkerCount() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_BackgroundWorkerCount; }
     bool          TieredCompilation_CallCounting()  const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_CallCounting; }
     UINT16        TieredCompilation_CallCountThreshold() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountThreshold; }
     DWORD         TieredCompilation_CallCountingDelayMs() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_CallCountingDelayMs; }
     bool          TieredCompilation_UseCallCountingStubs() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_UseCallCountingStubs; }
     DWORD         TieredCompilation_DeleteCallCountingStubsAfter() const { LIMITED_METHOD_CONTRACT; return tieredCompilation_DeleteCallCountingStubsAfter; }
+    bool          TieredCompilation_SeparateTier1CodeHeaps() const { LIMITED_METHOD_CONTRACT; return fTieredCompilation_SeparateTier1CodeHeaps; }
 #endif
 
 #if defined(FEATURE_PGO)
@@ -103,6 +105,7 @@ public:
     // OSR Config
     DWORD         OSR_CounterBump() const { LIMITED_METHOD_CONTRACT; return dwOSR_CounterBump; }
     DWORD         OSR_HitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_HitLimit; }
+    DWORD         OSR_FrameHitLimit() const { LIMITED_METHOD_CONTRACT; return dwOSR_FrameHitLimit; }
 #endif
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT) && defined(_DEBUG)
@@ -112,6 +115,8 @@ public:
 
     bool          BackpatchEntryPointSlots() const { LIMITED_METHOD_CONTRACT; return backpatchEntryPointSlots; }
 
+    DWORD         GenericMethodDictionarySlots() const { LIMITED_METHOD_CONTRACT; return dwGenericMethodDictionarySlots; }
+
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
     inline bool ShouldDumpElfOnMethod(LPCUTF8 methodName) const
     {
@@ -611,8 +616,10 @@ private: //----------------------------------------------------------------
     bool fTieredCompilation_QuickJitForLoops;
     bool fTieredCompilation_CallCounting;
     bool fTieredCompilation_UseCallCountingStubs;
+    bool fTieredCompilation_SeparateTier1CodeHeaps;
     UINT16 tieredCompilation_CallCountThreshold;
     DWORD tieredCompilation_BackgroundWorkerTimeoutMs;
+    DWORD tieredCompilation_BackgroundWorkerCount;
     DWORD tieredCompilation_CallCountingDelayMs;
     DWORD tieredCompilation_DeleteCallCountingStubsAfter;
 #endif
@@ -629,6 +636,7 @@ private: //----------------------------------------------------------------
 
 #if defined(FEATURE_ON_STACK_REPLACEMENT)
     DWORD dwOSR_HitLimit;
+    DWORD dwOSR_FrameHitLimit;
     DWORD dwOSR_CounterBump;
 #endif
 
@@ -639,6 +647,8 @@ private: //----------------------------------------------------------------
 
     bool backpatchEntryPointSlots;
 
+    DWORD dwGenericMethodDictionarySlots;
+
 #if defined(FEATURE_GDBJIT) && defined(_DEBUG)
     LPCUTF8 pszGDBJitElfDump;
 #endif // FEATURE_GDBJIT && _DEBUG
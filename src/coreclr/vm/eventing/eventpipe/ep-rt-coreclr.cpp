@@ -21,6 +21,8 @@ ep_char8_t *volatile _ep_rt_coreclr_diagnostics_cmd_line;
 uint32_t *_ep_rt_coreclr_proc_group_offsets;
 #endif
 
+bool _ep_rt_coreclr_sample_profiler_skip_waiting_threads;
+
 /*
  * Forward declares of all static functions.
  */
@@ -107,9 +109,17 @@ walk_managed_stack_for_threads (
 
 	EP_ASSERT (current_stack_contents != NULL);
 
+	// Threads blocked in a managed wait would all report the same external stack on every tick.
+	bool skip_waiting_threads = _ep_rt_coreclr_sample_profiler_skip_waiting_threads;
+
 	// Iterate over all managed threads.
 	// Assumes that the ThreadStoreLock is held because we've suspended all threads.
 	while ((target_thread = ThreadStore::GetThreadList (target_thread)) != NULL) {
+		if (skip_waiting_threads && (target_thread->GetThreadState () & Thread::TS_Interruptible)) {
+			target_thread->ClearGCModeOnSuspension ();
+			continue;
+		}
+
 		ep_stack_contents_reset (current_stack_contents);
 
 		// Walk the stack and write it out as an event.
@@ -541,6 +541,15 @@ ep_rt_config_value_get_output_streaming (void)
 	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeOutputStreaming) != 0;
 }
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_output_file_size_mb (void)
+{
+	STATIC_CONTRACT_NOTHROW;
+	return CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeOutputFileSizeMB);
+}
+
 static
 inline
 bool
@@ -572,8 +581,11 @@ inline
 void
 ep_rt_sample_profiler_enabled (EventPipeEvent *sampling_event)
 {
-    STATIC_CONTRACT_NOTHROW;
-    // no-op
+	STATIC_CONTRACT_NOTHROW;
+
+	// Read once here, the sampler ticks run with the runtime suspended.
+	extern bool _ep_rt_coreclr_sample_profiler_skip_waiting_threads;
+	_ep_rt_coreclr_sample_profiler_skip_waiting_threads = CLRConfig::GetConfigValue (CLRConfig::INTERNAL_EventPipeSampleProfilerSkipWaitingThreads) != 0;
 }
 
 static
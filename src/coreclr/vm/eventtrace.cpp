@@ -4117,7 +4117,13 @@ VOID ETW::EnumerationLog::SendGCRundownEvent()
         if (gcSettingsInfo.no_affinitize_p)
             dwEtwGCSettingFlags |= kEtwGCFlagNoAffinitize;
 
-        FireEtwGCSettingsRundown (
+        if (GCHeapUtilities::IsStandaloneGC())
+            dwEtwGCSettingFlags |= kEtwGCFlagStandaloneGC;
+
+        // Identify the GC build so that traces of processes running different (standalone) GCs can be told apart
+        const VersionInfo& gcVersionInfo = GCHeapUtilities::GetGCVersionInfo();
+
+        FireEtwGCSettingsRundown_V1 (
             gcSettingsInfo.heap_hard_limit,
             gcSettingsInfo.loh_threshold,
             gcSettingsInfo.physical_memory_from_config,
@@ -4125,7 +4131,11 @@ VOID ETW::EnumerationLog::SendGCRundownEvent()
             gcSettingsInfo.gen0_max_budget_from_config,
             gcSettingsInfo.high_mem_percent_from_config,
             dwEtwGCSettingFlags,
-            GetClrInstanceId());
+            GetClrInstanceId(),
+            gcVersionInfo.MajorVersion,
+            gcVersionInfo.MinorVersion,
+            gcVersionInfo.BuildVersion,
+            gcVersionInfo.Name != NULL ? gcVersionInfo.Name : "");
     }
 }
 
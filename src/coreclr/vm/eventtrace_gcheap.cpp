@@ -580,6 +580,22 @@ public:
         ClearRootConditionalWeakTableElementEdges();
         ClearNodes();
         ClearEdges();
+        ZeroMemory(rgRecentTypeIDs, sizeof(rgRecentTypeIDs));
+    }
+
+    // Returns TRUE if typeID has not been handed to the type log recently during this heap dump,
+    // and remembers it so that subsequent objects of the same type skip the type log entirely
+    BOOL ShouldCheckTypeID(ULONGLONG typeID)
+    {
+        LIMITED_METHOD_CONTRACT;
+
+        // TypeHandles are at least pointer aligned, so skip the low bits that are always zero
+        ULONGLONG* pRecentTypeID = &rgRecentTypeIDs[(typeID >> 3) % ARRAY_SIZE(rgRecentTypeIDs)];
+        if (*pRecentTypeID == typeID)
+            return FALSE;
+
+        *pRecentTypeID = typeID;
+        return TRUE;
     }
 
     // These helpers clear the individual buffers, for use after a flush and on
@@ -711,6 +727,10 @@ public:
     //---------------------------------------------------------------------------------------
 
     BulkTypeEventLogger bulkTypeEventLogger;
+
+    // Direct-mapped cache of the type IDs most recently handed to the type log. Heap objects
+    // overwhelmingly share a small set of types, and each type log lookup takes a lock.
+    ULONGLONG rgRecentTypeIDs[256];
 };
 
 
@@ -904,7 +924,7 @@ VOID ETW::GCLog::ObjectReference(
 
     // We send type information as necessary--only for nodes, and only for nodes that we
     // haven't already sent type info for
-    if (typeID != 0)
+    if (typeID != 0 && pContext->ShouldCheckTypeID(typeID))
     {
         ETW::TypeSystemLog::LogTypeAndParametersIfNecessary(
             &pContext->bulkTypeEventLogger,     // Batch up this type with others to minimize events
@@ -2905,6 +2905,14 @@ void StackTraceInfo::EnsureStackTraceArray(StackTraceArray *pStackTrace, size_t
 
         stackTraceCapacity = newCapacity.Value();
 
+        // Exceptions usually pass through several frames before they are caught,
+        // so start with room for a few of them rather than reallocating and
+        // copying the array for each of the first frames.
+        if (stackTraceCapacity < InitialStackTraceCapacity)
+        {
+            stackTraceCapacity = InitialStackTraceCapacity;
+        }
+
         // Allocate a new array with the needed size
         newStackTrace.Allocate(stackTraceCapacity);
         if (pStackTrace->Get() != NULL)
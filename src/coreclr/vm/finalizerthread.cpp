@@ -31,6 +31,26 @@ CLREvent * FinalizerThread::hEventFinalizerToShutDown = NULL;
 
 HANDLE FinalizerThread::MHandles[kHandleCount];
 
+DWORD FinalizerThread::cFinalizerHelpers = 0;
+CLREvent * FinalizerThread::hEventFinalizerHelpersDone = NULL;
+LONG FinalizerThread::cActiveFinalizerHelpers = 0;
+LONG FinalizerThread::cHelperFinalizedObjects = 0;
+Volatile<BOOL> FinalizerThread::fFinalizerHelpersDispatched = FALSE;
+
+namespace
+{
+    struct FinalizerHelper
+    {
+        Thread *pThread;
+        CLREvent hEventWork;
+        Volatile<bool> fStarted;
+    };
+
+    FinalizerHelper *s_finalizerHelpers = NULL;
+
+    thread_local bool t_isFinalizerHelper = false;
+}
+
 BOOL FinalizerThread::IsCurrentThreadFinalizer()
 {
     LIMITED_METHOD_CONTRACT;
@@ -38,6 +58,13 @@ BOOL FinalizerThread::IsCurrentThreadFinalizer()
     return GetThreadNULLOk() == g_pFinalizerThread;
 }
 
+BOOL FinalizerThread::IsCurrentThreadFinalizerHelper()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    return t_isFinalizerHelper;
+}
+
 void FinalizerThread::EnableFinalization()
 {
     WRAPPER_NO_CONTRACT;
@@ -62,7 +89,26 @@ Again:
     if (fQuitFinalizer)
         return NULL;
 
-    OBJECTREF obj = ObjectToOBJECTREF(GCHeapUtilities::GetGCHeap()->GetNextFinalizable());
+    IGCHeap *pGCHeap = GCHeapUtilities::GetGCHeap();
+    Object *pNext;
+    if (fFinalizerHelpersDispatched)
+    {
+        // While the helpers are draining the queue only non-critical finalizers are handed out.
+        // Critical finalizers must run after all the others, so the finalizer thread picks them
+        // up by itself once every helper has finished.
+        pNext = pGCHeap->GetNextNonCriticalFinalizable();
+        if ((pNext == NULL) && IsCurrentThreadFinalizer())
+        {
+            WaitForFinalizerHelpers();
+            pNext = pGCHeap->GetNextFinalizable();
+        }
+    }
+    else
+    {
+        pNext = pGCHeap->GetNextFinalizable();
+    }
+
+    OBJECTREF obj = ObjectToOBJECTREF(pNext);
     if (obj == NULL)
         return NULL;
 
@@ -114,13 +160,208 @@ void FinalizerThread::FinalizeAllObjects()
 
     FireEtwGCFinalizersBegin_V1(GetClrInstanceId());
 
+    size_t queueLength = GCHeapUtilities::GetGCHeap()->GetNumberOfFinalizable();
+    ULONGLONG startTime = CLRGetTickCount64();
+
+    DispatchFinalizerHelpers();
+
+    uint32_t count = RunFinalizers();
+
+    // The finalizer thread normally waits for the helpers when it runs out of non-critical
+    // finalizers, but it may have returned early if we are shutting down.
+    if (fFinalizerHelpersDispatched)
+    {
+        WaitForFinalizerHelpers();
+    }
+    uint32_t helperCount = (uint32_t)InterlockedExchange(&cHelperFinalizedObjects, 0);
+    count += helperCount;
+
+    FireEtwGCFinalizersEnd_V2(count, GetClrInstanceId(), (ULONGLONG)queueLength, cFinalizerHelpers, helperCount,
+        (uint32_t)(CLRGetTickCount64() - startTime));
+}
+
+uint32_t FinalizerThread::RunFinalizers()
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
     PREPARE_NONVIRTUAL_CALLSITE(METHOD__GC__RUN_FINALIZERS);
     DECLARE_ARGHOLDER_ARRAY(args, 0);
 
     uint32_t count;
     CALL_MANAGED_METHOD(count, uint32_t, args);
 
-    FireEtwGCFinalizersEnd_V1(count, GetClrInstanceId());
+    return count;
+}
+
+void FinalizerThread::DispatchFinalizerHelpers()
+{
+    WRAPPER_NO_CONTRACT;
+
+    if (cFinalizerHelpers == 0)
+        return;
+
+    // Hold one reference of our own while the helpers are signaled so that a helper that
+    // finishes right away cannot set the done event before the rest have been counted.
+    cActiveFinalizerHelpers = 1;
+    hEventFinalizerHelpersDone->Reset();
+    fFinalizerHelpersDispatched = TRUE;
+
+    for (DWORD i = 0; i < cFinalizerHelpers; i++)
+    {
+        if (s_finalizerHelpers[i].fStarted)
+        {
+            InterlockedIncrement(&cActiveFinalizerHelpers);
+            s_finalizerHelpers[i].hEventWork.Set();
+        }
+    }
+
+    if (InterlockedDecrement(&cActiveFinalizerHelpers) == 0)
+    {
+        hEventFinalizerHelpersDone->Set();
+    }
+}
+
+void FinalizerThread::WaitForFinalizerHelpers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsCurrentThreadFinalizer());
+    _ASSERTE(fFinalizerHelpersDispatched);
+
+    {
+        GCX_PREEMP();
+        hEventFinalizerHelpersDone->Wait(INFINITE, FALSE);
+    }
+
+    fFinalizerHelpersDispatched = FALSE;
+}
+
+VOID FinalizerThread::FinalizerHelperThreadWorker(void *args)
+{
+    STATIC_CONTRACT_THROWS;
+    STATIC_CONTRACT_GC_TRIGGERS;
+    STATIC_CONTRACT_MODE_COOPERATIVE;
+
+    FinalizerHelper *pHelper = (FinalizerHelper *)args;
+
+    // The helpers are background threads that are never torn down; like the finalizer
+    // thread itself they just stay parked once we start shutting down.
+    while (true)
+    {
+        {
+            GCX_PREEMP();
+            pHelper->hEventWork.Wait(INFINITE, FALSE);
+        }
+
+        if (!fQuitFinalizer)
+        {
+            InterlockedExchangeAdd(&cHelperFinalizedObjects, (LONG)RunFinalizers());
+        }
+
+        if (InterlockedDecrement(&cActiveFinalizerHelpers) == 0)
+        {
+            hEventFinalizerHelpersDone->Set();
+        }
+    }
+}
+
+DWORD WINAPI FinalizerThread::FinalizerHelperThreadStart(void *args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != NULL);
+    FinalizerHelper *pHelper = (FinalizerHelper *)args;
+
+    if (!pHelper->pThread->HasStarted())
+        return 0;
+
+    _ASSERTE(GetThread() == pHelper->pThread);
+    t_isFinalizerHelper = true;
+    pHelper->fStarted = true;
+
+    ManagedThreadBase::KickOff(FinalizerHelperThreadWorker, pHelper);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(pHelper->pThread);
+    return 0;
+}
+
+void FinalizerThread::CreateFinalizerHelpers()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    DWORD cHelpers = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_FinalizerHelperThreadCount);
+    if (cHelpers == 0)
+        return;
+
+    // The finalizer thread itself takes one processor; helpers beyond the rest only
+    // contend on the finalization queue lock.
+    DWORD cProcessors = GetCurrentProcessCpuCount();
+    if (cHelpers >= cProcessors)
+        cHelpers = cProcessors - 1;
+    if (cHelpers == 0)
+        return;
+
+    EX_TRY
+    {
+        hEventFinalizerHelpersDone = new CLREvent();
+        hEventFinalizerHelpersDone->CreateManualEvent(FALSE);
+
+        s_finalizerHelpers = new FinalizerHelper[cHelpers]();
+
+        for (DWORD i = 0; i < cHelpers; i++)
+        {
+            FinalizerHelper *pHelper = &s_finalizerHelpers[i];
+            pHelper->fStarted = false;
+            pHelper->hEventWork.CreateAutoEvent(FALSE);
+
+            Thread *pThread = SetupUnstartedThread();
+            pHelper->pThread = pThread;
+#ifdef FEATURE_COMINTEROP
+            pThread->SetApartmentOfUnstartedThread(Thread::AS_InMTA);
+#endif
+            pThread->SetBackground(TRUE);
+
+            if (!pThread->CreateNewThread(0, &FinalizerHelperThreadStart, pHelper, W(".NET Finalizer Helper")))
+            {
+                pThread->DecExternalCount(FALSE);
+                break;
+            }
+
+            pThread->StartThread();
+        }
+
+        cFinalizerHelpers = cHelpers;
+    }
+    EX_CATCH
+    {
+        // Helpers are only an optimization. Any that did start are still used, the rest of
+        // the work stays on the finalizer thread.
+        if (s_finalizerHelpers != NULL)
+            cFinalizerHelpers = cHelpers;
+    }
+    EX_END_CATCH(SwallowAllExceptions);
 }
 
 void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
@@ -232,6 +473,7 @@ void FinalizerThread::WaitForFinalizerEvent (CLREvent *event)
 
 static BOOL s_FinalizerThreadOK = FALSE;
 static BOOL s_InitializedFinalizerThreadForPlatform = FALSE;
+static BOOL s_CreatedFinalizerHelpers = FALSE;
 
 VOID FinalizerThread::FinalizerThreadWorker(void *args)
 {
@@ -323,6 +565,12 @@ VOID FinalizerThread::FinalizerThreadWorker(void *args)
             Thread::InitializationForManagedThreadInNative(GetFinalizerThread());
         }
 
+        if (!s_CreatedFinalizerHelpers)
+        {
+            s_CreatedFinalizerHelpers = TRUE;
+            CreateFinalizerHelpers();
+        }
+
         JitHost::Reclaim();
 
         GetFinalizerThread()->DisablePreemptiveGC();
@@ -521,8 +769,9 @@ void FinalizerThread::FinalizerThreadWait()
     ASSERT(hEventFinalizer->IsValid());
     ASSERT(GetFinalizerThread());
 
-    // Can't call this from within a finalized method.
-    if (!IsCurrentThreadFinalizer())
+    // Can't call this from within a finalized method. That includes finalizers running on a
+    // helper thread - the finalizer thread won't finish the pass until the helper returns.
+    if (!IsCurrentThreadFinalizer() && !IsCurrentThreadFinalizerHelper())
     {
         // We may see a completion of finalization cycle that might not see objects that became
         // F-reachable in recent GCs. In such case we want to wait for a completion of another cycle.
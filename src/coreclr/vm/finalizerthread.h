@@ -34,6 +34,23 @@ class FinalizerThread
 
     static void FinalizeAllObjects();
 
+    // Optional helper threads (see FinalizerHelperThreadCount) that drain non-critical
+    // finalizers in parallel with the finalizer thread during each pass.
+    static DWORD cFinalizerHelpers;
+    static CLREvent *hEventFinalizerHelpersDone;
+    static LONG cActiveFinalizerHelpers;
+    static LONG cHelperFinalizedObjects;
+    static Volatile<BOOL> fFinalizerHelpersDispatched;
+
+    static uint32_t RunFinalizers();
+
+    static void CreateFinalizerHelpers();
+    static void DispatchFinalizerHelpers();
+    static void WaitForFinalizerHelpers();
+
+    static VOID FinalizerHelperThreadWorker(void *args);
+    static DWORD WINAPI FinalizerHelperThreadStart(void *args);
+
 public:
     static Thread* GetFinalizerThread()
     {
@@ -44,6 +61,9 @@ public:
 
     static BOOL IsCurrentThreadFinalizer();
 
+    // Whether the current thread is one of the helpers that run finalizers during a pass.
+    static BOOL IsCurrentThreadFinalizerHelper();
+
     static void EnableFinalization();
 
     static BOOL HaveExtraWorkForFinalizer();
@@ -56,8 +76,9 @@ public:
         fQuitFinalizer = TRUE;
         EnableFinalization();
 
-        // Do not wait for FinalizerThread if the current one is FinalizerThread.
-        if (GetThreadNULLOk() != GetFinalizerThread())
+        // Do not wait for FinalizerThread if the current one is FinalizerThread, or a helper
+        // that the finalizer thread is waiting on.
+        if (GetThreadNULLOk() != GetFinalizerThread() && !IsCurrentThreadFinalizerHelper())
         {
             // This wait must be alertable to handle cases where the current
             // thread's context is needed (i.e. RCW cleanup)
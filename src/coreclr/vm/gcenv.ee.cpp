@@ -25,6 +25,7 @@
 #include "configuration.h"
 #include "genanalysis.h"
 #include "eventpipeadapter.h"
+#include "runtimemetrics.h"
 
 // Finalizes a weak reference directly.
 extern void FinalizeWeakReference(Object* obj);
@@ -368,6 +369,8 @@ void GCToEEInterface::GcDone(int condemned)
     CONTRACTL_END;
 
     Interop::OnGCFinished(condemned);
+
+    RuntimeMetrics::OnGCFinished(condemned);
 }
 
 bool GCToEEInterface::RefCountedHandleCallbacks(Object * pObject)
@@ -1668,6 +1671,15 @@ bool GenAwareMatchingCondition(size_t gcIndex, int condemnedGeneration, uint64_t
     {
         return false;
     }
+    // The gen2 size is the one observed at the end of the previous GC
+    if ((gcGenAnalysisGen2Bytes > 0) && (GCHeapUtilities::GetGCHeap()->GetLastGCGenerationSize(GCHeapUtilities::GetGCHeap()->GetMaxGeneration()) <= gcGenAnalysisGen2Bytes))
+    {
+        return false;
+    }
+    if ((gcGenAnalysisMemoryLoad > 0) && (GCHeapUtilities::GetGCHeap()->GetMemoryLoad() < gcGenAnalysisMemoryLoad))
+    {
+        return false;
+    }
     return true;
 }
 
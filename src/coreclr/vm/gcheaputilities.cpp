@@ -86,6 +86,18 @@ PTR_VOID GCHeapUtilities::GetGCModuleBase()
     return g_gc_module_base;
 }
 
+const VersionInfo& GCHeapUtilities::GetGCVersionInfo()
+{
+    assert(g_gc_load_status == GC_LOAD_STATUS_LOAD_COMPLETE);
+    return g_gc_version_info;
+}
+
+bool GCHeapUtilities::IsStandaloneGC()
+{
+    assert(g_gc_module_base);
+    return g_gc_module_base != GetClrModuleBase();
+}
+
 namespace
 {
 // This block of code contains all of the state necessary to handle incoming
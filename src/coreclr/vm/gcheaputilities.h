@@ -323,6 +323,12 @@ public:
     // Gets a pointer to the module that contains the GC.
     static PTR_VOID GetGCModuleBase();
 
+    // Gets the version information the loaded GC reported about itself.
+    static const VersionInfo& GetGCVersionInfo();
+
+    // Returns true if the GC was loaded from a standalone GC module rather than being the one built into the runtime.
+    static bool IsStandaloneGC();
+
     // Loads (if using a standalone GC) and initializes the GC.
     static HRESULT LoadAndInitialize();
 
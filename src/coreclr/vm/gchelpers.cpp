@@ -183,6 +183,33 @@ inline void CheckObjectSize(size_t alloc_size)
     }
 }
 
+#ifdef FEATURE_EVENT_TRACE
+// Allocation sampling tends to hit the same few types over and over on a given thread,
+// and formatting the type name is by far the most expensive part of raising the event.
+// Remember the name of the last sampled type so a hot allocation site only pays for
+// TypeHandle::GetName once. Collectible types are never cached since their MethodTable
+// can be freed and the address reused by an unrelated type.
+struct SampledTypeNameCache
+{
+    TypeHandle m_th;
+    InlineSString<MAX_CLASSNAME_LENGTH> m_name;
+};
+
+// The cache is only allocated the first time a thread raises the event, so threads
+// don't pay for the inline name buffer when allocation sampling is off.
+struct SampledTypeNameCacheHolder
+{
+    SampledTypeNameCache* m_pCache = nullptr;
+
+    ~SampledTypeNameCacheHolder()
+    {
+        delete m_pCache;
+    }
+};
+
+static thread_local SampledTypeNameCacheHolder t_sampledTypeNameCache;
+#endif //FEATURE_EVENT_TRACE
+
 void FireAllocationSampled(GC_ALLOC_FLAGS flags, size_t size, size_t samplingBudgetOffset, Object* orObject)
 {
 #ifdef FEATURE_EVENT_TRACE
@@ -196,8 +223,30 @@ void FireAllocationSampled(GC_ALLOC_FLAGS flags, size_t size, size_t samplingBud
 
         if (th != 0)
         {
-            th.GetName(strTypeName);
-            name = strTypeName.GetUnicode();
+            SampledTypeNameCache* cache = t_sampledTypeNameCache.m_pCache;
+            if (cache == nullptr)
+            {
+                cache = new (nothrow) SampledTypeNameCache();
+                t_sampledTypeNameCache.m_pCache = cache;
+            }
+
+            if (cache != nullptr && cache->m_th == th)
+            {
+                name = cache->m_name.GetUnicode();
+            }
+            else
+            {
+                th.GetName(strTypeName);
+                name = strTypeName.GetUnicode();
+
+                if (cache != nullptr && !th.IsTypeDesc() && !th.AsMethodTable()->Collectible())
+                {
+                    // clear the key first so a failure while copying can't leave a stale entry
+                    cache->m_th = TypeHandle();
+                    cache->m_name.Set(strTypeName);
+                    cache->m_th = th;
+                }
+            }
             typeId = th.GetMethodTable();
         }
     }
@@ -1206,6 +1255,78 @@ OBJECTREF TryAllocateFrozenObject(MethodTable* pObjMT)
     return ObjectToOBJECTREF(orObject);
 }
 
+OBJECTREF TryAllocateFrozenCopy(OBJECTREF obj)
+{
+    CONTRACTL {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+        PRECONDITION(obj != NULL);
+    } CONTRACTL_END;
+
+    if (GCHeapUtilities::GetGCHeap()->IsInFrozenSegment(OBJECTREFToObject(obj)))
+    {
+        // Nothing to do, it's frozen already
+        return obj;
+    }
+
+    MethodTable* pMT = obj->GetMethodTable();
+
+    // The GC never looks at references held by frozen objects, so only objects
+    // without any can be frozen.
+    if (pMT->ContainsGCPointers() || pMT->IsComObjectType() || pMT->Collectible())
+    {
+        return NULL;
+    }
+
+    // FrozenObjectHeapManager doesn't yet support objects with a custom alignment,
+    // see TryAllocateFrozenSzArray
+    if ((DATA_ALIGNMENT < sizeof(double)) && pMT->IsArray() &&
+        (pMT->GetArrayElementTypeHandle() == CoreLibBinder::GetElementType(ELEMENT_TYPE_R8)))
+    {
+        return NULL;
+    }
+#ifdef FEATURE_64BIT_ALIGNMENT
+    if (pMT->RequiresAlign8() ||
+        (pMT->IsArray() && pMT->GetArrayElementTypeHandle().GetMethodTable()->RequiresAlign8()))
+    {
+        // Custom alignment is not supported for frozen objects yet.
+        return NULL;
+    }
+#endif // FEATURE_64BIT_ALIGNMENT
+
+    SetTypeHandleOnThreadForAlloc(TypeHandle(pMT));
+
+    // Strings and arrays both keep their length right after the MethodTable, and the
+    // GC needs it to compute the object's size as soon as the object is published.
+    DWORD numComponents = pMT->HasComponentSize() ? ((ArrayBase*)OBJECTREFToObject(obj))->GetNumComponents() : 0;
+    size_t objectSize = obj->GetSize();
+
+    Object* pFrozen = NULL;
+    GCPROTECT_BEGIN(obj);
+
+    FrozenObjectHeapManager* foh = SystemDomain::GetFrozenObjectHeapManager();
+    pFrozen = foh->TryAllocateObject(pMT, PtrAlign(objectSize), [](Object* pObj, void* numComponentsPtr){
+            // Initialize newly allocated object before publish
+            if (pObj->GetMethodTable()->HasComponentSize())
+            {
+                static_cast<ArrayBase*>(pObj)->m_NumComponents = *static_cast<DWORD*>(numComponentsPtr);
+            }
+        }, &numComponents);
+
+    if (pFrozen != NULL)
+    {
+        // The source may have moved while we were allocating, so only copy its contents
+        // now that we're back in cooperative mode. There are no references to report
+        // so the frozen object can be filled in after it was published.
+        memcpyNoGCRefs(pFrozen->GetData(), obj->GetData(), objectSize - sizeof(ObjHeader) - sizeof(MethodTable*));
+    }
+
+    GCPROTECT_END();
+
+    return ObjectToOBJECTREF(pFrozen);
+}
+
 //========================================================================
 //
 //      WRITE BARRIER HELPERS
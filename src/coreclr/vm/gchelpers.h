@@ -28,6 +28,9 @@ OBJECTREF AllocateSzArray(TypeHandle  arrayType, INT32 length, GC_ALLOC_FLAGS fl
 OBJECTREF TryAllocateFrozenSzArray(MethodTable* pArrayMT, INT32 length);
 // Same for non-array objects
 OBJECTREF TryAllocateFrozenObject(MethodTable* pObjMT);
+// Copy an existing object without GC references to a frozen segment
+// Returns nullptr if it's not possible.
+OBJECTREF TryAllocateFrozenCopy(OBJECTREF obj);
 
 // The main Array allocation routine, can do multi-dimensional
 OBJECTREF AllocateArrayEx(MethodTable *pArrayMT, INT32 *pArgs, DWORD dwNumArgs, GC_ALLOC_FLAGS flags = GC_ALLOC_NO_FLAGS);
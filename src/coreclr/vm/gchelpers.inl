@@ -29,6 +29,44 @@
     #endif
 #endif
 
+// Sets count bytes starting at bytes to 0xff. To avoid cache line thrashing, bytes that have already been set are not
+// written, and the bulk of a large range is checked and set a pointer-sized word at a time.
+FORCEINLINE void InlinedSetTableBytesHelper(BYTE* bytes, size_t count)
+{
+    _ASSERTE(count != 0);
+
+    // Set the bytes up to the first word boundary one at a time
+    while (!IS_ALIGNED(bytes, sizeof(size_t)))
+    {
+        if (*bytes != 0xff)
+        {
+            *bytes = 0xff;
+        }
+
+        bytes++;
+        if (--count == 0)
+        {
+            return;
+        }
+    }
+
+    for (; count >= sizeof(size_t); count -= sizeof(size_t), bytes += sizeof(size_t))
+    {
+        if (*(size_t*)bytes != ~(size_t)0)
+        {
+            *(size_t*)bytes = ~(size_t)0;
+        }
+    }
+
+    for (; count != 0; count--, bytes++)
+    {
+        if (*bytes != 0xff)
+        {
+            *bytes = 0xff;
+        }
+    }
+}
+
 FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
 {
     // Caller is expected to check whether the writes were even into the heap
@@ -66,19 +104,8 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
     // with g_lowest/highest_address check above. See comment in StompWriteBarrier.
     BYTE* card = (BYTE*)VolatileLoadWithoutBarrier(&g_card_table) + startingClump;
 
-    // Fill the cards. To avoid cache line thrashing we check whether the cards have already been set before
-    // writing.
-    do
-    {
-        if (*card != 0xff)
-        {
-            *card = 0xff;
-        }
-
-        card++;
-        clumpCount--;
-    }
-    while (clumpCount != 0);
+    // Fill the cards
+    InlinedSetTableBytesHelper(card, clumpCount);
 
 #ifdef FEATURE_MANUALLY_MANAGED_CARD_BUNDLES
     size_t startBundleByte = startAddress >> card_bundle_byte_shift;
@@ -87,17 +114,7 @@ FORCEINLINE void InlinedSetCardsAfterBulkCopyHelper(Object **start, size_t len)
 
     uint8_t* pBundleByte = ((uint8_t*)VolatileLoadWithoutBarrier(&g_card_bundle_table)) + startBundleByte;
 
-    do
-    {
-        if (*pBundleByte != 0xFF)
-        {
-            *pBundleByte = 0xFF;
-        }
-
-        pBundleByte++;
-        bundleByteCount--;
-    }
-    while (bundleByteCount != 0);
+    InlinedSetTableBytesHelper(pBundleByte, bundleByteCount);
 #endif
 }
 
@@ -13,6 +13,8 @@ int64_t gcGenAnalysisGen = -1;
 uint64_t gcGenAnalysisBytes = 0;
 uint64_t gcGenAnalysisTime = 0;
 int64_t gcGenAnalysisIndex = 0;
+uint64_t gcGenAnalysisGen2Bytes = 0;
+uint32_t gcGenAnalysisMemoryLoad = 0;
 uint32_t gcGenAnalysisBufferMB = 0;
 bool gcGenAnalysisTrace = true;
 bool gcGenAnalysisDump = false;
@@ -36,7 +38,9 @@ bool gcGenAnalysisDump = false;
         }
         if (match && !CLRConfig::IsConfigOptionSpecified(W("GCGenAnalysisBytes")) &&
                      !CLRConfig::IsConfigOptionSpecified(W("GCGenAnalysisTimeUSec")) &&
-                     !CLRConfig::IsConfigOptionSpecified(W("GCGenAnalysisTimeMSec")))
+                     !CLRConfig::IsConfigOptionSpecified(W("GCGenAnalysisTimeMSec")) &&
+                     !CLRConfig::IsConfigOptionSpecified(W("GCGenAnalysisGen2SizeMB")) &&
+                     !CLRConfig::IsConfigOptionSpecified(W("GCGenAnalysisMemoryLoad")))
         {
             match = false;
         }
@@ -50,6 +54,8 @@ bool gcGenAnalysisDump = false;
             }
             gcGenAnalysisGen = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCGenAnalysisGen);
             gcGenAnalysisIndex = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCGenAnalysisIndex);
+            gcGenAnalysisGen2Bytes = (uint64_t)CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCGenAnalysisGen2SizeMB) * 1024 * 1024;
+            gcGenAnalysisMemoryLoad = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCGenAnalysisMemoryLoad);
             gcGenAnalysisBufferMB = CLRConfig::GetConfigValue(CLRConfig::INTERNAL_EventPipeCircularMB);
             gcGenAnalysisTrace = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCGenAnalysisTrace);
             gcGenAnalysisDump = CLRConfig::GetConfigValue(CLRConfig::EXTERNAL_GCGenAnalysisDump);
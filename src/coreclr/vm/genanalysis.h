@@ -33,6 +33,8 @@ extern int64_t gcGenAnalysisGen;
 extern uint64_t gcGenAnalysisBytes;
 extern uint64_t gcGenAnalysisTime;
 extern int64_t gcGenAnalysisIndex;
+extern uint64_t gcGenAnalysisGen2Bytes;
+extern uint32_t gcGenAnalysisMemoryLoad;
 extern bool gcGenAnalysisTrace;
 extern bool gcGenAnalysisDump;
 
@@ -90,6 +90,9 @@ typedef DPTR(DictionaryLayout) PTR_DictionaryLayout;
 #define NUM_DICTIONARY_SLOTS 4
 #endif
 
+// Upper bound for the configurable initial number of slots (see GenericMethodDictionarySlots)
+#define MAX_INITIAL_DICTIONARY_SLOTS 256
+
 // The type of dictionary layouts. We don't include the number of type
 // arguments as this is obtained elsewhere
 class DictionaryLayout
@@ -380,7 +380,16 @@ InstantiatedMethodDesc::NewInstantiatedMethodDesc(MethodTable *pExactMT,
             }
             else if (getWrappedCode)
             {
-                pDL = DictionaryLayout::Allocate(NUM_DICTIONARY_SLOTS, pAllocator, &amt);
+                // Generic-heavy apps can pre-size the layouts so that dictionaries are created at their final size
+                // rather than being expanded, and lookups into them falling back to the slow path, during startup.
+                DWORD numSlots = g_pConfig->GenericMethodDictionarySlots();
+                if (numSlots == 0)
+                {
+                    numSlots = NUM_DICTIONARY_SLOTS;
+                }
+                numSlots = min(numSlots, (DWORD)MAX_INITIAL_DICTIONARY_SLOTS);
+
+                pDL = DictionaryLayout::Allocate((WORD)numSlots, pAllocator, &amt);
 #ifdef _DEBUG
                 {
                     SString name;
@@ -2339,6 +2339,44 @@ static PCODE JitPatchpointWorker(MethodDesc* pMD, const EECodeInfo& codeInfo, in
     return osrVariant;
 }
 
+// The patchpoint counter of the most recent frame each thread has seen calling the helper
+// at a patchpoint, used to count the distinct frames reaching that patchpoint. The table is
+// small and direct mapped by patchpoint; a patchpoint that evicts another one starts over.
+struct PatchpointFrameEntry
+{
+    PerPatchpointInfo* m_ppInfo;
+    TADDR m_counter;
+};
+
+static const size_t PatchpointFrameTableSize = 8;
+static thread_local PatchpointFrameEntry t_patchpointFrames[PatchpointFrameTableSize];
+
+// Returns true if the calling frame is one this thread has not seen calling the helper at this patchpoint
+static bool IsNewPatchpointFrame(PerPatchpointInfo* ppInfo, int* counter)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    PatchpointFrameEntry& entry = t_patchpointFrames[((size_t)ppInfo / sizeof(PerPatchpointInfo)) % PatchpointFrameTableSize];
+    if (entry.m_ppInfo != ppInfo)
+    {
+        // An empty entry means this thread never reached a patchpoint mapping here, so the
+        // frame is new. After an eviction the frame may have been seen already, so it is
+        // not counted.
+        bool isNew = (entry.m_ppInfo == NULL);
+        entry.m_ppInfo = ppInfo;
+        entry.m_counter = (TADDR)counter;
+        return isNew;
+    }
+
+    if (entry.m_counter == (TADDR)counter)
+    {
+        return false;
+    }
+
+    entry.m_counter = (TADDR)counter;
+    return true;
+}
+
 static PCODE PatchpointOptimizationPolicy(TransitionBlock* pTransitionBlock, int* counter, int ilOffset, PerPatchpointInfo * ppInfo, const EECodeInfo& codeInfo, bool *pIsNewMethod)
 {
     STATIC_CONTRACT_NOTHROW;
@@ -2436,11 +2474,30 @@ static PCODE PatchpointOptimizationPolicy(TransitionBlock* pTransitionBlock, int
         const int hitCount = InterlockedIncrement(&ppInfo->m_patchpointCount);
         const int hitLogLevel = (hitCount == 1) ? LL_INFO10 : LL_INFO1000;
 
-        LOG((LF_TIEREDCOMPILATION, hitLogLevel, "PatchpointOptimizationPolicy: patchpoint [%d] (0x%p) hit %d in Method=0x%pM (%s::%s) [il offset %d] (limit %d)\n",
-            ppId, ip, hitCount, pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, ilOffset, hitLimit));
+        // The patchpoint counter lives in the Tier0 frame, so its address
+        // identifies the calling frame. If the patchpoint keeps getting
+        // reached from new frames, the method is being called often and
+        // each call runs the loop long enough to exhaust the initial
+        // counter; there is little point waiting out the hit limit.
+        //
+        // Frames are tracked per thread, so threads running the same loop
+        // concurrently don't look like new frames to each other. A new
+        // frame that reuses the previous frame's stack location, or whose
+        // patchpoint was evicted from the thread's table, is not counted,
+        // so this can only undercount.
+        const int frameHitLimit = g_pConfig->OSR_FrameHitLimit();
+        int frameCount = ppInfo->m_frameCount;
+        if ((frameHitLimit > 0) && IsNewPatchpointFrame(ppInfo, counter))
+        {
+            frameCount = InterlockedIncrement(&ppInfo->m_frameCount);
+        }
+
+        LOG((LF_TIEREDCOMPILATION, hitLogLevel, "PatchpointOptimizationPolicy: patchpoint [%d] (0x%p) hit %d (%d frames) in Method=0x%pM (%s::%s) [il offset %d] (limit %d)\n",
+            ppId, ip, hitCount, frameCount, pMD, pMD->m_pszDebugClassName, pMD->m_pszDebugMethodName, ilOffset, hitLimit));
 
-        // Defer, if we haven't yet reached the limit
-        if (hitCount < hitLimit)
+        // Defer, if we haven't yet reached either limit
+        const bool frameLimitReached = (frameHitLimit > 0) && (frameCount >= frameHitLimit);
+        if ((hitCount < hitLimit) && !frameLimitReached)
         {
             goto DONE;
         }
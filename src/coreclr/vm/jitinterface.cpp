@@ -7801,8 +7801,12 @@ CORINFO_CLASS_HANDLE CEEInfo::getTypeDefinition(CORINFO_CLASS_HANDLE type)
 }
 
 /*************************************************************
- * Check if the caller and calle are in the same assembly
- * i.e. do not inline across assemblies
+ * Check whether the callee may be inlined into the caller.
+ * JIT-time inlining is not limited to a version bubble: callees
+ * from any loaded assembly are allowed. Version bubble rules only
+ * apply to ReadyToRun images, which crossgen enforces. Successful
+ * inlines are recorded through Module::AddInlining (see
+ * reportInliningDecision) so ReJIT can invalidate the inliners.
  *************************************************************/
 
 CorInfoInline CEEInfo::canInline (CORINFO_METHOD_HANDLE hCaller,
@@ -10913,6 +10917,14 @@ void CEEJitInfo::WriteCodeBytes()
         ExecutableWriterHolder<void> codeWriterHolder((void *)m_CodeHeader, m_codeWriteBufferSize);
         memcpy(codeWriterHolder.GetRW(), m_CodeHeaderRW, m_codeWriteBufferSize);
     }
+
+#ifdef FEATURE_JIT_COLD_CODE
+    if ((m_ColdCodeHeader != NULL) && (m_ColdCodeHeaderRW != m_ColdCodeHeader))
+    {
+        ExecutableWriterHolder<void> coldCodeWriterHolder((void *)m_ColdCodeHeader, m_coldCodeWriteBufferSize);
+        memcpy(coldCodeWriterHolder.GetRW(), m_ColdCodeHeaderRW, m_coldCodeWriteBufferSize);
+    }
+#endif // FEATURE_JIT_COLD_CODE
 }
 
 /*********************************************************************/
@@ -10947,6 +10959,13 @@ void CEEJitInfo::WriteCode(EEJitManager * jitMgr)
     // the code region, therefore we subtract the size of the CodeHeader.
     jitMgr->NibbleMapSet(m_pCodeHeap, m_CodeHeader->GetCodeStartAddress(), m_codeWriteBufferSize - sizeof(CodeHeader));
 
+#ifdef FEATURE_JIT_COLD_CODE
+    if (m_ColdCodeHeader != NULL)
+    {
+        jitMgr->NibbleMapSet(m_pCodeHeap, m_ColdCodeHeader->codeHeader.GetCodeStartAddress(), m_coldCodeWriteBufferSize - sizeof(ColdCodeHeader));
+    }
+#endif // FEATURE_JIT_COLD_CODE
+
 #if defined(TARGET_AMD64)
     // Publish the new unwind information in a way that the ETW stack crawler can find
     _ASSERTE(m_usedUnwindInfos == m_totalUnwindInfos);
@@ -11140,6 +11159,12 @@ void CEEJitInfo::CompressDebugInfo()
     EE_TO_JIT_TRANSITION();
 }
 
+#if defined(FEATURE_JIT_COLD_CODE) && defined(TARGET_AMD64)
+// Size of the unwind info of the cold part of a split main body: an UNWIND_INFO
+// without unwind codes, followed by the RUNTIME_FUNCTION of the hot part.
+#define CHAINED_UNWIND_INFO_SIZE ((uint32_t)(offsetof(UNWIND_INFO, UnwindCode) + sizeof(T_RUNTIME_FUNCTION)))
+#endif
+
 void reservePersonalityRoutineSpace(uint32_t &unwindSize)
 {
 #if defined(TARGET_X86)
@@ -11202,7 +11227,9 @@ void CEEJitInfo::reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unw
 
     JIT_TO_EE_TRANSITION_LEAF();
 
+#ifndef FEATURE_JIT_COLD_CODE
     CONSISTENCY_CHECK_MSG(!isColdCode, "Hot/Cold splitting is not supported in jitted code");
+#endif
     _ASSERTE_MSG(m_theUnwindBlock == NULL,
         "reserveUnwindInfo() can only be called before allocMem(), but allocMem() has already been called. "
         "This may indicate the JIT has hit a NO_WAY assert after calling allocMem(), and is re-JITting. "
@@ -11210,7 +11237,19 @@ void CEEJitInfo::reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unw
 
     uint32_t currentSize  = unwindSize;
 
-    reservePersonalityRoutineSpace(currentSize);
+#if defined(FEATURE_JIT_COLD_CODE) && defined(TARGET_AMD64)
+    if (isColdCode && !isFunclet)
+    {
+        // The JIT reports no unwind codes for the cold part of the main body,
+        // it gets chained unwind info without a personality routine instead.
+        _ASSERTE(unwindSize == 0);
+        currentSize = CHAINED_UNWIND_INFO_SIZE;
+    }
+    else
+#endif
+    {
+        reservePersonalityRoutineSpace(currentSize);
+    }
 
     m_totalUnwindSize += currentSize;
 
@@ -11236,9 +11275,9 @@ void CEEJitInfo::reserveUnwindInfo(bool isFunclet, bool isColdCode, uint32_t unw
 // Parameters:
 //
 //    pHotCode        main method code buffer, always filled in
-//    pColdCode       always NULL for jitted code
-//    startOffset     start of code block, relative to pHotCode
-//    endOffset       end of code block, relative to pHotCode
+//    pColdCode       cold code buffer if the block is cold code, NULL otherwise
+//    startOffset     start of code block, relative to pColdCode or pHotCode
+//    endOffset       end of code block, relative to pColdCode or pHotCode
 //    unwindSize      size of unwind info pointed to by pUnwindBlock
 //    pUnwindBlock    pointer to unwind info
 //    funcKind        type of funclet (main method code, handler, filter)
@@ -11261,10 +11300,12 @@ void CEEJitInfo::allocUnwindInfo (
         PRECONDITION(m_theUnwindBlock != NULL);
         PRECONDITION(m_usedUnwindSize < m_totalUnwindSize);
         PRECONDITION(m_usedUnwindInfos < m_totalUnwindInfos);
-        PRECONDITION(endOffset <= m_codeSize);
+        PRECONDITION((pColdCode != NULL) || (endOffset <= m_codeSize));
     } CONTRACTL_END;
 
+#ifndef FEATURE_JIT_COLD_CODE
     CONSISTENCY_CHECK_MSG(pColdCode == NULL, "Hot/Cold code splitting not supported for jitted code");
+#endif
 
     JIT_TO_EE_TRANSITION();
 
@@ -11297,9 +11338,19 @@ void CEEJitInfo::allocUnwindInfo (
     UNWIND_INFO * pUnwindInfo = (UNWIND_INFO *) &(m_theUnwindBlock[m_usedUnwindSize]);
     UNWIND_INFO * pUnwindInfoRW = (UNWIND_INFO *)((BYTE*)pUnwindInfo + writeableOffset);
 
-    m_usedUnwindSize += unwindSize;
+#if defined(FEATURE_JIT_COLD_CODE) && defined(TARGET_AMD64)
+    const bool isChainedUnwindInfo = (pColdCode != NULL) && (funcKind == CORJIT_FUNC_ROOT);
+    if (isChainedUnwindInfo)
+    {
+        m_usedUnwindSize += CHAINED_UNWIND_INFO_SIZE;
+    }
+    else
+#endif
+    {
+        m_usedUnwindSize += unwindSize;
 
-    reservePersonalityRoutineSpace(m_usedUnwindSize);
+        reservePersonalityRoutineSpace(m_usedUnwindSize);
+    }
 
     _ASSERTE(m_usedUnwindSize <= m_totalUnwindSize);
 
@@ -11310,7 +11361,9 @@ void CEEJitInfo::allocUnwindInfo (
 
     TADDR baseAddress = m_moduleBase;
 
-    size_t currentCodeSizeT = (size_t)pHotCode - baseAddress;
+    uint8_t * pCode = (pColdCode != NULL) ? pColdCode : pHotCode;
+
+    size_t currentCodeSizeT = (size_t)pCode - baseAddress;
 
     /* Check if currentCodeSizeT offset fits in 32-bits */
     if (!FitsInU4(currentCodeSizeT))
@@ -11370,10 +11423,28 @@ void CEEJitInfo::allocUnwindInfo (
 
 #elif defined(TARGET_AMD64)
 
-    pUnwindInfoRW->Flags = UNW_FLAG_EHANDLER | UNW_FLAG_UHANDLER;
+#ifdef FEATURE_JIT_COLD_CODE
+    if (isChainedUnwindInfo)
+    {
+        // Chain to the hot part of the main body, which is always reported first
+        pUnwindInfoRW->Version            = 1;
+        pUnwindInfoRW->Flags              = UNW_FLAG_CHAININFO;
+        pUnwindInfoRW->SizeOfProlog       = 0;
+        pUnwindInfoRW->CountOfUnwindCodes = 0;
+        pUnwindInfoRW->FrameRegister      = 0;
+        pUnwindInfoRW->FrameOffset        = 0;
 
-    ULONG * pPersonalityRoutineRW = (ULONG*)ALIGN_UP(&(pUnwindInfoRW->UnwindCode[pUnwindInfoRW->CountOfUnwindCodes]), sizeof(ULONG));
-    *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
+        PT_RUNTIME_FUNCTION pChainedFunctionRW = (PT_RUNTIME_FUNCTION)&(pUnwindInfoRW->UnwindCode[0]);
+        *pChainedFunctionRW = *m_CodeHeaderRW->GetUnwindInfo(0);
+    }
+    else
+#endif // FEATURE_JIT_COLD_CODE
+    {
+        pUnwindInfoRW->Flags = UNW_FLAG_EHANDLER | UNW_FLAG_UHANDLER;
+
+        ULONG * pPersonalityRoutineRW = (ULONG*)ALIGN_UP(&(pUnwindInfoRW->UnwindCode[pUnwindInfoRW->CountOfUnwindCodes]), sizeof(ULONG));
+        *pPersonalityRoutineRW = ExecutionManager::GetCLRPersonalityRoutineValue();
+    }
 
 #elif defined(TARGET_ARM64)
 
@@ -12207,7 +12278,9 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
 
     JIT_TO_EE_TRANSITION();
 
+#ifndef FEATURE_JIT_COLD_CODE
     _ASSERTE(pArgs->coldCodeSize == 0);
+#endif
     if (pArgs->coldCodeBlock)
     {
         pArgs->coldCodeBlock = NULL;
@@ -12291,10 +12364,14 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
             pArgs->hotCodeSize + pArgs->coldCodeSize, pArgs->roDataSize, totalSize.Value(), pArgs->flag, GetClrInstanceId());
     }
 
-    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag, &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
+    m_jitManager->allocCode(m_pMethodBeingCompiled, totalSize.Value(), GetReserveForJumpStubs(), pArgs->flag,
+                            m_jitFlags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1), &m_CodeHeader, &m_CodeHeaderRW, &m_codeWriteBufferSize, &m_pCodeHeap
                           , &m_pRealCodeHeader
 #ifdef FEATURE_EH_FUNCLETS
                           , m_totalUnwindInfos
+#endif
+#ifdef FEATURE_JIT_COLD_CODE
+                          , pArgs->coldCodeSize, &m_ColdCodeHeader
 #endif
                           );
 
@@ -12302,6 +12379,32 @@ void CEEJitInfo::allocMem (AllocMemArgs *pArgs)
     m_moduleBase = m_pCodeHeap->GetModuleBase();
 #endif
 
+#ifdef FEATURE_JIT_COLD_CODE
+    if (m_ColdCodeHeader != NULL)
+    {
+        _ASSERTE(m_pRealCodeHeader == NULL);
+
+        m_coldCodeWriteBufferSize = sizeof(ColdCodeHeader) + pArgs->coldCodeSize;
+
+        if (ExecutableAllocator::IsWXORXEnabled())
+        {
+            m_ColdCodeHeaderRW = (ColdCodeHeader *)new BYTE[m_coldCodeWriteBufferSize];
+        }
+        else
+        {
+            m_ColdCodeHeaderRW = m_ColdCodeHeader;
+        }
+
+        // Lookups from the cold part find the method through the shared real code header
+        m_ColdCodeHeaderRW->pHotCodeHeader = m_CodeHeader;
+        m_ColdCodeHeaderRW->codeHeader.SetRealCodeHeader((BYTE *)(RealCodeHeader *)m_CodeHeaderRW->pRealCodeHeader);
+        m_CodeHeaderRW->SetColdCode(m_ColdCodeHeader->codeHeader.GetCodeStartAddress(), codeSize, pArgs->coldCodeSize);
+
+        pArgs->coldCodeBlock = m_ColdCodeHeader + 1;
+        pArgs->coldCodeBlockRW = m_ColdCodeHeaderRW + 1;
+    }
+#endif // FEATURE_JIT_COLD_CODE
+
     BYTE* current = (BYTE *)m_CodeHeader->GetCodeStartAddress();
     size_t writeableOffset = (BYTE *)m_CodeHeaderRW - (BYTE *)m_CodeHeader;
 
@@ -12771,6 +12874,16 @@ static CORJIT_FLAGS GetCompileFlags(PrepareCodeConfig* prepareConfig, MethodDesc
     else if (g_pConfig->TieredPGO() && flags.IsSet(CORJIT_FLAGS::CORJIT_FLAG_TIER1))
     {
         flags.Set(CORJIT_FLAGS::CORJIT_FLAG_BBOPT);
+
+#ifdef FEATURE_JIT_COLD_CODE
+        // The cold part is allocated from the code heap of the hot part, which
+        // is not supported by the code heaps of dynamic methods.
+        if (!IsDynamicScope(methodInfo->scope) &&
+            (CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_TieredPGO_HotColdSplitting) != 0))
+        {
+            flags.Set(CORJIT_FLAGS::CORJIT_FLAG_PROCSPLIT);
+        }
+#endif // FEATURE_JIT_COLD_CODE
     }
 
 #endif
@@ -654,6 +654,15 @@ public:
         m_pRealCodeHeader = NULL;
         m_pCodeHeap = NULL;
 
+#ifdef FEATURE_JIT_COLD_CODE
+        if (m_ColdCodeHeaderRW != m_ColdCodeHeader)
+            freeArrayInternal(m_ColdCodeHeaderRW);
+
+        m_ColdCodeHeader = NULL;
+        m_ColdCodeHeaderRW = NULL;
+        m_coldCodeWriteBufferSize = 0;
+#endif
+
         if (m_pOffsetMapping != NULL)
             freeArrayInternal(m_pOffsetMapping);
 
@@ -764,6 +773,11 @@ public:
           m_codeWriteBufferSize(0),
           m_pRealCodeHeader(NULL),
           m_pCodeHeap(NULL),
+#ifdef FEATURE_JIT_COLD_CODE
+          m_ColdCodeHeader(NULL),
+          m_ColdCodeHeaderRW(NULL),
+          m_coldCodeWriteBufferSize(0),
+#endif
           m_ILHeader(header),
 #ifdef FEATURE_EH_FUNCLETS
           m_moduleBase(0),
@@ -817,6 +831,11 @@ public:
         if (m_CodeHeaderRW != m_CodeHeader)
             freeArrayInternal(m_CodeHeaderRW);
 
+#ifdef FEATURE_JIT_COLD_CODE
+        if (m_ColdCodeHeaderRW != m_ColdCodeHeader)
+            freeArrayInternal(m_ColdCodeHeaderRW);
+#endif
+
         if (m_pOffsetMapping != NULL)
             freeArrayInternal(m_pOffsetMapping);
 
@@ -912,6 +931,11 @@ protected :
     size_t                  m_codeWriteBufferSize;
     BYTE*                   m_pRealCodeHeader;
     HeapList*               m_pCodeHeap;
+#ifdef FEATURE_JIT_COLD_CODE
+    ColdCodeHeader*         m_ColdCodeHeader;   // descriptor for the cold part of split code - read/execute address
+    ColdCodeHeader*         m_ColdCodeHeaderRW; // descriptor for the cold part of split code - code write scratch buffer address
+    size_t                  m_coldCodeWriteBufferSize;
+#endif
     COR_ILMETHOD_DECODER *  m_ILHeader;     // the code header as exist in the file
 #ifdef FEATURE_EH_FUNCLETS
     TADDR                   m_moduleBase;       // Base for unwind Infos
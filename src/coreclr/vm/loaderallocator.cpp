@@ -65,6 +65,7 @@ LoaderAllocator::LoaderAllocator(bool collectible) :
     m_pCodeHeapInitialAlloc = NULL;
     m_pVSDHeapInitialAlloc = NULL;
     m_pLastUsedCodeHeap = NULL;
+    m_pLastUsedTier1CodeHeap = NULL;
     m_pLastUsedDynamicCodeHeap = NULL;
     m_pJumpStubCache = NULL;
     m_IsCollectible = collectible;
@@ -574,17 +575,24 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
         // handles first
         pDomainLoaderAllocatorDestroyIterator->CleanupDependentHandlesToNativeObjects();
 
-        // The following code was previously happening on delete ~DomainAssembly->Terminate
-        // We are moving this part here in order to make sure that we can unload a LoaderAllocator
-        // that didn't have a DomainAssembly
-        // (we have now a LoaderAllocator with 0-n DomainAssembly)
+        pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+    }
+
+    // The following code was previously happening on delete ~DomainAssembly->Terminate
+    // We are moving this part here in order to make sure that we can unload a LoaderAllocator
+    // that didn't have a DomainAssembly
+    // (we have now a LoaderAllocator with 0-n DomainAssembly)
 
-        // This cleanup code starts resembling parts of AppDomain::Terminate too much.
-        // It would be useful to reduce duplication and also establish clear responsibilities
-        // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
-        // and LoaderAllocator::~LoaderAllocator. We need to establish how these
-        // cleanup paths interact with app-domain unload and process tear-down, too.
+    // This cleanup code starts resembling parts of AppDomain::Terminate too much.
+    // It would be useful to reduce duplication and also establish clear responsibilities
+    // for LoaderAllocator::Destroy, Assembly::Terminate, LoaderAllocator::Terminate
+    // and LoaderAllocator::~LoaderAllocator. We need to establish how these
+    // cleanup paths interact with app-domain unload and process tear-down, too.
 
+    // All the LoaderAllocators collected together share a single EE suspension, so unloading
+    // many of them at once doesn't pause the process once per LoaderAllocator.
+    if (pFirstDestroyedLoaderAllocator != NULL)
+    {
         if (!IsAtProcessExit())
         {
             // Suspend the EE to do some clean up that can only occur
@@ -600,10 +608,15 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             FlushVirtualFunctionPointerCaches();
         }
 
-        ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
-        pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+        pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+        while (pDomainLoaderAllocatorDestroyIterator != NULL)
+        {
+            ExecutionManager::Unload(pDomainLoaderAllocatorDestroyIterator);
+            pDomainLoaderAllocatorDestroyIterator->UninitVirtualCallStubManager();
+
+            pDomainLoaderAllocatorDestroyIterator = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
+        }
 
-        // TODO: Do we really want to perform this on each LoaderAllocator?
         MethodTable::ClearMethodDataCache();
 
         if (!IsAtProcessExit())
@@ -611,7 +624,11 @@ void LoaderAllocator::GCLoaderAllocators(LoaderAllocator* pOriginalLoaderAllocat
             // Resume the EE.
             ThreadSuspend::RestartEE(FALSE, TRUE);
         }
+    }
 
+    pDomainLoaderAllocatorDestroyIterator = pFirstDestroyedLoaderAllocator;
+    while (pDomainLoaderAllocatorDestroyIterator != NULL)
+    {
         // Because RegisterLoaderAllocatorForDeletion is modifying m_pLoaderAllocatorDestroyNext, we are saving it here
         LoaderAllocator* pLoaderAllocatorDestroyNext = pDomainLoaderAllocatorDestroyIterator->m_pLoaderAllocatorDestroyNext;
 
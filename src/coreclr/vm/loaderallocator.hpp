@@ -360,6 +360,7 @@ public:
 
     // ExecutionManager caches
     void * m_pLastUsedCodeHeap;
+    void * m_pLastUsedTier1CodeHeap;
     void * m_pLastUsedDynamicCodeHeap;
     void * m_pJumpStubCache;
 
@@ -1453,6 +1453,85 @@ void OleVariant::ClearBSTRArray(void *oleArray, SIZE_T cElements, MethodTable *p
 /* ------------------------------------------------------------------------- *
  * Structure marshaling routines
  * ------------------------------------------------------------------------- */
+// Determines whether the native layout of the record matches its managed layout field for field,
+// with the only difference being that one byte bool fields must be normalized to 0 or 1. Such records
+// contain no object references, so arrays of them can be block copied like blittable arrays.
+BOOL OleVariant::GetNormalizedBoolRecordLayout(MethodTable* pInterfaceMT, NormalizedBoolRecordLayout* pLayout)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_ANY;
+        PRECONDITION(CheckPointer(pInterfaceMT));
+        PRECONDITION(CheckPointer(pLayout));
+    }
+    CONTRACTL_END;
+
+    pLayout->cBoolFields = 0;
+
+    if (!pInterfaceMT->IsValueType() || !pInterfaceMT->HasLayout() || pInterfaceMT->ContainsGCPointers() || pInterfaceMT->GetClass()->IsInlineArray())
+        return FALSE;
+
+    if (pInterfaceMT->GetNativeSize() != pInterfaceMT->GetNumInstanceFieldBytes())
+        return FALSE;
+
+    EEClassNativeLayoutInfo const* pNativeLayoutInfo = pInterfaceMT->GetNativeLayoutInfo();
+    NativeFieldDescriptor const* pFieldDescriptors = pNativeLayoutInfo->GetNativeFieldDescriptors();
+
+    for (UINT32 i = 0; i < pNativeLayoutInfo->GetNumFields(); i++)
+    {
+        NativeFieldDescriptor const& nativeFieldDescriptor = pFieldDescriptors[i];
+        FieldDesc* pFD = nativeFieldDescriptor.GetFieldDesc();
+
+        if (nativeFieldDescriptor.GetExternalOffset() != pFD->GetOffset())
+            return FALSE;
+
+        if (nativeFieldDescriptor.GetCategory() == NativeFieldCategory::NESTED)
+        {
+            // Nested records must be blittable themselves
+            MethodTable* pNestedMT = nativeFieldDescriptor.GetNestedNativeMethodTable();
+            if (nativeFieldDescriptor.GetNumElements() != 1 || !pNestedMT->IsValueType() || !pNestedMT->IsBlittable()
+                || nativeFieldDescriptor.NativeSize() != pFD->GetSize())
+            {
+                return FALSE;
+            }
+            continue;
+        }
+
+        CorElementType fieldType = pFD->GetFieldType();
+        if (!CorTypeInfo::IsPrimitiveType(fieldType) || nativeFieldDescriptor.NativeSize() != pFD->GetSize())
+            return FALSE;
+
+        if (fieldType == ELEMENT_TYPE_BOOLEAN)
+        {
+            if (pLayout->cBoolFields == MaxNormalizedBoolFields)
+                return FALSE;
+            pLayout->boolFieldOffsets[pLayout->cBoolFields++] = pFD->GetOffset();
+        }
+    }
+
+    return TRUE;
+}
+
+void OleVariant::NormalizeBoolFields(BYTE* pData, SIZE_T cElements, SIZE_T elemSize, const NormalizedBoolRecordLayout& layout)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (layout.cBoolFields == 0)
+        return;
+
+    BYTE* pDataEnd = pData + elemSize * cElements;
+    for (; pData < pDataEnd; pData += elemSize)
+    {
+        for (UINT32 i = 0; i < layout.cBoolFields; i++)
+        {
+            BYTE* pBool = pData + layout.boolFieldOffsets[i];
+            *pBool = (*pBool != 0) ? 1 : 0;
+        }
+    }
+}
+
 void OleVariant::MarshalNonBlittableRecordArrayOleToCom(void *oleArray, BASEARRAYREF *pComArray,
                                                         MethodTable *pInterfaceMT, PCODE pManagedMarshalerCode)
 {
@@ -1475,6 +1554,15 @@ void OleVariant::MarshalNonBlittableRecordArrayOleToCom(void *oleArray, BASEARRA
     BYTE *pOle = (BYTE *) oleArray;
     BYTE *pOleEnd = pOle + elemSize * elementCount;
 
+    NormalizedBoolRecordLayout layout;
+    if (GetNormalizedBoolRecordLayout(pInterfaceMT, &layout) && (*pComArray)->GetComponentSize() == elemSize)
+    {
+        BYTE* managedData = (*pComArray)->GetDataPtr();
+        memcpyNoGCRefs(managedData, pOle, elemSize * elementCount);
+        NormalizeBoolFields(managedData, elementCount, elemSize, layout);
+        return;
+    }
+
     SIZE_T dstofs = ArrayBase::GetDataPtrOffset( (*pComArray)->GetMethodTable() );
     while (pOle < pOleEnd)
     {
@@ -1510,6 +1598,14 @@ void OleVariant::MarshalNonBlittableRecordArrayComToOle(BASEARRAYREF *pComArray,
     BYTE *pOle = (BYTE *) oleArray;
     BYTE *pOleEnd = pOle + elemSize * cElements;
 
+    NormalizedBoolRecordLayout layout;
+    if (GetNormalizedBoolRecordLayout(pInterfaceMT, &layout) && (*pComArray)->GetComponentSize() == elemSize)
+    {
+        memcpyNoGCRefs(pOle, (*pComArray)->GetDataPtr(), elemSize * cElements);
+        NormalizeBoolFields(pOle, cElements, elemSize, layout);
+        return;
+    }
+
     if (!fOleArrayIsValid)
     {
         // field marshalers assume that the native structure is valid
@@ -1540,6 +1636,11 @@ void OleVariant::ClearNonBlittableRecordArray(void *oleArray, SIZE_T cElements,
     }
     CONTRACTL_END;
 
+    // Records that are block copied have nothing to clean up
+    NormalizedBoolRecordLayout layout;
+    if (GetNormalizedBoolRecordLayout(pInterfaceMT, &layout))
+        return;
+
     SIZE_T elemSize     = pInterfaceMT->GetNativeSize();
     SIZE_T componentSize = TypeHandle(pInterfaceMT).MakeSZArray().GetMethodTable()->GetComponentSize();
     BYTE *pOle = (BYTE *) oleArray;
@@ -203,6 +203,17 @@ private:
                                              SIZE_T cElements, MethodTable* pInterfaceMT,
                                              PCODE pManagedMarshalerCode);
 
+    // Records whose native layout only differs from the managed layout by the values stored in
+    // one byte bool fields can be marshalled with a block copy instead of the IL stub.
+    static const UINT32 MaxNormalizedBoolFields = 8;
+    struct NormalizedBoolRecordLayout
+    {
+        UINT32 cBoolFields;
+        UINT32 boolFieldOffsets[MaxNormalizedBoolFields];
+    };
+    static BOOL GetNormalizedBoolRecordLayout(MethodTable* pInterfaceMT, NormalizedBoolRecordLayout* pLayout);
+    static void NormalizeBoolFields(BYTE* pData, SIZE_T cElements, SIZE_T elemSize, const NormalizedBoolRecordLayout& layout);
+
     static void MarshalLPWSTRArrayOleToCom(void* oleArray, BASEARRAYREF* pComArray,
                                             MethodTable* pInterfaceMT, PCODE pManagedMarshalerCode);
     static void MarshalLPWSTRRArrayComToOle(BASEARRAYREF* pComArray, void* oleArray,
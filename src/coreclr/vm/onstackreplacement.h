@@ -23,6 +23,7 @@ struct PerPatchpointInfo
     PerPatchpointInfo() : 
         m_osrMethodCode(0),
         m_patchpointCount(0),
+        m_frameCount(0),
         m_flags(0)
 #if _DEBUG
         , m_patchpointId(0)
@@ -42,6 +43,8 @@ struct PerPatchpointInfo
     PCODE m_osrMethodCode;
     // Number of times jitted code has called the helper at this patchpoint.
     LONG m_patchpointCount;
+    // Number of distinct frames seen calling the helper at this patchpoint.
+    LONG m_frameCount;
     // Status of this patchpoint
     LONG m_flags;
 
@@ -200,6 +200,11 @@ PerfMap::PerfMap()
 
     // Initialize with no failures.
     m_ErrorEncountered = false;
+
+    m_FileStream = nullptr;
+    m_WriteBuffer = nullptr;
+    m_WriteBufferSize = 0;
+    m_WriteBufferUsed = 0;
 }
 
 // Clean-up resources.
@@ -207,6 +212,11 @@ PerfMap::~PerfMap()
 {
     LIMITED_METHOD_CONTRACT;
 
+    FlushWriteBuffer();
+
+    delete[] m_WriteBuffer;
+    m_WriteBuffer = nullptr;
+
     delete m_FileStream;
     m_FileStream = nullptr;
 }
@@ -234,6 +244,18 @@ void PerfMap::OpenFile(SString& path)
         {
             delete m_FileStream;
             m_FileStream = nullptr;
+            return;
+        }
+
+        // Without a buffer, lines are written through as they are logged.
+        ULONG bufferSize = CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_PerfMapWriteBufferSize);
+        if (bufferSize > 0)
+        {
+            m_WriteBuffer = new (nothrow) char[bufferSize];
+            if (m_WriteBuffer != nullptr)
+            {
+                m_WriteBufferSize = bufferSize;
+            }
         }
     }
 }
@@ -253,24 +275,61 @@ void PerfMap::WriteLine(SString& line)
 
     EX_TRY
     {
-        // Write the line.
-        // The PAL already takes a lock when writing, so we don't need to do so here.
         const char * strLine = line.GetUTF8();
         ULONG inCount = line.GetCount();
-        ULONG outCount;
-        m_FileStream->Write(strLine, inCount, &outCount);
 
-        if (inCount != outCount)
+        if (m_WriteBuffer != nullptr)
         {
-            // This will cause us to stop writing to the file.
-            // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
-            m_ErrorEncountered = true;
+            if (inCount > m_WriteBufferSize - m_WriteBufferUsed)
+            {
+                FlushWriteBuffer();
+            }
+
+            if (inCount <= m_WriteBufferSize - m_WriteBufferUsed)
+            {
+                memcpy(m_WriteBuffer + m_WriteBufferUsed, strLine, inCount);
+                m_WriteBufferUsed += inCount;
+                return;
+            }
         }
 
+        WriteToFile(strLine, inCount);
     }
     EX_CATCH{} EX_END_CATCH(SwallowAllExceptions);
 }
 
+void PerfMap::WriteToFile(const char * data, ULONG count)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_FileStream == nullptr || m_ErrorEncountered)
+    {
+        return;
+    }
+
+    // The PAL already takes a lock when writing, so we don't need to do so here.
+    ULONG outCount;
+    m_FileStream->Write(data, count, &outCount);
+
+    if (count != outCount)
+    {
+        // This will cause us to stop writing to the file.
+        // The file will still remain open until shutdown so that we don't have to take a lock at this level when we touch the file stream.
+        m_ErrorEncountered = true;
+    }
+}
+
+void PerfMap::FlushWriteBuffer()
+{
+    LIMITED_METHOD_CONTRACT;
+
+    if (m_WriteBufferUsed > 0)
+    {
+        WriteToFile(m_WriteBuffer, m_WriteBufferUsed);
+        m_WriteBufferUsed = 0;
+    }
+}
+
 void PerfMap::LogJITCompiledMethod(MethodDesc * pMethod, PCODE pCode, size_t codeSize, PrepareCodeConfig *pConfig)
 {
     LIMITED_METHOD_CONTRACT;
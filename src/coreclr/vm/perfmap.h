@@ -33,6 +33,11 @@ private:
     // Set to true if an error is encountered when writing to the file.
     bool m_ErrorEncountered;
 
+    // Lines are collected here and written in batches when PerfMapWriteBufferSize is set.
+    char * m_WriteBuffer;
+    ULONG m_WriteBufferSize;
+    ULONG m_WriteBufferUsed;
+
     // Construct a new map
     PerfMap();
 
@@ -42,6 +47,12 @@ private:
     // Write a line to the map file.
     void WriteLine(SString & line);
 
+    // Write the data to the map file, bypassing the write buffer.
+    void WriteToFile(const char * data, ULONG count);
+
+    // Write out any buffered lines.
+    void FlushWriteBuffer();
+
     // Default to /tmp or use DOTNET_PerfMapJitDumpPath if set
     static const char* InternalConstructPath();
 
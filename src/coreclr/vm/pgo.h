@@ -18,6 +18,12 @@ public:
     static void Initialize();
     static void Shutdown();
 
+#ifndef DACCESS_COMPILE
+    // Returns true if profile data for this method was loaded from a previous run (ReadPGOData),
+    // in which case there is no need to instrument it again.
+    static bool HasTextFormatPgoData(MethodDesc* pMD);
+#endif // DACCESS_COMPILE
+
 #endif // FEATURE_PGO
 
 public:
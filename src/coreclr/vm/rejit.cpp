@@ -487,6 +487,10 @@ HRESULT ReJitManager::UpdateActiveILVersions(
     //contains them was unloaded.
     SHash<CodeActivationBatchTraits> mgrToCodeActivationBatch;
     CDynArray<CodeVersionManager::CodePublishError> errorRecords;
+
+    // Inlinees whose R2R inliners need to be found. These are looked up together after the loop below
+    // so that the loaded assemblies are only walked once per request instead of once per method.
+    CDynArray<MethodInModule> nativeInlinees;
     for (ULONG i = 0; i < cFunctions; i++)
     {
         Module * pModule = reinterpret_cast< Module * >(rgModuleIDs[i]);
@@ -548,11 +552,12 @@ HRESULT ReJitManager::UpdateActiveILVersions(
 
         if ((flags & COR_PRF_REJIT_BLOCK_INLINING) == COR_PRF_REJIT_BLOCK_INLINING)
         {
-            hr = UpdateNativeInlinerActiveILVersions(&mgrToCodeActivationBatch, pModule, rgMethodDefs[i], fIsRevert, flags);
-            if (FAILED(hr))
+            MethodInModule * pNativeInlinee = nativeInlinees.Append();
+            if (pNativeInlinee == NULL)
             {
-                return hr;
+                return E_OUTOFMEMORY;
             }
+            *pNativeInlinee = MethodInModule(pModule, rgMethodDefs[i]);
 
             if (pMD != NULL)
             {
@@ -566,6 +571,15 @@ HRESULT ReJitManager::UpdateActiveILVersions(
         }
     }   // for (ULONG i = 0; i < cFunctions; i++)
 
+    if (nativeInlinees.Count() != 0)
+    {
+        hr = UpdateNativeInlinerActiveILVersions(&mgrToCodeActivationBatch, nativeInlinees.Ptr(), nativeInlinees.Count(), fIsRevert, flags);
+        if (FAILED(hr))
+        {
+            return hr;
+        }
+    }
+
     // For each code versioning mgr, if there's work to do,
     // enter the code versioning mgr's crst, and do the batched work.
     SHash<CodeActivationBatchTraits>::Iterator beginIter = mgrToCodeActivationBatch.Begin();
@@ -709,8 +723,8 @@ HRESULT ReJitManager::UpdateActiveILVersion(
 // static
 HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
     SHash<CodeActivationBatchTraits>   *pMgrToCodeActivationBatch,
-    Module                             *pInlineeModule,
-    mdMethodDef                         inlineeMethodDef,
+    MethodInModule                     *rgInlinees,
+    int                                 cInlinees,
     BOOL                                fIsRevert,
     COR_PRF_REJIT_FLAGS                 flags)
 {
@@ -724,13 +738,12 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
     CONTRACTL_END;
 
     _ASSERTE(pMgrToCodeActivationBatch != NULL);
-    _ASSERTE(pInlineeModule != NULL);
-    _ASSERTE(RidFromToken(inlineeMethodDef) != 0);
+    _ASSERTE(rgInlinees != NULL && cInlinees > 0);
 
     HRESULT hr = S_OK;
 
-    // Iterate through all modules, for any that are NGEN or R2R need to check if there are inliners there and call
-    // RequestReJIT on them
+    // Iterate through all modules once, for any that are R2R need to check if there are inliners of any of the
+    // inlinees there and call RequestReJIT on them
     AppDomain::AssemblyIterator assemblyIterator = AppDomain::GetCurrentDomain()->IterateAssembliesEx((AssemblyIterationFlags) (kIncludeLoaded | kIncludeExecution));
     CollectibleAssemblyHolder<Assembly *> pAssembly;
     NativeImageInliningIterator inlinerIter;
@@ -739,9 +752,17 @@ HRESULT ReJitManager::UpdateNativeInlinerActiveILVersions(
         _ASSERTE(pAssembly != NULL);
 
         Module * pModule = pAssembly->GetModule();
-        if (pModule->HasReadyToRunInlineTrackingMap())
+        if (!pModule->HasReadyToRunInlineTrackingMap())
         {
-            inlinerIter.Reset(pModule, MethodInModule(pInlineeModule, inlineeMethodDef));
+            continue;
+        }
+
+        for (int i = 0; i < cInlinees; i++)
+        {
+            _ASSERTE(rgInlinees[i].m_module != NULL);
+            _ASSERTE(RidFromToken(rgInlinees[i].m_methodDef) != 0);
+
+            inlinerIter.Reset(pModule, rgInlinees[i]);
 
             while (inlinerIter.Next())
             {
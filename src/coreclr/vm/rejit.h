@@ -164,8 +164,8 @@ private:
 
     static HRESULT UpdateNativeInlinerActiveILVersions(
         SHash<CodeActivationBatchTraits> *pMgrToCodeActivationBatch,
-        Module             *pInlineeModule,
-        mdMethodDef         inlineeMethodDef,
+        MethodInModule     *rgInlinees,
+        int                 cInlinees,
         BOOL                fIsRevert,
         COR_PRF_REJIT_FLAGS flags);
 
@@ -0,0 +1,125 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: RuntimeMetrics.cpp
+//
+// ===========================================================================
+
+#include "common.h"
+#include "runtimemetrics.h"
+#include "gcheaputilities.h"
+#include "jitinterface.h"
+
+RuntimeMetricsPage* RuntimeMetrics::s_pPage;
+LONG RuntimeMetrics::s_updateInProgress;
+
+namespace
+{
+    // This prevents tearing of 64 bit values on 32 bit systems
+    uint64_t LoadJitCounter(int64_t volatile* pCounter)
+    {
+        LIMITED_METHOD_CONTRACT;
+#ifdef TARGET_64BIT
+        return (uint64_t)VolatileLoad(pCounter);
+#else
+        return (uint64_t)InterlockedCompareExchangeT((LONG64 volatile*)pCounter, (LONG64)0, (LONG64)0);
+#endif // TARGET_64BIT
+    }
+}
+
+void RuntimeMetrics::StaticInitialize()
+{
+    STANDARD_VM_CONTRACT;
+
+    NewArrayHolder<WCHAR> filename(CLRConfig::GetConfigValue(CLRConfig::UNSUPPORTED_RuntimeMetricsFilename));
+    if (filename == NULL || *filename == W('\0'))
+        return;
+
+    WCHAR filenameReplaced[MAX_PATH];
+    ReplacePid(filename, filenameReplaced, MAX_PATH);
+
+    // Readers only need read access, but the file is created and sized by the runtime
+    HandleHolder hFile(WszCreateFile(filenameReplaced, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL));
+    if (hFile == INVALID_HANDLE_VALUE)
+        return;
+
+    DWORD size = (DWORD)ALIGN_UP(sizeof(RuntimeMetricsPage), GetOsPageSize());
+    HandleHolder hMap(CreateFileMapping(hFile, NULL, PAGE_READWRITE, 0, size, NULL));
+    if (hMap == NULL)
+        return;
+
+    RuntimeMetricsPage* pPage = (RuntimeMetricsPage*)MapViewOfFile(hMap, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    if (pPage == NULL)
+        return;
+
+    LARGE_INTEGER frequency;
+    QueryPerformanceFrequency(&frequency);
+
+    pPage->Version = RUNTIME_METRICS_PAGE_VERSION;
+    pPage->Size = sizeof(RuntimeMetricsPage);
+    pPage->ProcessId = GetCurrentProcessId();
+    pPage->TimestampFrequency = (uint64_t)frequency.QuadPart;
+
+    // Readers treat the page as valid once the magic is set
+    VolatileStore(&pPage->Magic, (uint32_t)RUNTIME_METRICS_PAGE_MAGIC);
+
+    s_pPage = pPage;
+}
+
+void RuntimeMetrics::OnGCFinished(int condemnedGeneration)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    if (s_pPage == NULL)
+        return;
+
+    // A background GC can finish while a foreground GC is publishing, the next GC catches up
+    if (InterlockedCompareExchange(&s_updateInProgress, 1, 0) != 0)
+        return;
+
+    Update(condemnedGeneration);
+
+    VolatileStore(&s_updateInProgress, (LONG)0);
+}
+
+void RuntimeMetrics::Update(int condemnedGeneration)
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    RuntimeMetricsPage* pPage = s_pPage;
+    IGCHeap* pHeap = GCHeapUtilities::GetGCHeap();
+
+    LARGE_INTEGER timestamp;
+    QueryPerformanceCounter(&timestamp);
+
+    // Odd sequence tells readers that an update is in progress
+    InterlockedIncrement((LONG*)&pPage->Sequence);
+
+    pPage->UpdateTimestamp = (uint64_t)timestamp.QuadPart;
+    for (int generation = 0; generation < (int)ARRAY_SIZE(pPage->GCCount); generation++)
+    {
+        pPage->GCCount[generation] = (uint64_t)pHeap->CollectionCount(generation);
+    }
+    pPage->GCTotalAllocatedBytes = pHeap->GetTotalAllocatedBytes();
+    pPage->GCTotalPauseDuration = (uint64_t)pHeap->GetTotalPauseDuration();
+    pPage->GCLastCondemnedGeneration = (uint32_t)condemnedGeneration;
+    pPage->GCMemoryLoad = pHeap->GetMemoryLoad();
+
+    pPage->JitMethodCount = LoadJitCounter(&g_cMethodsJitted);
+    pPage->JitILBytes = LoadJitCounter(&g_cbILJitted);
+    pPage->JitTimeInTicks = LoadJitCounter(&g_c100nsTicksInJit);
+
+    InterlockedIncrement((LONG*)&pPage->Sequence);
+}
@@ -0,0 +1,63 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+// ===========================================================================
+// File: RuntimeMetrics.h
+//
+// ===========================================================================
+
+#ifndef RUNTIME_METRICS_H
+#define RUNTIME_METRICS_H
+
+#define RUNTIME_METRICS_PAGE_MAGIC 0x4d54524e // 'NRTM'
+#define RUNTIME_METRICS_PAGE_VERSION 1
+
+// Layout of the shared memory page. This is a contract with external readers: fields are only
+// ever appended, and Size tells readers which of them a given runtime publishes.
+//
+// The page is written by a single writer at a time using a sequence lock. Sequence is odd while
+// an update is in progress, so readers copy the page and retry if Sequence was odd or changed
+// across the copy.
+struct RuntimeMetricsPage
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t Size;
+    uint32_t ProcessId;
+    volatile uint32_t Sequence;
+    uint32_t Reserved;
+
+    // Refreshed at the end of each GC
+    uint64_t UpdateTimestamp;       // QueryPerformanceCounter ticks
+    uint64_t TimestampFrequency;    // QueryPerformanceFrequency
+    uint64_t GCCount[3];            // Collections of each generation, as GC.CollectionCount
+    uint64_t GCTotalAllocatedBytes;
+    uint64_t GCTotalPauseDuration;  // In 100ns ticks
+    uint32_t GCLastCondemnedGeneration;
+    uint32_t GCMemoryLoad;          // Percent of physical memory in use at the last GC
+
+    uint64_t JitMethodCount;
+    uint64_t JitILBytes;
+    uint64_t JitTimeInTicks;        // In 100ns ticks
+};
+
+// RuntimeMetrics publishes a handful of runtime metrics in a memory mapped file so that
+// external agents can sample them without an EventPipe session or any cooperation from the
+// process. It is enabled by setting DOTNET_RuntimeMetricsFilename, in which "{pid}" is replaced
+// by the process id.
+class RuntimeMetrics
+{
+public:
+    static void StaticInitialize();
+
+    // Called by the GC at the end of each collection
+    static void OnGCFinished(int condemnedGeneration);
+
+private:
+    static void Update(int condemnedGeneration);
+
+private:
+    static RuntimeMetricsPage* s_pPage;
+    static LONG s_updateInProgress;
+};
+
+#endif // RUNTIME_METRICS_H
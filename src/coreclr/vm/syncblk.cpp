@@ -1193,7 +1193,11 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintp
             GCWeakPtrScanElement (nb, scanProc, lp1, lp2, fSetSyncBlockCleanup);
         }
 
-
+        // Every entry of the table has been visited and the dead ones freed
+        if (((ScanContext*)lp1)->promotion)
+        {
+            RebuildFreeSyncTableList();
+        }
     }
 
     if (fSetSyncBlockCleanup)
@@ -1222,6 +1226,46 @@ void SyncBlockCache::GCWeakPtrScan(HANDLESCANPROC scanProc, uintptr_t lp1, uintp
 #endif // VERIFY_HEAP
 }
 
+// Called by the GC once all the entries of the table have been scanned, while it has exclusive access
+// to the table. Free entries at the end of the table are returned to the never-used part, so that the
+// next scans stop at the last entry in use. The remaining free entries are relinked in increasing index
+// order, so that new sync blocks are allocated at the bottom of the table and its top can become free
+// again. The scan cost then follows the number of live entries rather than the peak number ever used.
+void SyncBlockCache::RebuildFreeSyncTableList()
+{
+    CONTRACTL
+    {
+        INSTANCE_CHECK;
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    SyncTableEntry* pEntries = SyncTableEntry::GetSyncTableEntry();
+
+    DWORD freeSyncTableIndex = m_FreeSyncTableIndex;
+    while (freeSyncTableIndex > 1 && ((size_t)pEntries[freeSyncTableIndex - 1].m_Object.Load() & 1) != 0)
+    {
+        freeSyncTableIndex--;
+        _ASSERTE(pEntries[freeSyncTableIndex].m_SyncBlock == NULL);
+        pEntries[freeSyncTableIndex].m_Object = (Object *)NULL;
+    }
+
+    size_t freeSyncTableList = 0;
+    for (DWORD nb = freeSyncTableIndex - 1; nb > 0; nb--)
+    {
+        if (((size_t)pEntries[nb].m_Object.Load() & 1) != 0)
+        {
+            pEntries[nb].m_Object = (Object *)(freeSyncTableList | 1);
+            freeSyncTableList = nb << 1;
+        }
+    }
+
+    m_FreeSyncTableList = freeSyncTableList;
+    m_FreeSyncTableIndex = freeSyncTableIndex;
+}
+
 /* Scan the weak pointers in the SyncBlockEntry and report them to the GC.  If the
    reference is dead, then return TRUE */
 
@@ -1595,15 +1639,18 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 return result;
             }
 
+            // From here on, spin only as long as spinning has recently paid off for this particular lock
+            const DWORD lockSpinCount = min(spinCount, awareLock->GetSpinCount());
+
             ++spinIteration;
-            if (spinIteration < spinCount)
+            if (spinIteration < lockSpinCount)
             {
                 while (true)
                 {
                     AwareLock::SpinWait(normalizationInfo, spinIteration);
 
                     ++spinIteration;
-                    if (spinIteration >= spinCount)
+                    if (spinIteration >= lockSpinCount)
                     {
                         // The last lock attempt for this spin will be done after the loop
                         break;
@@ -1612,6 +1659,7 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                     result = awareLock->TryEnterInsideSpinLoopHelper(pCurThread);
                     if (result == AwareLock::EnterHelperResult_Entered)
                     {
+                        awareLock->RecordSpinResult(true);
                         return AwareLock::EnterHelperResult_Entered;
                     }
                     if (result == AwareLock::EnterHelperResult_UseSlowPath)
@@ -1621,7 +1669,9 @@ AwareLock::EnterHelperResult ObjHeader::EnterObjMonitorHelperSpin(Thread* pCurTh
                 }
             }
 
-            if (awareLock->TryEnterAfterSpinLoopHelper(pCurThread))
+            bool acquiredLock = awareLock->TryEnterAfterSpinLoopHelper(pCurThread);
+            awareLock->RecordSpinResult(acquiredLock);
+            if (acquiredLock)
             {
                 return AwareLock::EnterHelperResult_Entered;
             }
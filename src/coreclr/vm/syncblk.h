@@ -450,7 +450,14 @@ private:
     DWORD m_waiterStarvationStartTimeMs;
     int m_emittedLockCreatedEvent;
 
+    // Number of iterations to spin for this lock before waiting. Adapted between
+    // g_SpinConstants.dwMonitorSpinCount / MinimumSpinCountDivisor and
+    // g_SpinConstants.dwMonitorSpinCount depending on whether spinning recently
+    // succeeded in acquiring the lock.
+    DWORD m_spinCount;
+
     static const DWORD WaiterStarvationDurationMsBeforeStoppingPreemptingWaiters = 100;
+    static const DWORD MinimumSpinCountDivisor = 8;
 
     // Only SyncBlocks can create AwareLocks.  Hence this private constructor.
     AwareLock(DWORD indx)
@@ -460,7 +467,8 @@ private:
           m_TransientPrecious(0),
           m_dwSyncIndex(indx),
           m_waiterStarvationStartTimeMs(0),
-          m_emittedLockCreatedEvent(0)
+          m_emittedLockCreatedEvent(0),
+          m_spinCount(g_SpinConstants.dwMonitorSpinCount)
     {
         LIMITED_METHOD_CONTRACT;
     }
@@ -546,6 +554,10 @@ public:
     EnterHelperResult TryEnterInsideSpinLoopHelper(Thread *pCurThread);
     bool TryEnterAfterSpinLoopHelper(Thread *pCurThread);
 
+    // Per-lock spin count used by the spin loop, and feedback on whether spinning acquired the lock
+    DWORD GetSpinCount() const;
+    void RecordSpinResult(bool acquiredLock);
+
     // Helper encapsulating the core logic for leaving monitor. Returns what kind of
     // follow up action is necessary
     AwareLock::LeaveHelperAction LeaveHelper(Thread* pCurThread);
@@ -1348,6 +1360,7 @@ class SyncBlockCache
     DWORD*      m_EphemeralBitmap;      // card table for ephemeral scanning
 
     BOOL        GCWeakPtrScanElement(int elindex, HANDLESCANPROC scanProc, LPARAM lp1, LPARAM lp2, BOOL& cleanup);
+    void        RebuildFreeSyncTableList();
 
     void SetCard (size_t card);
     void ClearCard (size_t card);
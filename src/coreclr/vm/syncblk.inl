@@ -468,6 +468,38 @@ FORCEINLINE void AwareLock::SpinWait(const YieldProcessorNormalizationInfo &norm
     YieldProcessorWithBackOffNormalized(normalizationInfo, spinIteration);
 }
 
+FORCEINLINE DWORD AwareLock::GetSpinCount() const
+{
+    LIMITED_METHOD_CONTRACT;
+    return VolatileLoadWithoutBarrier(&m_spinCount);
+}
+
+FORCEINLINE void AwareLock::RecordSpinResult(bool acquiredLock)
+{
+    LIMITED_METHOD_CONTRACT;
+
+    // Locks that are typically held briefly keep spinning for the full duration, while locks that are held for long enough
+    // that spinning usually fails spin less and wait sooner. The updates are racy but the value is only a heuristic.
+    const DWORD maxSpinCount = g_SpinConstants.dwMonitorSpinCount;
+    const DWORD minSpinCount = maxSpinCount / MinimumSpinCountDivisor;
+    DWORD spinCount = VolatileLoadWithoutBarrier(&m_spinCount);
+    DWORD newSpinCount;
+
+    if (acquiredLock)
+    {
+        newSpinCount = min(maxSpinCount, spinCount * 2 + 1);
+    }
+    else
+    {
+        newSpinCount = max(minSpinCount, spinCount - spinCount / 4);
+    }
+
+    if (newSpinCount != spinCount)
+    {
+        VolatileStoreWithoutBarrier(&m_spinCount, newSpinCount);
+    }
+}
+
 FORCEINLINE bool AwareLock::TryEnterHelper(Thread* pCurThread)
 {
     CONTRACTL{
@@ -40,6 +40,19 @@
 // queue. For each method we jit it, then update the precode so that future
 // entrypoint callers will run the new code.
 //
+// When a large number of methods is waiting to be jitted, for instance while a
+// service warms up, the background thread starts helper workers (up to
+// TC_BackgroundWorkerCount threads in total) that also take methods from the queue
+// and optimize them. Helper workers only jit and install code, everything else
+// (the tiering delay, call counting completion, deleting call counting stubs)
+// remains the job of the background thread. A helper worker exits as soon as the
+// queue is empty or the tiering delay is activated.
+//
+// The background thread yields periodically and measures how long the yield took. A
+// long yield means the processors are saturated with other work, so the background
+// thread then works for longer between yields and no helper workers run until yields
+// become short again.
+//
 // # Error handling
 //
 // The overall principle is don't swallow terminal failures that may have corrupted the
@@ -58,6 +71,10 @@ Thread *TieredCompilationManager::s_backgroundWorkerThread = nullptr;
 CLREventStatic TieredCompilationManager::s_backgroundWorkAvailableEvent;
 bool TieredCompilationManager::s_isBackgroundWorkerRunning = false;
 bool TieredCompilationManager::s_isBackgroundWorkerProcessingWork = false;
+UINT32 TieredCompilationManager::s_helperWorkerCount = 0;
+
+// Number of methods waiting to be jitted per running worker above which another helper worker is started
+static const UINT32 MethodsToOptimizePerBackgroundWorker = 32;
 
 // Called at AppDomain construction
 TieredCompilationManager::TieredCompilationManager() :
@@ -66,7 +83,8 @@ TieredCompilationManager::TieredCompilationManager() :
     m_methodsPendingCountingForTier1(nullptr),
     m_tier1CallCountingCandidateMethodRecentlyRecorded(false),
     m_isPendingCallCountingCompletion(false),
-    m_recentlyRequestedCallCountingCompletion(false)
+    m_recentlyRequestedCallCountingCompletion(false),
+    m_isBackgroundWorkThrottled(false)
 {
     WRAPPER_NO_CONTRACT;
     // On Unix, we can reach here before EEConfig is initialized, so defer config-based initialization to Init()
@@ -119,6 +137,13 @@ NativeCodeVersion::OptimizationTier TieredCompilationManager::GetInitialOptimiza
         {
             return NativeCodeVersion::OptimizationTier0;
         }
+#ifndef DACCESS_COMPILE
+        // Methods that already have profile data from a previous run (ReadPGOData) are not instrumented.
+        if (PgoManager::HasTextFormatPgoData(pMethodDesc))
+        {
+            return NativeCodeVersion::OptimizationTier0;
+        }
+#endif // DACCESS_COMPILE
         return NativeCodeVersion::OptimizationTier0Instrumented;
     }
 #endif
@@ -281,8 +306,10 @@ void TieredCompilationManager::AsyncPromoteToTier1(
 #ifdef FEATURE_PGO
     if (g_pConfig->TieredPGO())
     {
+        // Methods that already have profile data from a previous run (ReadPGOData) go straight to tier1.
         if (currentNativeCodeVersion.GetOptimizationTier() == NativeCodeVersion::OptimizationTier0 &&
-            g_pConfig->TieredPGO_InstrumentOnlyHotCode())
+            g_pConfig->TieredPGO_InstrumentOnlyHotCode() &&
+            !PgoManager::HasTextFormatPgoData(pMethodDesc))
         {
             if (ExecutionManager::IsReadyToRunCode(currentNativeCodeVersion.GetNativeCode()))
             {
@@ -575,6 +602,155 @@ void TieredCompilationManager::BackgroundWorkerStart()
     }
 }
 
+bool TieredCompilationManager::TryReserveHelperWorker_Locked()
+{
+    CONTRACTL
+    {
+        NOTHROW;
+        GC_NOTRIGGER;
+        MODE_ANY;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(IsLockOwnedByCurrentThread());
+
+    UINT32 workerCount = s_helperWorkerCount + 1; // including the background worker
+    if (m_isBackgroundWorkThrottled ||
+        workerCount >= g_pConfig->TieredCompilation_BackgroundWorkerCount() ||
+        m_countOfMethodsToOptimize < workerCount * MethodsToOptimizePerBackgroundWorker)
+    {
+        return false;
+    }
+
+    ++s_helperWorkerCount;
+    return true; // it's the caller's responsibility to call CreateHelperWorker() after leaving the lock
+}
+
+void TieredCompilationManager::CreateHelperWorker()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(!IsLockOwnedByCurrentThread());
+    _ASSERTE(s_helperWorkerCount != 0);
+
+    EX_TRY
+    {
+        Thread *newThread = SetupUnstartedThread();
+        _ASSERTE(newThread != nullptr);
+    #ifdef FEATURE_COMINTEROP
+        newThread->SetApartmentOfUnstartedThread(Thread::AS_InMTA);
+    #endif
+        newThread->SetBackground(true);
+
+        if (!newThread->CreateNewThread(0, HelperWorkerBootstrapper0, newThread, W(".NET Tiered Compilation Worker")))
+        {
+            newThread->DecExternalCount(false);
+            ThrowOutOfMemory();
+        }
+
+        newThread->StartThread();
+    }
+    EX_CATCH
+    {
+        // The background worker continues to process the queue on its own
+        STRESS_LOG1(LF_TIEREDCOMPILATION, LL_WARNING, "TieredCompilationManager::CreateHelperWorker: "
+            "Exception creating a helper worker, hr=0x%x\n",
+            GET_EXCEPTION()->GetHR());
+
+        LockHolder tieredCompilationLockHolder;
+        --s_helperWorkerCount;
+    }
+    EX_END_CATCH(RethrowTerminalExceptions);
+}
+
+DWORD WINAPI TieredCompilationManager::HelperWorkerBootstrapper0(LPVOID args)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    _ASSERTE(args != nullptr);
+    Thread *thread = (Thread *)args;
+
+    if (!thread->HasStarted())
+    {
+        LockHolder tieredCompilationLockHolder;
+
+        --s_helperWorkerCount;
+        return 0;
+    }
+
+    _ASSERTE(GetThread() == thread);
+    ManagedThreadBase::KickOff(HelperWorkerBootstrapper1, nullptr);
+
+    GCX_PREEMP_NO_DTOR();
+
+    DestroyThread(thread);
+    return 0;
+}
+
+void TieredCompilationManager::HelperWorkerBootstrapper1(LPVOID)
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_COOPERATIVE;
+    }
+    CONTRACTL_END;
+
+    GCX_PREEMP();
+    GetAppDomain()->GetTieredCompilationManager()->HelperWorkerStart();
+}
+
+void TieredCompilationManager::HelperWorkerStart()
+{
+    CONTRACTL
+    {
+        THROWS;
+        GC_TRIGGERS;
+        MODE_PREEMPTIVE;
+    }
+    CONTRACTL_END;
+
+    while (true)
+    {
+        NativeCodeVersion nativeCodeVersionToOptimize;
+        {
+            LockHolder tieredCompilationLockHolder;
+
+            // Leave the remaining work to the background worker while the processors are saturated
+            if (!IsTieringDelayActive() && !m_isBackgroundWorkThrottled)
+            {
+                nativeCodeVersionToOptimize = GetNextMethodToOptimize();
+            }
+
+            if (nativeCodeVersionToOptimize.IsNull())
+            {
+                // The background worker takes care of anything else, and starts helper workers again if needed
+                _ASSERTE(s_helperWorkerCount != 0);
+                --s_helperWorkerCount;
+                return;
+            }
+        }
+
+        OptimizeMethod(nativeCodeVersionToOptimize);
+
+        // Give preference to possibly more important work between methods
+        ClrSleepEx(0, false);
+    }
+}
+
 bool TieredCompilationManager::IsTieringDelayActive()
 {
     LIMITED_METHOD_CONTRACT;
@@ -748,6 +924,7 @@ bool TieredCompilationManager::DoBackgroundWork(
     do
     {
         bool completeCallCounting = false;
+        bool createHelperWorker = false;
         NativeCodeVersion nativeCodeVersionToOptimize;
         {
             LockHolder tieredCompilationLockHolder;
@@ -757,6 +934,9 @@ bool TieredCompilationManager::DoBackgroundWork(
                 break;
             }
 
+            // The work duration only grows above the minimum when yielding the thread took long, see below
+            m_isBackgroundWorkThrottled = workDurationTicks > minWorkDurationTicks;
+
             bool wasPendingCallCountingCompletion = m_isPendingCallCountingCompletion;
             if (wasPendingCallCountingCompletion)
             {
@@ -779,7 +959,11 @@ bool TieredCompilationManager::DoBackgroundWork(
             if (!completeCallCounting)
             {
                 nativeCodeVersionToOptimize = GetNextMethodToOptimize();
-                if (nativeCodeVersionToOptimize.IsNull())
+                if (!nativeCodeVersionToOptimize.IsNull())
+                {
+                    createHelperWorker = TryReserveHelperWorker_Locked();
+                }
+                else
                 {
                     // Ran out of methods to JIT
                     if (wasPendingCallCountingCompletion)
@@ -799,6 +983,11 @@ bool TieredCompilationManager::DoBackgroundWork(
             }
         }
 
+        if (createHelperWorker)
+        {
+            CreateHelperWorker();
+        }
+
         _ASSERTE(completeCallCounting == !!nativeCodeVersionToOptimize.IsNull());
         if (completeCallCounting)
         {
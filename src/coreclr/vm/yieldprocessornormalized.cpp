@@ -3,6 +3,7 @@
 
 #include "common.h"
 #include "yieldprocessornormalized.h"
+#include <minipal/cpufeatures.h>
 
 
 #include "finalizerthread.h"
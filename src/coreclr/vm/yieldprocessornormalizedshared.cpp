@@ -20,6 +20,7 @@ static uint64_t s_performanceCounterTicksPerS;
 static double s_nsPerYieldMeasurements[NsPerYieldMeasurementCount];
 static int s_nextMeasurementIndex;
 static double s_establishedNsPerYield = YieldProcessorNormalization::TargetNsPerNormalizedYield;
+static bool s_isHybridCpu;
 
 void RhEnableFinalization();
 
@@ -143,6 +144,15 @@ void YieldProcessorNormalization::PerformMeasurement()
             return;
         }
 
+        // A yield takes a different amount of time on each core type of a hybrid processor. Spinning threads mostly run on
+        // the performance cores, so skip a periodic measurement that lands on an efficiency core and try again next period.
+        if (s_isHybridCpu && minipal_get_current_cpu_core_type() == MinipalCpuCoreType_Efficiency)
+        {
+            s_previousNormalizationTimeMs = GetTickCountPortable();
+            s_isMeasurementScheduled = false;
+            return;
+        }
+
         int nextMeasurementIndex = s_nextMeasurementIndex;
         latestNsPerYield = MeasureNsPerYield(DetermineMeasureDurationUs());
         AtomicStore(&s_nsPerYieldMeasurements[nextMeasurementIndex], latestNsPerYield);
@@ -169,6 +179,7 @@ void YieldProcessorNormalization::PerformMeasurement()
 #ifndef FEATURE_NATIVEAOT
         s_performanceCounterTicksPerS = li.QuadPart;
 #endif
+        s_isHybridCpu = minipal_is_hybrid_cpu();
 
         unsigned int measureDurationUs = DetermineMeasureDurationUs();
         for (int i = 0; i < NsPerYieldMeasurementCount; ++i)
@@ -598,6 +598,21 @@ ep_rt_config_value_get_output_streaming (void)
 	return enable;
 }
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_output_file_size_mb (void)
+{
+	uint32_t file_size_mb = 0;
+	gchar *value = g_getenv ("DOTNET_EventPipeOutputFileSizeMB");
+	if (!value)
+		value = g_getenv ("COMPlus_EventPipeOutputFileSizeMB");
+	if (value)
+		file_size_mb = strtoul (value, NULL, 10);
+	g_free (value);
+	return file_size_mb;
+}
+
 static
 inline
 uint32_t
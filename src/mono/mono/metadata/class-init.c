@@ -3093,15 +3093,25 @@ mono_class_init_internal (MonoClass *klass)
 	} else if (mono_class_is_ginst (klass) && !MONO_CLASS_IS_INTERFACE_INTERNAL (klass)) {
 		MonoClass *gklass = mono_class_get_generic_class (klass)->container_class;
 
+		guint32 gtd_vtable_size;
+
 		/* Generic instance case */
 		ghcimpl = gklass->ghcimpl;
 		has_cctor = gklass->has_cctor;
 
-		mono_class_setup_vtable (gklass);
-		if (mono_class_set_type_load_failure_causedby_class (klass, gklass, "Generic type definition failed to init"))
-			goto leave;
+		/*
+		 * Avoid setting up the full vtable of the generic type definition if the AOT image
+		 * has its size, it will be set up lazily when the vtable of an instance is needed.
+		 */
+		if (!gklass->vtable && mono_class_get_cached_gtd_vtable_size (gklass, &gtd_vtable_size)) {
+			vtable_size = gtd_vtable_size;
+		} else {
+			mono_class_setup_vtable (gklass);
+			if (mono_class_set_type_load_failure_causedby_class (klass, gklass, "Generic type definition failed to init"))
+				goto leave;
 
-		vtable_size = gklass->vtable_size;
+			vtable_size = gklass->vtable_size;
+		}
 	} else {
 		/* General case */
 
@@ -1425,6 +1425,8 @@ mono_class_set_type_load_failure_causedby_class (MonoClass *klass, const MonoCla
 
 gboolean mono_class_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res);
 
+gboolean mono_class_get_cached_gtd_vtable_size (MonoClass *klass, guint32 *vtable_size);
+
 MonoMethod* mono_find_method_in_metadata (MonoClass *klass, const char *name, int param_count, int flags);
 
 int
@@ -4990,6 +4990,14 @@ mono_class_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res)
 	return mono_get_runtime_callbacks ()->get_cached_class_info (klass, res);
 }
 
+gboolean
+mono_class_get_cached_gtd_vtable_size (MonoClass *klass, guint32 *vtable_size)
+{
+	MonoRuntimeCallbacks *callbacks = mono_get_runtime_callbacks ();
+
+	return callbacks->get_cached_gtd_vtable_size && callbacks->get_cached_gtd_vtable_size (klass, vtable_size);
+}
+
 /**
  * mono_class_get_image:
  *
@@ -731,6 +731,7 @@ typedef struct {
 								   MonoDebugSourceLocation **out_location,
 								   gint32 *iloffset, gint32 *native_offset);
 	gboolean (*get_cached_class_info) (MonoClass *klass, MonoCachedClassInfo *res);
+	gboolean (*get_cached_gtd_vtable_size) (MonoClass *klass, guint32 *vtable_size);
 	gboolean (*get_class_from_name) (MonoImage *image, const char *name_space, const char *name, MonoClass **res);
 	gpointer (*build_imt_trampoline) (MonoVTable *vtable, MonoIMTCheckItem **imt_entries, int count, gpointer fail_trunk);
 	MonoJitInfo *(*find_jit_info_in_aot) (MonoImage *image, gpointer addr);
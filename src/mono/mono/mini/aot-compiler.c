@@ -8006,7 +8006,11 @@ emit_klass_info (MonoAotCompile *acfg, guint32 token)
 	if (mono_class_has_failure (klass))
 		cant_encode = TRUE;
 
-	if (mono_class_is_gtd (klass) || cant_encode) {
+	if (mono_class_is_gtd (klass) && !cant_encode) {
+		/* Only the vtable size is saved, it is shared by all the instances of the type */
+		encode_value (-2, p, &p);
+		encode_value (m_class_get_vtable_size (klass), p, &p);
+	} else if (mono_class_is_gtd (klass) || cant_encode) {
 		encode_value (-1, p, &p);
 	} else {
 		gboolean has_nested = mono_class_get_nested_classes_property (klass) != NULL;
@@ -10899,6 +10903,93 @@ compile_llvm_file (MonoAotCompile *acfg)
 }
 #endif
 
+static gint
+compare_profile_methods (gconstpointer a, gconstpointer b)
+{
+	int i, j;
+
+	i = (*(MethodProfileData**)a)->id;
+	j = (*(MethodProfileData**)b)->id;
+
+	if (i < j)
+		return -1;
+	else
+		if (i > j)
+			return 1;
+	else
+		return 0;
+}
+
+/*
+ * order_methods_by_profile:
+ *
+ *   Reorder acfg->method_order so the methods recorded in the profiles are emitted first,
+ * in the order they were first executed. Profiles are consumed in the order they were given
+ * on the command line, so a startup profile followed by a steady state profile places
+ * startup code at the front of the image, followed by the hot steady state code. This
+ * reduces the number of pages touched during startup. The remaining methods keep their
+ * original order.
+ */
+static void
+order_methods_by_profile (MonoAotCompile *acfg)
+{
+	GPtrArray *new_order;
+	GHashTable *ordered;
+	GList *l;
+	int count = 0;
+
+	if (!acfg->profile_data)
+		return;
+
+	new_order = g_ptr_array_sized_new (acfg->method_order->len);
+	ordered = g_hash_table_new (NULL, NULL);
+
+	for (l = acfg->profile_data; l; l = l->next) {
+		ProfileData *data = (ProfileData*)l->data;
+		GPtrArray *methods = g_ptr_array_new ();
+		GHashTableIter iter;
+		gpointer key, value;
+
+		/* Record ids are assigned in the order the methods were first executed */
+		g_hash_table_iter_init (&iter, data->methods);
+		while (g_hash_table_iter_next (&iter, &key, &value)) {
+			MethodProfileData *mdata = (MethodProfileData*)value;
+			if (mdata->method)
+				g_ptr_array_add (methods, mdata);
+		}
+		g_ptr_array_sort (methods, compare_profile_methods);
+
+		for (guint i = 0; i < methods->len; ++i) {
+			MethodProfileData *mdata = (MethodProfileData*)g_ptr_array_index (methods, i);
+			guint index = GPOINTER_TO_UINT (g_hash_table_lookup (acfg->method_indexes, mdata->method));
+
+			/* method_indexes stores index + 1 */
+			if (!index || index > GINT_TO_UINT (acfg->cfgs_size) || !acfg->cfgs [index - 1])
+				continue;
+			if (g_hash_table_lookup (ordered, GUINT_TO_POINTER (index)))
+				continue;
+			g_hash_table_insert (ordered, GUINT_TO_POINTER (index), GUINT_TO_POINTER (index));
+			g_ptr_array_add (new_order, GUINT_TO_POINTER (index - 1));
+			count ++;
+		}
+		g_ptr_array_free (methods, TRUE);
+	}
+
+	for (guint oindex = 0; oindex < acfg->method_order->len; ++oindex) {
+		guint idx = GPOINTER_TO_UINT (g_ptr_array_index (acfg->method_order, oindex));
+
+		if (g_hash_table_lookup (ordered, GUINT_TO_POINTER (idx + 1)))
+			continue;
+		g_ptr_array_add (new_order, GUINT_TO_POINTER (idx));
+	}
+
+	g_hash_table_destroy (ordered);
+	g_ptr_array_free (acfg->method_order, TRUE);
+	acfg->method_order = new_order;
+
+	aot_printf (acfg, "Ordered %d methods by profile.\n", count);
+}
+
 static void
 emit_code (MonoAotCompile *acfg)
 {
@@ -15589,6 +15680,8 @@ emit_aot_image (MonoAotCompile *acfg)
 	if (acfg->dwarf)
 		mono_dwarf_writer_emit_base_info (acfg->dwarf, g_path_get_basename (acfg->image->name), mono_unwind_get_cie_program ());
 
+	order_methods_by_profile (acfg);
+
 	emit_code (acfg);
 
 	emit_method_info_table (acfg);
@@ -2545,7 +2545,7 @@ decode_cached_class_info (MonoAotModule *module, MonoCachedClassInfo *info, guin
 	gboolean res;
 
 	info->vtable_size = decode_value (buf, &buf);
-	if (info->vtable_size == -1)
+	if (info->vtable_size == -1 || info->vtable_size == -2)
 		/* Generic type */
 		return FALSE;
 	flags = decode_value (buf, &buf);
@@ -2651,6 +2651,31 @@ mono_aot_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res)
 	return TRUE;
 }
 
+/**
+ * mono_aot_get_cached_gtd_vtable_size:
+ *
+ *   Obtain the vtable size of the generic type definition KLASS from the AOT image.
+ * Generic instances share the vtable size of their definition, so this allows them to
+ * be initialized without setting up the full vtable of the definition.
+ */
+gboolean
+mono_aot_get_cached_gtd_vtable_size (MonoClass *klass, guint32 *vtable_size)
+{
+	MonoAotModule *amodule = m_class_get_image (klass)->aot_module;
+	guint8 *p;
+
+	if (!mono_class_is_gtd (klass) || !m_class_get_type_token (klass) || !amodule || (amodule == AOT_MODULE_NOT_FOUND))
+		return FALSE;
+
+	p = (guint8*)&amodule->blob [mono_aot_get_offset (amodule->class_info_offsets, mono_metadata_token_index (m_class_get_type_token (klass)) - 1)];
+
+	if (decode_value (p, &p) != -2)
+		return FALSE;
+	*vtable_size = decode_value (p, &p);
+
+	return TRUE;
+}
+
 /**
  * mono_aot_get_class_from_name:
  *
@@ -6593,6 +6618,12 @@ mono_aot_get_cached_class_info (MonoClass *klass, MonoCachedClassInfo *res)
 	return FALSE;
 }
 
+gboolean
+mono_aot_get_cached_gtd_vtable_size (MonoClass *klass, guint32 *vtable_size)
+{
+	return FALSE;
+}
+
 gboolean
 mono_aot_get_class_from_name (MonoImage *image, const char *name_space, const char *name, MonoClass **klass)
 {
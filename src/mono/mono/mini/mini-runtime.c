@@ -2797,8 +2797,11 @@ lookup_start:
 	}
 
 	if (!jit_only && !code && mono_aot_only && mono_use_interpreter && method->wrapper_type != MONO_WRAPPER_OTHER) {
+		/* Counts methods missing from the AOT images, used to tune partial AOT */
+		mono_atomic_inc_i32 (&mono_jit_stats.methods_aot_interp_fallback);
+
 		if (mono_llvm_only) {
-			/* Signal to the caller that AOTed code is not found */
+			/* Signal to the caller that AOTed code is not found, it runs the method in the interpreter */
 			g_assert (method->wrapper_type != MONO_WRAPPER_RUNTIME_INVOKE);
 			return NULL;
 		}
@@ -4354,6 +4357,7 @@ register_counters (void)
 	mono_counters_register ("Compiled methods", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_compiled);
 	mono_counters_register ("Methods from AOT", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_aot);
 	mono_counters_register ("Methods from AOT+LLVM", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_aot_llvm);
+	mono_counters_register ("Methods from AOT falling back to the interpreter", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_aot_interp_fallback);
 	mono_counters_register ("Methods JITted using mono JIT", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_without_llvm);
 	mono_counters_register ("Methods JITted using LLVM", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_with_llvm);
 	mono_counters_register ("Methods using the interpreter", MONO_COUNTER_JIT | MONO_COUNTER_INT, &mono_jit_stats.methods_with_interp);
@@ -4740,6 +4744,7 @@ mini_init (const char *filename)
 	callbacks.get_trace = mono_get_trace;
 	callbacks.get_frame_info = mono_get_frame_info;
 	callbacks.get_cached_class_info = mono_aot_get_cached_class_info;
+	callbacks.get_cached_gtd_vtable_size = mono_aot_get_cached_gtd_vtable_size;
 	callbacks.get_class_from_name = mono_aot_get_class_from_name;
 	callbacks.mono_class_set_deferred_type_load_failure_callback = mono_class_set_type_load_failure;
 
@@ -1698,6 +1698,7 @@ typedef struct {
 	gint32 methods_compiled;
 	gint32 methods_aot;
 	gint32 methods_aot_llvm;
+	gint32 methods_aot_interp_fallback;
 	gint32 methods_lookups;
 	gint32 allocate_var;
 	gint32 cil_code_size;
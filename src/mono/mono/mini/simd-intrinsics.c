@@ -1666,6 +1666,9 @@ static guint16 sri_vector_methods [] = {
 	SN_Narrow,
 	SN_Negate,
 	SN_OnesComplement,
+	SN_ShiftLeft,
+	SN_ShiftRightArithmetic,
+	SN_ShiftRightLogical,
 	SN_Shuffle,
 	SN_Sqrt,
 	SN_Subtract,
@@ -3003,6 +3006,29 @@ emit_sri_vector (MonoCompile *cfg, MonoMethod *cmethod, MonoMethodSignature *fsi
 			return NULL;
 		return emit_simd_ins_for_unary_op (cfg, klass, fsig, args, arg0_type, id);
 	}
+	case SN_ShiftLeft:
+	case SN_ShiftRightArithmetic:
+	case SN_ShiftRightLogical: {
+		if (!is_element_type_primitive (fsig->params [0]) || type_enum_is_float (arg0_type))
+			return NULL;
+#if defined(TARGET_ARM64) || defined(TARGET_WASM)
+		/* The non-immediate vector shifts are only implemented by the LLVM backend */
+		if (!COMPILE_LLVM (cfg))
+			return NULL;
+
+		int op = id == SN_ShiftLeft ? OP_SIMD_SHL : (id == SN_ShiftRightLogical ? OP_SIMD_USHR : OP_SIMD_SSHR);
+
+		/* The shift count is masked to the element width, LLVM shifts by the width or more are undefined */
+		int count_reg = alloc_ireg (cfg);
+		MONO_EMIT_NEW_BIALU_IMM (cfg, OP_IAND_IMM, count_reg, args [1]->dreg, (8 << type_to_width_log2 (arg0_type)) - 1);
+
+		MonoInst *ins = emit_simd_ins (cfg, klass, op, args [0]->dreg, count_reg);
+		ins->inst_c1 = arg0_type;
+		return ins;
+#else
+		return NULL;
+#endif
+	}
 	case SN_Shuffle: {
 		MonoType *etype = get_vector_t_elem_type (fsig->ret);
 		if (!MONO_TYPE_IS_VECTOR_PRIMITIVE (etype))
@@ -50,7 +50,16 @@
 #define LOS_SECTION_FOR_OBJ(obj)	((LOSSection*)((mword)(obj) & ~(mword)(LOS_SECTION_SIZE - 1)))
 #define LOS_CHUNK_INDEX(obj,section)	(((char*)(obj) - (char*)(section)) >> LOS_CHUNK_BITS)
 
-#define LOS_NUM_FAST_SIZES		32
+/*
+ * Free runs are kept in segregated lists by their exact number of chunks. A section has
+ * LOS_SECTION_NUM_CHUNKS usable chunks, so every run fits in a size class and index 0 is unused.
+ */
+#define LOS_NUM_FAST_SIZES		(LOS_SECTION_NUM_CHUNKS + 1)
+#define LOS_FREE_LIST_BITMAP_BITS	(sizeof (mword) * 8)
+#define LOS_FREE_LIST_BITMAP_WORDS	((LOS_NUM_FAST_SIZES + LOS_FREE_LIST_BITMAP_BITS - 1) / LOS_FREE_LIST_BITMAP_BITS)
+
+/* Free runs of at least this many chunks have their pages returned to the OS on sweep */
+#define LOS_DISCARD_MIN_CHUNKS		16
 
 typedef struct _LOSFreeChunks LOSFreeChunks;
 struct _LOSFreeChunks {
@@ -126,7 +135,9 @@ mword sgen_los_memory_usage = 0;
 mword sgen_los_memory_usage_total = 0;
 
 static LOSSection *los_sections = NULL;
-static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES]; /* 0 is for larger sizes */
+static LOSFreeChunks *los_fast_free_lists [LOS_NUM_FAST_SIZES];
+/* Bit n is set iff los_fast_free_lists [n] is not empty */
+static mword los_free_list_bitmap [LOS_FREE_LIST_BITMAP_WORDS];
 static mword los_num_objects = 0;
 static int los_num_sections = 0;
 
@@ -182,10 +193,9 @@ los_consistency_check (void)
 			LOSSection *section = LOS_SECTION_FOR_OBJ (size_chunks);
 			int j, num_chunks, start_index;
 
-			if (i == 0)
-				g_assert (size_chunks->size >= LOS_NUM_FAST_SIZES * LOS_CHUNK_SIZE);
-			else
-				g_assert (size_chunks->size == i * LOS_CHUNK_SIZE);
+			g_assert (i > 0);
+			g_assert (size_chunks->size == i * LOS_CHUNK_SIZE);
+			g_assert (los_free_list_bitmap [i / LOS_FREE_LIST_BITMAP_BITS] & ((mword)1 << (i % LOS_FREE_LIST_BITMAP_BITS)));
 
 			num_chunks = size_chunks->size >> LOS_CHUNK_BITS;
 			start_index = LOS_CHUNK_INDEX (size_chunks, section);
@@ -203,35 +213,50 @@ add_free_chunk (LOSFreeChunks *free_chunks, size_t size)
 {
 	size_t num_chunks = size >> LOS_CHUNK_BITS;
 
-	free_chunks->size = size;
+	g_assert (num_chunks > 0 && num_chunks < LOS_NUM_FAST_SIZES);
 
-	if (num_chunks >= LOS_NUM_FAST_SIZES)
-		num_chunks = 0;
+	free_chunks->size = size;
 	free_chunks->next_size = los_fast_free_lists [num_chunks];
 	los_fast_free_lists [num_chunks] = free_chunks;
+	los_free_list_bitmap [num_chunks / LOS_FREE_LIST_BITMAP_BITS] |= (mword)1 << (num_chunks % LOS_FREE_LIST_BITMAP_BITS);
+}
+
+/*
+ * Returns the smallest size class with at least min_chunks chunks that has a free run,
+ * or 0 if there is none.
+ */
+static size_t
+find_free_list (size_t min_chunks)
+{
+	size_t word = min_chunks / LOS_FREE_LIST_BITMAP_BITS;
+	mword bits = los_free_list_bitmap [word] & ~(((mword)1 << (min_chunks % LOS_FREE_LIST_BITMAP_BITS)) - 1);
+
+	for (;;) {
+		if (bits) {
+			size_t bit = 0;
+			while (!(bits & ((mword)1 << bit)))
+				++bit;
+			return word * LOS_FREE_LIST_BITMAP_BITS + bit;
+		}
+		if (++word == LOS_FREE_LIST_BITMAP_WORDS)
+			return 0;
+		bits = los_free_list_bitmap [word];
+	}
 }
 
 static LOSFreeChunks*
-get_from_size_list (LOSFreeChunks **list, size_t size)
+get_from_size_list (size_t list_index, size_t size)
 {
-	LOSFreeChunks *free_chunks = NULL;
+	LOSFreeChunks *free_chunks = los_fast_free_lists [list_index];
 	LOSSection *section;
 	size_t i, num_chunks, start_index;
 
-
 	g_assert ((size & (LOS_CHUNK_SIZE - 1)) == 0);
+	g_assert (free_chunks && free_chunks->size >= size);
 
-	while (*list) {
-		free_chunks = *list;
-		if (free_chunks->size >= size)
-			break;
-		list = &(*list)->next_size;
-	}
-
-	if (!*list)
-		return NULL;
-
-	*list = free_chunks->next_size;
+	los_fast_free_lists [list_index] = free_chunks->next_size;
+	if (!free_chunks->next_size)
+		los_free_list_bitmap [list_index / LOS_FREE_LIST_BITMAP_BITS] &= ~((mword)1 << (list_index % LOS_FREE_LIST_BITMAP_BITS));
 
 	if (free_chunks->size > size)
 		add_free_chunk ((LOSFreeChunks*)((char*)free_chunks + size), free_chunks->size - size);
@@ -276,7 +301,7 @@ get_los_section_memory (size_t size)
 {
 	LOSSection *section;
 	LOSFreeChunks *free_chunks = NULL;
-	size_t num_chunks;
+	size_t num_chunks, list_index;
 	size_t obj_size = size;
 
 	size = SGEN_ALIGN_UP_TO (size, LOS_CHUNK_SIZE);
@@ -287,20 +312,9 @@ get_los_section_memory (size_t size)
 	g_assert (num_chunks > 0);
 
  retry:
-	if (num_chunks >= LOS_NUM_FAST_SIZES) {
-		free_chunks = get_from_size_list (&los_fast_free_lists [0], size);
-	} else {
-		size_t i;
-		for (i = num_chunks; i < LOS_NUM_FAST_SIZES; ++i) {
-			free_chunks = get_from_size_list (&los_fast_free_lists [i], size);
-			if (free_chunks)
-				break;
-		}
-		if (!free_chunks)
-			free_chunks = get_from_size_list (&los_fast_free_lists [0], size);
-	}
-
-	if (free_chunks) {
+	list_index = find_free_list (num_chunks);
+	if (list_index) {
+		free_chunks = get_from_size_list (list_index, size);
 		return randomize_los_object_start (free_chunks, obj_size, size, LOS_CHUNK_SIZE);
 	}
 
@@ -319,10 +333,7 @@ get_los_section_memory (size_t size)
 	if (!section)
 		return NULL;
 
-	free_chunks = (LOSFreeChunks*)((char*)section + LOS_CHUNK_SIZE);
-	free_chunks->size = LOS_SECTION_SIZE - LOS_CHUNK_SIZE;
-	free_chunks->next_size = los_fast_free_lists [0];
-	los_fast_free_lists [0] = free_chunks;
+	add_free_chunk ((LOSFreeChunks*)((char*)section + LOS_CHUNK_SIZE), LOS_SECTION_SIZE - LOS_CHUNK_SIZE);
 
 	section->num_free_chunks = LOS_SECTION_NUM_CHUNKS;
 
@@ -496,6 +507,25 @@ sgen_los_alloc_large_inner (GCVTable vtable, size_t size)
 
 static void sgen_los_unpin_object (GCObject *data);
 
+/*
+ * Returns the pages of a free run in a live section to the OS, so that sections that are
+ * only partially used after an allocation burst don't keep their free pages resident. Allocation clears
+ * the memory of new objects anyway. The first chunk holds the free list link, which is
+ * written right after this.
+ */
+static void
+discard_free_run (char *start, size_t size)
+{
+#if defined(__linux__) || defined(HOST_WIN32)
+	int pagesize = mono_pagesize ();
+	char *discard_start = (char*)SGEN_ALIGN_UP_TO ((mword)start + LOS_CHUNK_SIZE, pagesize);
+	char *discard_end = (char*)SGEN_ALIGN_DOWN_TO ((mword)start + size, pagesize);
+
+	if (discard_end > discard_start)
+		mono_mprotect (discard_start, discard_end - discard_start, MONO_MMAP_READ | MONO_MMAP_WRITE | MONO_MMAP_DISCARD);
+#endif
+}
+
 void
 sgen_los_sweep (void)
 {
@@ -533,6 +563,7 @@ sgen_los_sweep (void)
 	/* Try to free memory */
 	for (i = 0; i < LOS_NUM_FAST_SIZES; ++i)
 		los_fast_free_lists [i] = NULL;
+	memset (los_free_list_bitmap, 0, sizeof (los_free_list_bitmap));
 
 	prev = NULL;
 	section = los_sections;
@@ -561,6 +592,8 @@ sgen_los_sweep (void)
 				int j;
 				for (j = i + 1; j <= LOS_SECTION_NUM_CHUNKS && section->free_chunk_map [j]; ++j)
 					;
+				if (j - i >= LOS_DISCARD_MIN_CHUNKS)
+					discard_free_run ((char*)section + (i << LOS_CHUNK_BITS), (j - i) << LOS_CHUNK_BITS);
 				add_free_chunk ((LOSFreeChunks*)((char*)section + (i << LOS_CHUNK_BITS)), (j - i) << LOS_CHUNK_BITS);
 				i = j - 1;
 			}
@@ -244,7 +244,7 @@ workers_steal_work (WorkerData *data)
 	int generation = sgen_get_current_collection_generation ();
 	GrayQueueSection *section = NULL;
 	WorkerContext *context = data->context;
-	int i, current_worker;
+	int i, current_worker, first_victim;
 
 	if ((generation == GENERATION_OLD && !major->is_parallel) ||
 			(generation == GENERATION_NURSERY && !minor->is_parallel))
@@ -254,9 +254,22 @@ workers_steal_work (WorkerData *data)
 	g_assert (sgen_gray_object_queue_is_empty (&data->private_gray_queue));
 
 	current_worker = (int) (data - context->workers_data);
+	if (context->active_workers_num < 2)
+		return FALSE;
 
-	for (i = 1; i < context->active_workers_num && !section; i++) {
-		int steal_worker = (current_worker + i) % context->active_workers_num;
+	/*
+	 * Start probing at a random victim. Always starting at the next worker makes all the idle
+	 * workers converge on the same few busy queues, where they fail the trylock on the steal
+	 * mutex and give up, which limits scaling once there are more than a handful of workers.
+	 */
+	data->steal_seed ^= data->steal_seed << 13;
+	data->steal_seed ^= data->steal_seed >> 17;
+	data->steal_seed ^= data->steal_seed << 5;
+	first_victim = (int) (data->steal_seed % (guint32) (context->active_workers_num - 1));
+
+	for (i = 0; i < context->active_workers_num - 1 && !section; i++) {
+		/* Every other worker is probed exactly once */
+		int steal_worker = (current_worker + 1 + (first_victim + i) % (context->active_workers_num - 1)) % context->active_workers_num;
 		if (state_is_working_or_enqueued (context->workers_data [steal_worker].state))
 			section = sgen_gray_object_steal_section (&context->workers_data [steal_worker].private_gray_queue);
 	}
@@ -407,6 +420,7 @@ sgen_workers_create_context (int generation, int num_workers)
 	for (i = 0; i < context->workers_num; ++i) {
 		workers_data_ptrs [i] = &context->workers_data [i];
 		context->workers_data [i].context = context;
+		context->workers_data [i].steal_seed = (guint32) i + 1;
 	}
 
 	context->thread_pool_context = sgen_thread_pool_create_context (context->workers_num, thread_pool_init_func, marker_idle_func, continue_idle_func, should_work_func, (void**)workers_data_ptrs);
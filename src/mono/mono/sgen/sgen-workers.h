@@ -41,6 +41,9 @@ struct _WorkerData {
 	 * work during the phase
 	 */
 	gint64 last_start;
+
+	/* Xorshift state used to pick the first worker to steal from */
+	guint32 steal_seed;
 };
 
 struct _WorkerContext {
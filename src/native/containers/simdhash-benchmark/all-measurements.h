@@ -132,6 +132,81 @@ static void destroy_instance_ght (void *data) {
     g_hash_table_destroy((GHashTable *)data);
 }
 
+// Type lookups in the runtime are keyed by pointers into loader heaps, so the keys are
+//  aligned, close to each other and share most of their high bits. Instantiated types are
+//  keyed by their generic definition plus a type argument.
+#define TYPE_HANDLE_BASE 0x7F3A00000000ull
+#define TYPE_HANDLE_STRIDE 64
+#define GENERIC_DEFINITION_COUNT 256
+
+static dn_vector_t *type_handles, *missing_type_handles, *instantiations, *missing_instantiations;
+
+static void * fake_type_handle (uint32_t index, uint32_t offset) {
+    return (void *)(size_t)(TYPE_HANDLE_BASE + (uint64_t)index * TYPE_HANDLE_STRIDE + offset);
+}
+
+static void init_type_data () {
+    if (!random_u32s)
+        init_data();
+
+    type_handles = dn_vector_alloc(sizeof(void *));
+    missing_type_handles = dn_vector_alloc(sizeof(void *));
+    instantiations = dn_vector_alloc(sizeof(dn_ptrpair_t));
+    missing_instantiations = dn_vector_alloc(sizeof(dn_ptrpair_t));
+
+    // Use the random keys for the lookup order so that lookups don't walk the table sequentially
+    for (uint32_t i = 0; i < INNER_COUNT; i++) {
+        uint32_t index = *dn_vector_index_t(random_u32s, uint32_t, i) % (INNER_COUNT * 4);
+        void *type_handle = fake_type_handle(index, 0);
+        dn_vector_push_back(type_handles, type_handle);
+        // Misses fall between live type handles, like lookups of types that are not loaded yet
+        void *missing_type_handle = fake_type_handle(index, TYPE_HANDLE_STRIDE / 2);
+        dn_vector_push_back(missing_type_handles, missing_type_handle);
+
+        dn_ptrpair_t instantiation = { fake_type_handle(i % GENERIC_DEFINITION_COUNT, 8), type_handle };
+        dn_vector_push_back(instantiations, instantiation);
+        dn_ptrpair_t missing_instantiation = { instantiation.first, missing_type_handle };
+        dn_vector_push_back(missing_instantiations, missing_instantiation);
+    }
+}
+
+static void * create_instance_ptr_ptr_type_handles () {
+    if (!type_handles)
+        init_type_data();
+
+    dn_simdhash_ptr_ptr_t *result = dn_simdhash_ptr_ptr_new(INNER_COUNT, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(type_handles, void *, i);
+        // The indices can repeat, so some adds are expected to fail
+        dn_simdhash_ptr_ptr_try_add(result, key, key);
+    }
+    return result;
+}
+
+static void * create_instance_ptrpair_ptr_instantiations () {
+    if (!type_handles)
+        init_type_data();
+
+    dn_simdhash_ptrpair_ptr_t *result = dn_simdhash_ptrpair_ptr_new(INNER_COUNT, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        dn_ptrpair_t key = *dn_vector_index_t(instantiations, dn_ptrpair_t, i);
+        dn_simdhash_ptrpair_ptr_try_add(result, key, key.second);
+    }
+    return result;
+}
+
+static void * create_instance_ght_type_handles () {
+    if (!type_handles)
+        init_type_data();
+
+    GHashTable *result = g_hash_table_new(NULL, NULL);
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(type_handles, void *, i);
+        g_hash_table_insert(result, key, key);
+    }
+    return result;
+}
+
 #endif // MEASUREMENTS_IMPLEMENTATION
 
 // These go outside the guard because we include this file multiple times.
@@ -217,3 +292,49 @@ MEASUREMENT(ght_find_missing_key, GHashTable *, create_instance_ght_random_value
         dn_simdhash_assert(g_hash_table_lookup(data, (gpointer)(size_t)key) == NULL);
     }
 })
+
+MEASUREMENT(dn_find_type_handle_hit, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_type_handles, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(type_handles, void *, i);
+        dn_simdhash_assert(dn_simdhash_ptr_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(dn_find_type_handle_miss, dn_simdhash_ptr_ptr_t *, create_instance_ptr_ptr_type_handles, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(missing_type_handles, void *, i);
+        dn_simdhash_assert(!dn_simdhash_ptr_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(dn_find_instantiation_hit, dn_simdhash_ptrpair_ptr_t *, create_instance_ptrpair_ptr_instantiations, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        dn_ptrpair_t key = *dn_vector_index_t(instantiations, dn_ptrpair_t, i);
+        dn_simdhash_assert(dn_simdhash_ptrpair_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(dn_find_instantiation_miss, dn_simdhash_ptrpair_ptr_t *, create_instance_ptrpair_ptr_instantiations, destroy_instance, {
+    void *temp = NULL;
+    for (int i = 0; i < INNER_COUNT; i++) {
+        dn_ptrpair_t key = *dn_vector_index_t(missing_instantiations, dn_ptrpair_t, i);
+        dn_simdhash_assert(!dn_simdhash_ptrpair_ptr_try_get_value(data, key, &temp));
+    }
+})
+
+MEASUREMENT(ght_find_type_handle_hit, GHashTable *, create_instance_ght_type_handles, destroy_instance_ght, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(type_handles, void *, i);
+        dn_simdhash_assert(g_hash_table_lookup(data, key) == key);
+    }
+})
+
+MEASUREMENT(ght_find_type_handle_miss, GHashTable *, create_instance_ght_type_handles, destroy_instance_ght, {
+    for (int i = 0; i < INNER_COUNT; i++) {
+        void *key = *dn_vector_index_t(missing_type_handles, void *, i);
+        dn_simdhash_assert(g_hash_table_lookup(data, key) == NULL);
+    }
+})
@@ -188,7 +188,8 @@ namespace
         const fx_reference_t & fx_ref,
         const pal::string_t & oldest_requested_version,
         const pal::string_t & dotnet_dir,
-        const bool disable_multilevel_lookup)
+        const bool disable_multilevel_lookup,
+        fx_resolver_t::fx_dir_to_versions_map_t & installed_versions)
     {
 #if defined(DEBUG)
         assert(!fx_ref.get_fx_name().empty());
@@ -243,18 +244,32 @@ namespace
             }
             else
             {
-                std::vector<pal::string_t> list;
-                std::vector<fx_ver_t> version_list;
-                pal::readdir_onlydirectories(fx_dir, &list);
-
-                for (const auto& version : list)
+                // Resolution retries and frameworks referenced more than once look at the same directory again,
+                // so only enumerate each one once.
+                auto installed = installed_versions.find(fx_dir);
+                if (installed == installed_versions.end())
                 {
-                    fx_ver_t ver;
-                    if (fx_ver_t::parse(version, &ver, false))
+                    std::vector<pal::string_t> list;
+                    std::vector<fx_ver_t> versions;
+                    pal::readdir_onlydirectories(fx_dir, &list);
+
+                    for (const auto& version : list)
                     {
-                        version_list.push_back(ver);
+                        fx_ver_t ver;
+                        if (fx_ver_t::parse(version, &ver, false))
+                        {
+                            versions.push_back(ver);
+                        }
                     }
+
+                    installed = installed_versions.emplace(fx_dir, std::move(versions)).first;
                 }
+                else
+                {
+                    trace::verbose(_X("Using previously enumerated versions of [%s]"), fx_dir.c_str());
+                }
+
+                std::vector<fx_ver_t> version_list = installed->second;
 
                 fx_ver_t resolved_ver = resolve_framework_reference_from_version_list(version_list, fx_ref);
                 while (resolved_ver != fx_ver_t())
@@ -438,7 +453,7 @@ StatusCode fx_resolver_t::read_framework(
             m_effective_fx_references[fx_name] = new_effective_fx_ref;
 
             // Resolve the effective framework reference against the existing physical framework folders
-            std::unique_ptr<fx_definition_t> fx = resolve_framework_reference(new_effective_fx_ref, m_oldest_fx_references[fx_name].get_fx_version(), dotnet_root, m_disable_multilevel_lookup);
+            std::unique_ptr<fx_definition_t> fx = resolve_framework_reference(new_effective_fx_ref, m_oldest_fx_references[fx_name].get_fx_version(), dotnet_root, m_disable_multilevel_lookup, m_installed_versions);
             if (fx == nullptr)
             {
                 resolution_failure.missing = std::move(new_effective_fx_ref);
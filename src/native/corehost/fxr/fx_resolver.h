@@ -13,6 +13,9 @@ class runtime_config_t;
 class fx_resolver_t
 {
 public:
+    // Map of framework directory (<hive>/shared/<FX name>) -> versions installed in it
+    using fx_dir_to_versions_map_t = std::unordered_map<pal::string_t, std::vector<fx_ver_t>>;
+
     struct resolution_failure_info
     {
         fx_reference_t missing;
@@ -95,6 +98,10 @@ private:
     // of the algorithm.
     fx_name_to_fx_reference_map_t m_oldest_fx_references;
 
+    // Versions found in each framework directory enumerated so far. The resolution may restart several times
+    // and visit the same directories again, this keeps it from re-reading them from disk.
+    fx_dir_to_versions_map_t m_installed_versions;
+
     bool m_disable_multilevel_lookup;
     const runtime_config_t::settings_t& m_override_settings;
 };
@@ -985,6 +985,22 @@ bool pal::file_exists(const pal::string_t& path)
     return (::access(path.c_str(), F_OK) == 0);
 }
 
+bool pal::get_last_write_time(const pal::string_t& path, int64_t* time)
+{
+    struct stat buf;
+    if (::stat(path.c_str(), &buf) != 0)
+    {
+        return false;
+    }
+
+#if defined(TARGET_OSX)
+    *time = static_cast<int64_t>(buf.st_mtimespec.tv_sec) * 1000000000 + buf.st_mtimespec.tv_nsec;
+#else
+    *time = static_cast<int64_t>(buf.st_mtim.tv_sec) * 1000000000 + buf.st_mtim.tv_nsec;
+#endif
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
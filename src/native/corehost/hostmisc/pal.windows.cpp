@@ -996,6 +996,18 @@ bool pal::file_exists(const string_t& path)
     return pal::fullpath(&tmp, true);
 }
 
+bool pal::get_last_write_time(const string_t& path, int64_t* time)
+{
+    WIN32_FILE_ATTRIBUTE_DATA data;
+    if (!GetFileAttributesExW(path.c_str(), GetFileExInfoStandard, &data))
+    {
+        return false;
+    }
+
+    *time = (static_cast<int64_t>(data.ftLastWriteTime.dwHighDateTime) << 32) | data.ftLastWriteTime.dwLowDateTime;
+    return true;
+}
+
 static void readdir(const pal::string_t& path, const pal::string_t& pattern, bool onlydirectories, std::vector<pal::string_t>* list)
 {
     assert(list != nullptr);
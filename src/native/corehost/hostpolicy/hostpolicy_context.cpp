@@ -11,6 +11,7 @@
 #include "bundle/runner.h"
 #include "bundle/file_entry.h"
 #include "shared_store.h"
+#include "startup_cache.h"
 
 namespace
 {
@@ -133,6 +134,74 @@ namespace
 
         return -1;
     }
+
+    int resolve_dependencies(
+        const hostpolicy_init_t &hostpolicy_init,
+        const arguments_t &args,
+        const std::vector<pal::string_t> &shared_stores,
+        bool use_rid_fallback_graph,
+        std::unordered_set<pal::string_t> *breadcrumbs,
+        startup_cache::resolved_t *resolved)
+    {
+        deps_json_t::rid_resolution_options_t rid_resolution_options
+        {
+            use_rid_fallback_graph,
+            nullptr, /*rid_fallback_graph*/
+        };
+        deps_resolver_t resolver
+        {
+            args,
+            hostpolicy_init.fx_definitions,
+            hostpolicy_init.additional_deps_serialized.c_str(),
+            shared_stores,
+            hostpolicy_init.probe_paths,
+            rid_resolution_options,
+            hostpolicy_init.is_framework_dependent
+        };
+
+        pal::string_t resolver_errors;
+        if (!resolver.valid(&resolver_errors))
+        {
+            trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
+            return StatusCode::ResolverInitFailure;
+        }
+
+        if (!resolver.resolve_probe_paths(&resolved->probe_paths, breadcrumbs))
+        {
+            return StatusCode::ResolverResolveFailure;
+        }
+
+        if (resolver.is_framework_dependent())
+        {
+            // Use the root fx to define FX_DEPS_FILE
+            resolved->fx_deps = resolver.get_root_deps().get_deps_file();
+        }
+
+        pal::string_t& app_context_deps_str = resolved->app_context_deps;
+        resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
+        {
+            if (!app_context_deps_str.empty())
+                app_context_deps_str += _X(';');
+
+            // For the application's .deps.json if this is single file, 3.1 backward compat
+            // then the path used internally is the bundle path, but externally we need to report
+            // the path to the extraction folder.
+            if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
+            {
+                pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
+                append_path(&deps_path, get_filename(deps_file).c_str());
+                app_context_deps_str += deps_path;
+            }
+            else
+            {
+                app_context_deps_str += deps_file;
+            }
+        });
+
+        resolver.get_app_dir(&resolved->app_base);
+        resolved->probe_directories = resolver.get_lookup_probe_directories();
+        return StatusCode::Success;
+    }
 }
 
 bool hostpolicy_context_t::should_read_rid_fallback_graph(const hostpolicy_init_t &init)
@@ -155,31 +224,6 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
     host_path = hostpolicy_init.host_info.host_path;
     breadcrumbs_enabled = enable_breadcrumbs;
 
-    deps_json_t::rid_resolution_options_t rid_resolution_options
-    {
-        should_read_rid_fallback_graph(hostpolicy_init),
-        nullptr, /*rid_fallback_graph*/
-    };
-    deps_resolver_t resolver
-    {
-        args,
-        hostpolicy_init.fx_definitions,
-        hostpolicy_init.additional_deps_serialized.c_str(),
-        shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path),
-        hostpolicy_init.probe_paths,
-        rid_resolution_options,
-        hostpolicy_init.is_framework_dependent
-    };
-
-    pal::string_t resolver_errors;
-    if (!resolver.valid(&resolver_errors))
-    {
-        trace::error(_X("Error initializing the dependency resolver: %s"), resolver_errors.c_str());
-        return StatusCode::ResolverInitFailure;
-    }
-
-    probe_paths_t probe_paths;
-
     // Setup breadcrumbs.
     if (breadcrumbs_enabled)
     {
@@ -189,20 +233,32 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         // Always insert the hostpolicy that the code is running on.
         breadcrumbs.insert(policy_name);
         breadcrumbs.insert(policy_name + _X(",") + policy_version);
-
-        if (!resolver.resolve_probe_paths(&probe_paths, &breadcrumbs))
-        {
-            return StatusCode::ResolverResolveFailure;
-        }
     }
-    else
+
+    bool use_rid_fallback_graph = should_read_rid_fallback_graph(hostpolicy_init);
+    std::vector<pal::string_t> shared_stores = shared_store::get_paths(hostpolicy_init.tfm, host_mode, host_path);
+
+    // Breadcrumbs are collected while resolving, so the startup cache cannot be used with them.
+    startup_cache::resolved_t resolved;
+    startup_cache::cache_t cache { hostpolicy_init, args, shared_stores, use_rid_fallback_graph };
+    bool use_startup_cache = !breadcrumbs_enabled && cache.is_enabled();
+    if (!use_startup_cache || !cache.try_read(&resolved))
     {
-        if (!resolver.resolve_probe_paths(&probe_paths, nullptr))
-        {
-            return StatusCode::ResolverResolveFailure;
-        }
+        int rc = resolve_dependencies(
+            hostpolicy_init,
+            args,
+            shared_stores,
+            use_rid_fallback_graph,
+            breadcrumbs_enabled ? &breadcrumbs : nullptr,
+            &resolved);
+        if (rc != StatusCode::Success)
+            return rc;
+
+        if (use_startup_cache)
+            cache.write(resolved);
     }
 
+    probe_paths_t& probe_paths = resolved.probe_paths;
     clr_path = probe_paths.coreclr;
     if (clr_path.empty() || !pal::fullpath(&clr_path))
     {
@@ -242,44 +298,15 @@ int hostpolicy_context_t::initialize(const hostpolicy_init_t &hostpolicy_init, c
         probe_paths.tpa.append(corelib_path);
     }
 
-    pal::string_t fx_deps_str;
-    if (resolver.is_framework_dependent())
-    {
-        // Use the root fx to define FX_DEPS_FILE
-        fx_deps_str = resolver.get_root_deps().get_deps_file();
-    }
-
-    pal::string_t app_context_deps_str;
-    resolver.enum_app_context_deps_files([&](const pal::string_t& deps_file)
-    {
-        if (!app_context_deps_str.empty())
-            app_context_deps_str += _X(';');
-
-        // For the application's .deps.json if this is single file, 3.1 backward compat
-        // then the path used internally is the bundle path, but externally we need to report
-        // the path to the extraction folder.
-        if (app_context_deps_str.empty() && bundle::info_t::is_single_file_bundle() && bundle::runner_t::app()->is_netcoreapp3_compat_mode())
-        {
-            pal::string_t deps_path = bundle::runner_t::app()->extraction_path();
-            append_path(&deps_path, get_filename(deps_file).c_str());
-            app_context_deps_str += deps_path;
-        }
-        else
-        {
-            app_context_deps_str += deps_file;
-        }
-    });
-
     // Build properties for CoreCLR instantiation
-    pal::string_t app_base;
-    resolver.get_app_dir(&app_base);
+    const pal::string_t& app_base = resolved.app_base;
     coreclr_properties.add(common_property::TrustedPlatformAssemblies, probe_paths.tpa.c_str());
     coreclr_properties.add(common_property::NativeDllSearchDirectories, probe_paths.native.c_str());
     coreclr_properties.add(common_property::PlatformResourceRoots, probe_paths.resources.c_str());
     coreclr_properties.add(common_property::AppContextBaseDirectory, app_base.c_str());
-    coreclr_properties.add(common_property::AppContextDepsFiles, app_context_deps_str.c_str());
-    coreclr_properties.add(common_property::FxDepsFile, fx_deps_str.c_str());
-    coreclr_properties.add(common_property::ProbingDirectories, resolver.get_lookup_probe_directories().c_str());
+    coreclr_properties.add(common_property::AppContextDepsFiles, resolved.app_context_deps.c_str());
+    coreclr_properties.add(common_property::FxDepsFile, resolved.fx_deps.c_str());
+    coreclr_properties.add(common_property::ProbingDirectories, resolved.probe_directories.c_str());
     coreclr_properties.add(common_property::RuntimeIdentifier, get_runtime_id().c_str());
 
     bool set_app_paths = false;
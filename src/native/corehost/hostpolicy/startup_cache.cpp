@@ -0,0 +1,327 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache.h"
+#include "startup_cache_inputs.h"
+#include "bundle/info.h"
+#include <trace.h>
+#include <utils.h>
+
+#define STARTUP_CACHE_ENV _X("DOTNET_HOST_STARTUP_CACHE")
+
+namespace
+{
+    const uint32_t cache_magic = 0x43535448; // 'HTSC'
+
+    // Bump the version whenever the data written to the cache or its interpretation changes
+    const uint32_t cache_version = 2;
+
+    void append_key_part(pal::string_t* key, const pal::string_t& part)
+    {
+        key->append(part);
+        key->push_back(_X('\0'));
+    }
+
+    class writer_t
+    {
+    public:
+        void write_uint32(uint32_t value)
+        {
+            write_bytes(&value, sizeof(value));
+        }
+
+        void write_int64(int64_t value)
+        {
+            write_bytes(&value, sizeof(value));
+        }
+
+        void write_string(const pal::string_t& value)
+        {
+            write_uint32(static_cast<uint32_t>(value.size()));
+            write_bytes(value.data(), value.size() * sizeof(pal::char_t));
+        }
+
+        const std::vector<char>& data() const { return m_data; }
+
+    private:
+        void write_bytes(const void* bytes, size_t size)
+        {
+            const char* begin = static_cast<const char*>(bytes);
+            m_data.insert(m_data.end(), begin, begin + size);
+        }
+
+        std::vector<char> m_data;
+    };
+
+    class reader_t
+    {
+    public:
+        reader_t(const std::vector<char>& data)
+            : m_data(data)
+            , m_offset(0)
+        { }
+
+        bool read_uint32(uint32_t* value)
+        {
+            return read_bytes(value, sizeof(*value));
+        }
+
+        bool read_int64(int64_t* value)
+        {
+            return read_bytes(value, sizeof(*value));
+        }
+
+        bool read_string(pal::string_t* value)
+        {
+            uint32_t length;
+            if (!read_uint32(&length) || length > (m_data.size() - m_offset) / sizeof(pal::char_t))
+                return false;
+
+            value->resize(length);
+            return read_bytes(&(*value)[0], length * sizeof(pal::char_t));
+        }
+
+        bool at_end() const { return m_offset == m_data.size(); }
+
+    private:
+        bool read_bytes(void* bytes, size_t size)
+        {
+            if (size > m_data.size() - m_offset)
+                return false;
+
+            if (size > 0)
+                memcpy(bytes, m_data.data() + m_offset, size);
+
+            m_offset += size;
+            return true;
+        }
+
+        const std::vector<char>& m_data;
+        size_t m_offset;
+    };
+
+    bool read_file(const pal::string_t& path, std::vector<char>* data)
+    {
+        FILE* file = pal::file_open(path, _X("rb"));
+        if (file == nullptr)
+            return false;
+
+        bool success = false;
+        if (fseek(file, 0, SEEK_END) == 0)
+        {
+            long size = ftell(file);
+            if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+            {
+                data->resize(static_cast<size_t>(size));
+                success = fread(data->data(), 1, data->size(), file) == data->size();
+            }
+        }
+
+        fclose(file);
+        return success;
+    }
+}
+
+startup_cache::cache_t::cache_t(
+    const hostpolicy_init_t& init,
+    const arguments_t& args,
+    const std::vector<pal::string_t>& shared_stores,
+    bool use_rid_fallback_graph)
+{
+    pal::string_t path;
+    if (!pal::getenv(STARTUP_CACHE_ENV, &path) || path.empty())
+        return;
+
+    // Single-file bundles resolve from the bundle itself and additional deps can point at arbitrary
+    // directory trees, so neither is cached.
+    if (bundle::info_t::is_single_file_bundle() || !init.additional_deps_serialized.empty())
+    {
+        trace::verbose(_X("Startup cache is not used for this application"));
+        return;
+    }
+
+    pal::string_t core_servicing;
+    pal::get_default_servicing_directory(&core_servicing);
+
+    append_key_part(&m_key, _STRINGIFY(HOST_VERSION));
+    append_key_part(&m_key, pal::to_string(static_cast<int>(args.host_mode)));
+    append_key_part(&m_key, init.is_framework_dependent ? _X("fdd") : _X("scd"));
+    append_key_part(&m_key, use_rid_fallback_graph ? _X("rid_graph") : _X("no_rid_graph"));
+    append_key_part(&m_key, get_runtime_id());
+    append_key_part(&m_key, init.host_info.host_path);
+    append_key_part(&m_key, args.managed_application);
+    append_key_part(&m_key, args.app_root);
+    append_key_part(&m_key, args.deps_path);
+    append_key_part(&m_key, core_servicing);
+    for (const auto& fx : init.fx_definitions)
+    {
+        append_key_part(&m_key, fx->get_name());
+        append_key_part(&m_key, fx->get_dir());
+    }
+
+    for (const auto& probe_path : init.probe_paths)
+        append_key_part(&m_key, probe_path);
+
+    for (const auto& shared_store : shared_stores)
+        append_key_part(&m_key, shared_store);
+
+    // The .deps.json files drive the resolution. The directories are the locations that are probed
+    // for assets, so adding or removing files in them invalidates the cache. The resolved assets and
+    // the directories they were found in are added when the cache is written.
+    m_inputs.push_back(args.deps_path);
+    for (size_t i = 1; i < init.fx_definitions.size(); ++i)
+    {
+        const auto& fx = init.fx_definitions[i];
+        m_inputs.push_back(deps_resolver_t::get_fx_deps(fx->get_dir(), fx->get_name()));
+    }
+
+    m_inputs.push_back(args.app_root);
+    for (size_t i = 1; i < init.fx_definitions.size(); ++i)
+        m_inputs.push_back(init.fx_definitions[i]->get_dir());
+
+    m_inputs.push_back(core_servicing);
+    m_inputs.insert(m_inputs.end(), init.probe_paths.begin(), init.probe_paths.end());
+    m_inputs.insert(m_inputs.end(), shared_stores.begin(), shared_stores.end());
+
+    m_path = path;
+    trace::verbose(_X("Using startup cache [%s]"), m_path.c_str());
+}
+
+bool startup_cache::cache_t::try_read(resolved_t* resolved) const
+{
+    assert(is_enabled());
+
+    std::vector<char> data;
+    if (!read_file(m_path, &data))
+    {
+        trace::verbose(_X("Startup cache [%s] could not be read"), m_path.c_str());
+        return false;
+    }
+
+    reader_t reader(data);
+    uint32_t magic;
+    uint32_t version;
+    uint32_t char_size;
+    if (!reader.read_uint32(&magic) || magic != cache_magic
+        || !reader.read_uint32(&version) || version != cache_version
+        || !reader.read_uint32(&char_size) || char_size != sizeof(pal::char_t))
+    {
+        trace::verbose(_X("Startup cache [%s] has an unsupported format"), m_path.c_str());
+        return false;
+    }
+
+    pal::string_t key;
+    if (!reader.read_string(&key) || key != m_key)
+    {
+        trace::verbose(_X("Startup cache [%s] was created for a different application or configuration"), m_path.c_str());
+        return false;
+    }
+
+    uint32_t input_count;
+    if (!reader.read_uint32(&input_count))
+        return false;
+
+    std::vector<input_t> inputs;
+    for (uint32_t i = 0; i < input_count; ++i)
+    {
+        input_t input;
+        if (!reader.read_string(&input.path) || !reader.read_int64(&input.time))
+        {
+            trace::verbose(_X("Startup cache [%s] is corrupt"), m_path.c_str());
+            return false;
+        }
+
+        inputs.push_back(std::move(input));
+    }
+
+    pal::string_t changed;
+    if (!inputs_t::are_up_to_date(inputs, &changed))
+    {
+        trace::verbose(_X("Startup cache [%s] is out of date: [%s] changed"), m_path.c_str(), changed.c_str());
+        return false;
+    }
+
+    resolved_t result;
+    if (!reader.read_string(&result.probe_paths.tpa)
+        || !reader.read_string(&result.probe_paths.native)
+        || !reader.read_string(&result.probe_paths.resources)
+        || !reader.read_string(&result.probe_paths.coreclr)
+        || !reader.read_string(&result.app_base)
+        || !reader.read_string(&result.app_context_deps)
+        || !reader.read_string(&result.fx_deps)
+        || !reader.read_string(&result.probe_directories)
+        || !reader.at_end())
+    {
+        trace::verbose(_X("Startup cache [%s] is corrupt"), m_path.c_str());
+        return false;
+    }
+
+    trace::info(_X("Using dependency resolution results from startup cache [%s]"), m_path.c_str());
+    *resolved = std::move(result);
+    return true;
+}
+
+void startup_cache::cache_t::write(const resolved_t& resolved) const
+{
+    assert(is_enabled());
+
+    // Validate against the assets that resolution picked and the directories they came from, not just the
+    // probe roots, so that changes under runtimes/<rid> or package version directories are seen too.
+    inputs_t inputs(m_path);
+    for (const auto& input : m_inputs)
+        inputs.add(input);
+
+    inputs.add_files_and_directories(resolved.probe_paths.tpa);
+    inputs.add_files_and_directories(resolved.probe_paths.coreclr);
+    inputs.add_directories(resolved.probe_paths.native);
+    inputs.add_directories(resolved.probe_paths.resources);
+
+    writer_t writer;
+    writer.write_uint32(cache_magic);
+    writer.write_uint32(cache_version);
+    writer.write_uint32(sizeof(pal::char_t));
+    writer.write_string(m_key);
+    writer.write_uint32(static_cast<uint32_t>(inputs.get().size()));
+    for (const input_t& input : inputs.get())
+    {
+        writer.write_string(input.path);
+        writer.write_int64(input.time);
+    }
+
+    writer.write_string(resolved.probe_paths.tpa);
+    writer.write_string(resolved.probe_paths.native);
+    writer.write_string(resolved.probe_paths.resources);
+    writer.write_string(resolved.probe_paths.coreclr);
+    writer.write_string(resolved.app_base);
+    writer.write_string(resolved.app_context_deps);
+    writer.write_string(resolved.fx_deps);
+    writer.write_string(resolved.probe_directories);
+
+    // Write to a process-specific file and move it into place so concurrent launches never observe a partial cache
+    pal::string_t temp_path = m_path + _X(".") + pal::to_string(pal::get_pid()) + _X(".tmp");
+    FILE* file = pal::file_open(temp_path, _X("wb"));
+    if (file == nullptr)
+    {
+        trace::verbose(_X("Failed to create startup cache [%s]"), temp_path.c_str());
+        return;
+    }
+
+    const std::vector<char>& data = writer.data();
+    bool success = fwrite(data.data(), 1, data.size(), file) == data.size();
+    success = (fclose(file) == 0) && success;
+    if (success && pal::rename(temp_path.c_str(), m_path.c_str()) != 0)
+    {
+        // Renaming over an existing file is not supported on all platforms
+        pal::remove(m_path.c_str());
+        success = pal::rename(temp_path.c_str(), m_path.c_str()) == 0;
+    }
+
+    if (!success)
+    {
+        trace::verbose(_X("Failed to write startup cache [%s]"), m_path.c_str());
+        pal::remove(temp_path.c_str());
+        return;
+    }
+
+    trace::verbose(_X("Wrote startup cache [%s]"), m_path.c_str());
+}
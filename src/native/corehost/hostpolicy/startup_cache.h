@@ -0,0 +1,52 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef STARTUP_CACHE_H
+#define STARTUP_CACHE_H
+
+#include <pal.h>
+#include "args.h"
+#include "deps_resolver.h"
+#include "hostpolicy_init.h"
+
+// Opt-in cache of the dependency resolution results for a given app launch.
+//
+// Enabled by setting DOTNET_HOST_STARTUP_CACHE to the path of the cache file. The cache is keyed by
+// everything the resolution depends on (host version, app and framework locations, probe paths, RID)
+// and validated against the last write times of the .deps.json files, the probed directories, and the
+// resolved assets along with the directories they were found in.
+// On a hit, parsing the .deps.json files and probing the file system is skipped entirely.
+namespace startup_cache
+{
+    struct resolved_t
+    {
+        probe_paths_t probe_paths;
+        pal::string_t app_base;
+        pal::string_t app_context_deps;
+        pal::string_t fx_deps;
+        pal::string_t probe_directories;
+    };
+
+    class cache_t
+    {
+    public:
+        cache_t(
+            const hostpolicy_init_t& init,
+            const arguments_t& args,
+            const std::vector<pal::string_t>& shared_stores,
+            bool use_rid_fallback_graph);
+
+        // Whether the cache is enabled and applicable for this launch
+        bool is_enabled() const { return !m_path.empty(); }
+
+        bool try_read(resolved_t* resolved) const;
+        void write(const resolved_t& resolved) const;
+
+    private:
+        pal::string_t m_path;
+        pal::string_t m_key;
+        std::vector<pal::string_t> m_inputs;
+    };
+}
+
+#endif // STARTUP_CACHE_H
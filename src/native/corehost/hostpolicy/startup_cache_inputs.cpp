@@ -0,0 +1,89 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache_inputs.h"
+#include <utils.h>
+
+namespace
+{
+    int64_t get_input_time(const pal::string_t& path)
+    {
+        int64_t time;
+        if (!pal::get_last_write_time(path, &time))
+            time = startup_cache::missing_input_time;
+
+        return time;
+    }
+
+    template<typename Fn>
+    void for_each_path(const pal::string_t& paths, Fn fn)
+    {
+        size_t start = 0;
+        while (start < paths.size())
+        {
+            size_t end = paths.find(PATH_SEPARATOR, start);
+            if (end == pal::string_t::npos)
+                end = paths.size();
+
+            if (end > start)
+                fn(paths.substr(start, end - start));
+
+            start = end + 1;
+        }
+    }
+}
+
+startup_cache::inputs_t::inputs_t(const pal::string_t& cache_path)
+{
+    m_cache_dir = get_directory(cache_path);
+    pal::fullpath(&m_cache_dir, /*skip_error_logging*/ true);
+    remove_trailing_dir_separator(&m_cache_dir);
+}
+
+void startup_cache::inputs_t::add(const pal::string_t& path)
+{
+    if (path.empty())
+        return;
+
+    pal::string_t normalized = path;
+    remove_trailing_dir_separator(&normalized);
+    if (normalized.empty() || pal::pathcmp(normalized, m_cache_dir) == 0)
+        return;
+
+    if (!m_added.insert(normalized).second)
+        return;
+
+    int64_t time = get_input_time(normalized);
+    m_inputs.push_back({ std::move(normalized), time });
+}
+
+void startup_cache::inputs_t::add_files_and_directories(const pal::string_t& paths)
+{
+    for_each_path(paths, [&](const pal::string_t& path)
+    {
+        add(path);
+        add(get_directory(path));
+    });
+}
+
+void startup_cache::inputs_t::add_directories(const pal::string_t& paths)
+{
+    for_each_path(paths, [&](const pal::string_t& path)
+    {
+        add(path);
+    });
+}
+
+bool startup_cache::inputs_t::are_up_to_date(const std::vector<input_t>& inputs, pal::string_t* changed)
+{
+    for (const input_t& input : inputs)
+    {
+        if (get_input_time(input.path) != input.time)
+        {
+            *changed = input.path;
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,51 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#ifndef STARTUP_CACHE_INPUTS_H
+#define STARTUP_CACHE_INPUTS_H
+
+#include <pal.h>
+#include <unordered_set>
+#include <vector>
+
+namespace startup_cache
+{
+    // Last write time recorded for inputs that do not exist
+    const int64_t missing_input_time = -1;
+
+    struct input_t
+    {
+        pal::string_t path;
+        int64_t time;
+    };
+
+    // Collects the files and directories a cached resolution depends on, along with their last write times.
+    //
+    // The directory containing the cache file is never recorded - writing the cache would change its last
+    // write time and invalidate the cache right away.
+    class inputs_t
+    {
+    public:
+        inputs_t(const pal::string_t& cache_path);
+
+        void add(const pal::string_t& path);
+
+        // Adds each file in a PATH_SEPARATOR delimited list, along with the directory containing it
+        void add_files_and_directories(const pal::string_t& paths);
+
+        // Adds each directory in a PATH_SEPARATOR delimited list
+        void add_directories(const pal::string_t& paths);
+
+        const std::vector<input_t>& get() const { return m_inputs; }
+
+        // Checks that every input still has its recorded last write time. If not, changed is set to the first input that differs.
+        static bool are_up_to_date(const std::vector<input_t>& inputs, pal::string_t* changed);
+
+    private:
+        pal::string_t m_cache_dir;
+        std::unordered_set<pal::string_t> m_added;
+        std::vector<input_t> m_inputs;
+    };
+}
+
+#endif // STARTUP_CACHE_INPUTS_H
@@ -0,0 +1,154 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include <pal.h>
+#include <error_codes.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <hostfxr.h>
+#include <coreclr_delegates.h>
+#include "hostfxr_exports.h"
+#include "benchmark_test.h"
+
+namespace
+{
+    const pal::char_t *benchmark_log_prefix = _X("[BENCHMARK] ");
+
+    using timer_clock = std::chrono::steady_clock;
+
+    int64_t elapsed_ns(timer_clock::time_point start, timer_clock::time_point end)
+    {
+        return static_cast<int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    }
+
+    void write_metric(const pal::char_t *name, int64_t value, pal::stringstream_t &test_output)
+    {
+        test_output << benchmark_log_prefix << name << _X("=") << std::dec << value << std::endl;
+    }
+
+    void write_failure(const pal::char_t *phase, int rc, pal::stringstream_t &test_output)
+    {
+        test_output << benchmark_log_prefix << phase << _X(" failed: ") << std::hex << std::showbase << rc << std::endl;
+    }
+
+    // Percentile over an already sorted set of samples, using the nearest-rank method
+    int64_t percentile(const std::vector<int64_t> &sorted_samples, int pct)
+    {
+        size_t rank = (sorted_samples.size() * static_cast<size_t>(pct) + 99) / 100;
+        return sorted_samples[rank == 0 ? 0 : rank - 1];
+    }
+}
+
+bool benchmark_test::load_assembly_and_get_function_pointer(
+    const pal::string_t &hostfxr_path,
+    const pal::char_t *config_path,
+    const pal::char_t *assembly_path,
+    const pal::char_t *type_name,
+    const pal::char_t *method_name,
+    int iterations,
+    pal::stringstream_t &test_output)
+{
+    timer_clock::time_point start = timer_clock::now();
+    std::unique_ptr<hostfxr_exports> hostfxr{ new hostfxr_exports(hostfxr_path) };
+    timer_clock::time_point end = timer_clock::now();
+    write_metric(_X("hostfxr_load_ns"), elapsed_ns(start, end), test_output);
+
+    hostfxr_handle handle;
+    start = timer_clock::now();
+    int rc = hostfxr->init_config(config_path, nullptr, &handle);
+    end = timer_clock::now();
+    if (!STATUS_CODE_SUCCEEDED(rc))
+    {
+        write_failure(_X("hostfxr_initialize_for_runtime_config"), rc, test_output);
+        return false;
+    }
+
+    write_metric(_X("hostfxr_initialize_for_runtime_config_ns"), elapsed_ns(start, end), test_output);
+
+    // Getting the first delegate is what actually starts the runtime
+    load_assembly_and_get_function_pointer_fn load_assembly_and_get_function_pointer = nullptr;
+    start = timer_clock::now();
+    rc = hostfxr->get_delegate(handle, hostfxr_delegate_type::hdt_load_assembly_and_get_function_pointer, (void **)&load_assembly_and_get_function_pointer);
+    end = timer_clock::now();
+    bool success = rc == StatusCode::Success;
+    if (success)
+    {
+        write_metric(_X("hostfxr_get_runtime_delegate_ns"), elapsed_ns(start, end), test_output);
+    }
+    else
+    {
+        write_failure(_X("hostfxr_get_runtime_delegate"), rc, test_output);
+    }
+
+    component_entry_point_fn entry_point = nullptr;
+    if (success)
+    {
+        const pal::char_t *delegate_name = nullptr;
+        pal::string_t method_name_local{ method_name };
+        if (pal::string_t::npos != method_name_local.find(_X("Unmanaged")))
+            delegate_name = UNMANAGEDCALLERSONLY_METHOD;
+
+        start = timer_clock::now();
+        rc = load_assembly_and_get_function_pointer(assembly_path, type_name, method_name, delegate_name, nullptr /* reserved */, (void **)&entry_point);
+        end = timer_clock::now();
+        success = rc == StatusCode::Success;
+        if (success)
+        {
+            write_metric(_X("load_assembly_and_get_function_pointer_ns"), elapsed_ns(start, end), test_output);
+        }
+        else
+        {
+            write_failure(_X("load_assembly_and_get_function_pointer"), rc, test_output);
+        }
+    }
+
+    if (success)
+    {
+        // The first call pays for JIT compiling the target and any stubs between it and native code
+        start = timer_clock::now();
+        entry_point(nullptr, 0);
+        end = timer_clock::now();
+        write_metric(_X("first_call_ns"), elapsed_ns(start, end), test_output);
+
+        if (iterations > 0)
+        {
+            std::vector<int64_t> samples;
+            samples.reserve(static_cast<size_t>(iterations));
+            timer_clock::time_point batch_start = timer_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                start = timer_clock::now();
+                entry_point(nullptr, 0);
+                end = timer_clock::now();
+                samples.push_back(elapsed_ns(start, end));
+            }
+
+            timer_clock::time_point batch_end = timer_clock::now();
+
+            std::sort(samples.begin(), samples.end());
+            write_metric(_X("warm_call_iterations"), iterations, test_output);
+            write_metric(_X("warm_call_total_ns"), elapsed_ns(batch_start, batch_end), test_output);
+            write_metric(_X("warm_call_min_ns"), samples.front(), test_output);
+            write_metric(_X("warm_call_p50_ns"), percentile(samples, 50), test_output);
+            write_metric(_X("warm_call_p90_ns"), percentile(samples, 90), test_output);
+            write_metric(_X("warm_call_p99_ns"), percentile(samples, 99), test_output);
+            write_metric(_X("warm_call_max_ns"), samples.back(), test_output);
+        }
+    }
+
+    start = timer_clock::now();
+    int rcClose = hostfxr->close(handle);
+    end = timer_clock::now();
+    if (rcClose == StatusCode::Success)
+    {
+        write_metric(_X("hostfxr_close_ns"), elapsed_ns(start, end), test_output);
+    }
+    else
+    {
+        write_failure(_X("hostfxr_close"), rcClose, test_output);
+    }
+
+    return success && rcClose == StatusCode::Success;
+}
@@ -0,0 +1,24 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#pragma once
+
+#include <pal.h>
+
+namespace benchmark_test
+{
+    // Timer for the hosting API calls of the load_assembly_and_get_function_pointer scenario: loading hostfxr,
+    // initializing the runtime for a config, getting the delegate, resolving the entry point and closing the
+    // host context, plus the latency of the first and subsequent calls through the returned function pointer.
+    // It only times the calls for a caller-provided assembly, there is no scenario asset or harness that
+    // consumes the output. Results are written to test_output as one '[BENCHMARK] <metric>=<value>' line per
+    // measurement.
+    bool load_assembly_and_get_function_pointer(
+        const pal::string_t &hostfxr_path,
+        const pal::char_t *config_path,
+        const pal::char_t *assembly_path,
+        const pal::char_t *type_name,
+        const pal::char_t *method_name,
+        int iterations,
+        pal::stringstream_t &test_output);
+}
@@ -5,6 +5,7 @@
 #include <pal.h>
 #include <error_codes.h>
 #include <nethost.h>
+#include "benchmark_test.h"
 #include "comhost_test.h"
 #include <hostfxr.h>
 #include "host_context_test.h"
@@ -373,6 +374,32 @@ int main(const int argc, const pal::char_t *argv[])
         std::cout << tostr(test_output.str()).data() << std::endl;
         return success ? EXIT_SUCCESS : EXIT_FAILURE;
     }
+    else if (pal::strcmp(command, _X("benchmark_load_assembly_and_get_function_pointer")) == 0)
+    {
+        // Times the hosting API calls, see benchmark_test.h
+        // args: ... <hostfxr_path> <config_path> <assembly_path> <type_name> <method_name> [<iterations>]
+        if (argc < 7)
+        {
+            std::cerr << "Invalid arguments" << std::endl;
+            return -1;
+        }
+
+        const pal::string_t hostfxr_path = argv[2];
+        const pal::char_t *config_path = argv[3];
+        const pal::char_t *assembly_path = argv[4];
+        const pal::char_t *type_name = argv[5];
+        const pal::char_t *method_name = argv[6];
+
+        int iterations = 1000;
+        if (argc >= 8)
+            iterations = pal::xtoi(argv[7]);
+
+        pal::stringstream_t test_output;
+        bool success = benchmark_test::load_assembly_and_get_function_pointer(hostfxr_path, config_path, assembly_path, type_name, method_name, iterations, test_output);
+
+        std::cout << tostr(test_output.str()).data() << std::endl;
+        return success ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
     else if (pal::strcmp(command, _X("component_get_function_pointer")) == 0)
     {
         // args: ... <hostfxr_path> <app_or_config_path> <type_name> <method_name> [<type_name> <method_name>...]
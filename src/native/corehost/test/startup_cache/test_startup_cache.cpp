@@ -0,0 +1,211 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+#include "startup_cache_inputs.h"
+#include "pal.h"
+#include "utils.h"
+
+#define TEST_ASSERT(a) \
+  if (!(a)) \
+  { \
+    fprintf(stderr, "TEST_ASSERT failed '%s' at %d\n", #a, __LINE__); \
+    exit(1); \
+  }
+
+namespace
+{
+    pal::string_t combine(const pal::string_t& dir, const pal::char_t* name)
+    {
+        pal::string_t path = dir;
+        append_path(&path, name);
+        return path;
+    }
+
+    void write_file(const pal::string_t& path, const char* content)
+    {
+        FILE* file = pal::file_open(path, _X("wb"));
+        TEST_ASSERT(file != nullptr);
+        fputs(content, file);
+        fclose(file);
+    }
+
+    int64_t get_time(const pal::string_t& path)
+    {
+        int64_t time;
+        TEST_ASSERT(pal::get_last_write_time(path, &time));
+        return time;
+    }
+
+    // File system timestamps can be coarse, so repeat a change until the last write time of path moves
+    template<typename Fn>
+    void change(const pal::string_t& path, Fn fn)
+    {
+        int64_t before = get_time(path);
+        for (int i = 0; i < 500; ++i)
+        {
+            fn(i);
+            if (get_time(path) != before)
+                return;
+
+            pal::sleep(10);
+        }
+
+        TEST_ASSERT(!"last write time did not change");
+    }
+
+    struct layout_t
+    {
+        pal::string_t cache_dir;
+        pal::string_t cache_path;
+        pal::string_t app_dir;
+        pal::string_t app_assembly;
+        pal::string_t rid_lib_dir;
+        pal::string_t rid_assembly;
+        pal::string_t native_dir;
+    };
+
+    layout_t create_layout(const pal::string_t& root)
+    {
+        layout_t layout;
+        layout.app_dir = combine(root, _X("app"));
+        layout.cache_dir = layout.app_dir;
+        layout.cache_path = combine(layout.cache_dir, _X("startup.cache"));
+        layout.app_assembly = combine(layout.app_dir, _X("app.dll"));
+
+        pal::string_t runtimes = combine(layout.app_dir, _X("runtimes"));
+        pal::string_t rid = combine(runtimes, _X("rid"));
+        layout.rid_lib_dir = combine(rid, _X("lib"));
+        layout.rid_assembly = combine(layout.rid_lib_dir, _X("lib.dll"));
+        layout.native_dir = combine(rid, _X("native"));
+
+        pal::mkdir(root.c_str(), 0777);
+        pal::mkdir(layout.app_dir.c_str(), 0777);
+        pal::mkdir(runtimes.c_str(), 0777);
+        pal::mkdir(rid.c_str(), 0777);
+        pal::mkdir(layout.rid_lib_dir.c_str(), 0777);
+        pal::mkdir(layout.native_dir.c_str(), 0777);
+        write_file(layout.app_assembly, "app");
+        write_file(layout.rid_assembly, "lib");
+        return layout;
+    }
+
+    std::vector<startup_cache::input_t> snapshot(const layout_t& layout)
+    {
+        startup_cache::inputs_t inputs(layout.cache_path);
+        inputs.add(layout.app_dir);
+        pal::string_t tpa = layout.app_assembly;
+        tpa.push_back(PATH_SEPARATOR);
+        tpa.append(layout.rid_assembly);
+        inputs.add_files_and_directories(tpa);
+        inputs.add_directories(layout.native_dir);
+        return inputs.get();
+    }
+
+    bool contains(const std::vector<startup_cache::input_t>& inputs, const pal::string_t& path)
+    {
+        pal::string_t normalized = path;
+        remove_trailing_dir_separator(&normalized);
+        for (const startup_cache::input_t& input : inputs)
+        {
+            if (pal::pathcmp(input.path, normalized) == 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    void check_inputs(const layout_t& layout)
+    {
+        std::vector<startup_cache::input_t> inputs = snapshot(layout);
+
+        // The cache lives in the app directory, so that directory is not an input
+        TEST_ASSERT(!contains(inputs, layout.cache_dir));
+        TEST_ASSERT(contains(inputs, layout.app_assembly));
+        TEST_ASSERT(contains(inputs, layout.rid_assembly));
+        TEST_ASSERT(contains(inputs, layout.rid_lib_dir));
+        TEST_ASSERT(contains(inputs, layout.native_dir));
+
+        // Inputs that are added more than once are only recorded once
+        startup_cache::inputs_t duplicates(layout.cache_path);
+        duplicates.add(layout.native_dir);
+        duplicates.add(layout.native_dir + DIR_SEPARATOR);
+        TEST_ASSERT(duplicates.get().size() == 1);
+    }
+
+    void check_cache_write_does_not_invalidate(const layout_t& layout)
+    {
+        std::vector<startup_cache::input_t> inputs = snapshot(layout);
+
+        pal::string_t changed;
+        TEST_ASSERT(startup_cache::inputs_t::are_up_to_date(inputs, &changed));
+
+        // Writing the cache next to the app (temp file + rename) changes the directory, but not any input
+        pal::string_t temp_path = layout.cache_path + _X(".tmp");
+        change(layout.cache_dir, [&](int i)
+        {
+            write_file(temp_path, "cache");
+            pal::remove(layout.cache_path.c_str());
+            pal::rename(temp_path.c_str(), layout.cache_path.c_str());
+        });
+
+        TEST_ASSERT(startup_cache::inputs_t::are_up_to_date(inputs, &changed));
+    }
+
+    void check_nested_directory_change(const layout_t& layout)
+    {
+        std::vector<startup_cache::input_t> inputs = snapshot(layout);
+
+        // Adding a file under runtimes/<rid> is not visible in the app directory's last write time
+        change(layout.native_dir, [&](int i)
+        {
+            write_file(combine(layout.native_dir, (_X("new") + pal::to_string(i) + _X(".so")).c_str()), "native");
+        });
+
+        pal::string_t changed;
+        TEST_ASSERT(!startup_cache::inputs_t::are_up_to_date(inputs, &changed));
+        TEST_ASSERT(pal::pathcmp(changed, layout.native_dir) == 0);
+    }
+
+    void check_asset_change(const layout_t& layout)
+    {
+        std::vector<startup_cache::input_t> inputs = snapshot(layout);
+
+        change(layout.app_assembly, [&](int i)
+        {
+            write_file(layout.app_assembly, "updated app");
+        });
+
+        pal::string_t changed;
+        TEST_ASSERT(!startup_cache::inputs_t::are_up_to_date(inputs, &changed));
+        TEST_ASSERT(pal::pathcmp(changed, layout.app_assembly) == 0);
+    }
+
+    void check_asset_removed(const layout_t& layout)
+    {
+        std::vector<startup_cache::input_t> inputs = snapshot(layout);
+
+        TEST_ASSERT(pal::remove(layout.rid_assembly.c_str()) == 0);
+
+        pal::string_t changed;
+        TEST_ASSERT(!startup_cache::inputs_t::are_up_to_date(inputs, &changed));
+    }
+}
+
+#if defined(_WIN32)
+int __cdecl wmain(const int argc, const pal::char_t* argv[])
+#else
+int main(const int argc, const pal::char_t* argv[])
+#endif
+{
+    // args: [<scratch_directory>]
+    pal::string_t root = argc > 1 ? argv[1] : _X(".");
+    append_path(&root, (_X("startup_cache_test_") + pal::to_string(pal::get_pid())).c_str());
+
+    layout_t layout = create_layout(root);
+    check_inputs(layout);
+    check_cache_write_does_not_invalidate(layout);
+    check_nested_directory_change(layout);
+    check_asset_change(layout);
+    check_asset_removed(layout);
+    return 0;
+}
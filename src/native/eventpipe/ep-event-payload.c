@@ -150,6 +150,42 @@ ep_event_payload_copy_data (
 	}
 }
 
+bool
+ep_event_payload_try_copy_range (
+	const EventPipeEventPayload *event_payload,
+	uint32_t offset,
+	uint8_t *dst,
+	uint32_t len)
+{
+	EP_ASSERT (event_payload != NULL);
+	EP_ASSERT (dst != NULL);
+
+	if ((uint64_t)offset + len > event_payload->size)
+		return false;
+
+	if (ep_event_payload_is_flattened (event_payload)) {
+		memcpy (dst, event_payload->data + offset, len);
+		return true;
+	}
+
+	uint32_t data_offset = 0;
+	EventData *event_data = event_payload->event_data;
+	for (uint32_t i = 0; i < event_payload->event_data_len && len > 0; ++i) {
+		uint32_t data_size = ep_event_data_get_size (&event_data[i]);
+		if (offset < data_offset + data_size) {
+			uint32_t start = offset - data_offset;
+			uint32_t count = (len < data_size - start) ? len : data_size - start;
+			memcpy (dst, (uint8_t *)(uintptr_t)ep_event_data_get_ptr (&event_data[i]) + start, count);
+			dst += count;
+			offset += count;
+			len -= count;
+		}
+		data_offset += data_size;
+	}
+
+	return len == 0;
+}
+
 void
 ep_event_payload_flatten (EventPipeEventPayload *event_payload)
 {
@@ -191,6 +191,11 @@ inline
 bool
 ep_rt_config_value_get_output_streaming (void);
 
+static
+inline
+uint32_t
+ep_rt_config_value_get_output_file_size_mb (void);
+
 static
 inline
 bool
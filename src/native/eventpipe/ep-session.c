@@ -9,6 +9,7 @@
 #include "ep-config.h"
 #include "ep-event.h"
 #include "ep-file.h"
+#include "ep-provider.h"
 #include "ep-session.h"
 #include "ep-event-payload.h"
 #include "ep-rt.h"
@@ -30,6 +31,456 @@ static
 void
 ep_session_remove_dangling_session_states (EventPipeSession *session);
 
+static
+void
+session_rotate_file (EventPipeSession *session);
+
+static
+bool
+session_parse_payload_filter (
+	const ep_char8_t *provider_name,
+	const ep_char8_t *predicate,
+	EventPipeSessionPayloadFilter *filter);
+
+static
+bool
+session_parse_payload_filters (
+	const ep_char8_t *provider_name,
+	const ep_char8_t *filter_data,
+	EventPipeSessionPayloadFilter *filters,
+	uint32_t *filters_len);
+
+// _Requires_lock_held (ep)
+static
+bool
+session_alloc_payload_filters (
+	EventPipeSession *session,
+	const EventPipeProviderConfiguration *providers,
+	uint32_t providers_len);
+
+static
+void
+session_free_payload_filters (EventPipeSession *session);
+
+static
+bool
+session_payload_filter_match (
+	const EventPipeSessionPayloadFilter *filter,
+	const EventPipeEventPayload *payload);
+
+static
+bool
+session_payload_filters_match (
+	const EventPipeSession *session,
+	const EventPipeEvent *ep_event,
+	const EventPipeEventPayload *payload);
+
+/*
+ * EventPipeSessionPayloadFilter.
+ */
+
+// Filter data key holding a comma separated list of payload predicates for the provider, each in the form
+// <event id>:<payload byte offset>:<type><operator><value>, where type is one of u1, u2, u4, u8, i1, i2, i4, i8,
+// f4 or f8 and operator is one of ==, !=, <, <=, > or >=. For example, "EventPipePayloadFilter=\"1:4:u4>=2\""
+// on Microsoft-Windows-DotNETRuntime only writes GCStart events for gen2 collections. Events with an id that has
+// predicates are only written when all of them hold, other events of the provider are not affected.
+#define EP_SESSION_PAYLOAD_FILTER_KEY "EventPipePayloadFilter"
+
+// Longest accepted single predicate.
+#define EP_SESSION_PAYLOAD_FILTER_MAX_LEN 64
+
+typedef enum {
+	EP_PAYLOAD_FILTER_KIND_UNSIGNED,
+	EP_PAYLOAD_FILTER_KIND_SIGNED,
+	EP_PAYLOAD_FILTER_KIND_FLOAT
+} EventPipePayloadFilterKind;
+
+typedef enum {
+	EP_PAYLOAD_FILTER_OP_EQ,
+	EP_PAYLOAD_FILTER_OP_NE,
+	EP_PAYLOAD_FILTER_OP_LT,
+	EP_PAYLOAD_FILTER_OP_LE,
+	EP_PAYLOAD_FILTER_OP_GT,
+	EP_PAYLOAD_FILTER_OP_GE
+} EventPipePayloadFilterOp;
+
+struct _EventPipeSessionPayloadFilter {
+	ep_char8_t *provider_name;
+	uint32_t event_id;
+	uint32_t offset;
+	uint32_t size;
+	EventPipePayloadFilterKind kind;
+	EventPipePayloadFilterOp op;
+	union {
+		uint64_t u;
+		int64_t i;
+		double f;
+	} value;
+};
+
+static
+bool
+session_parse_payload_filter (
+	const ep_char8_t *provider_name,
+	const ep_char8_t *predicate,
+	EventPipeSessionPayloadFilter *filter)
+{
+	EP_ASSERT (predicate != NULL);
+
+	ep_char8_t *end = NULL;
+	uint64_t event_id = strtoull (predicate, &end, 10);
+	if (end == predicate || *end != ':' || event_id > UINT32_MAX)
+		return false;
+
+	const ep_char8_t *current = end + 1;
+	uint64_t offset = strtoull (current, &end, 10);
+	if (end == current || *end != ':' || offset > UINT32_MAX)
+		return false;
+
+	current = end + 1;
+	EventPipePayloadFilterKind kind;
+	switch (*current) {
+	case 'u':
+		kind = EP_PAYLOAD_FILTER_KIND_UNSIGNED;
+		break;
+	case 'i':
+		kind = EP_PAYLOAD_FILTER_KIND_SIGNED;
+		break;
+	case 'f':
+		kind = EP_PAYLOAD_FILTER_KIND_FLOAT;
+		break;
+	default:
+		return false;
+	}
+
+	current++;
+	uint32_t size;
+	switch (*current) {
+	case '1':
+		size = 1;
+		break;
+	case '2':
+		size = 2;
+		break;
+	case '4':
+		size = 4;
+		break;
+	case '8':
+		size = 8;
+		break;
+	default:
+		return false;
+	}
+
+	if (kind == EP_PAYLOAD_FILTER_KIND_FLOAT && size != 4 && size != 8)
+		return false;
+
+	current++;
+	EventPipePayloadFilterOp op;
+	if (current [0] == '=' && current [1] == '=') {
+		op = EP_PAYLOAD_FILTER_OP_EQ;
+		current += 2;
+	} else if (current [0] == '!' && current [1] == '=') {
+		op = EP_PAYLOAD_FILTER_OP_NE;
+		current += 2;
+	} else if (current [0] == '<' && current [1] == '=') {
+		op = EP_PAYLOAD_FILTER_OP_LE;
+		current += 2;
+	} else if (current [0] == '>' && current [1] == '=') {
+		op = EP_PAYLOAD_FILTER_OP_GE;
+		current += 2;
+	} else if (current [0] == '<') {
+		op = EP_PAYLOAD_FILTER_OP_LT;
+		current++;
+	} else if (current [0] == '>') {
+		op = EP_PAYLOAD_FILTER_OP_GT;
+		current++;
+	} else {
+		return false;
+	}
+
+	if (*current == '\0')
+		return false;
+
+	uint64_t unsigned_value = 0;
+	int64_t signed_value = 0;
+	double float_value = 0;
+	switch (kind) {
+	case EP_PAYLOAD_FILTER_KIND_UNSIGNED:
+		unsigned_value = (uint64_t)strtoull (current, &end, 0);
+		break;
+	case EP_PAYLOAD_FILTER_KIND_SIGNED:
+		signed_value = (int64_t)strtoll (current, &end, 0);
+		break;
+	case EP_PAYLOAD_FILTER_KIND_FLOAT:
+		float_value = strtod (current, &end);
+		break;
+	}
+
+	if (end == current || *end != '\0')
+		return false;
+
+	if (filter) {
+		filter->provider_name = ep_rt_utf8_string_dup (provider_name);
+		if (!filter->provider_name)
+			return false;
+
+		if (kind == EP_PAYLOAD_FILTER_KIND_UNSIGNED)
+			filter->value.u = unsigned_value;
+		else if (kind == EP_PAYLOAD_FILTER_KIND_SIGNED)
+			filter->value.i = signed_value;
+		else
+			filter->value.f = float_value;
+
+		filter->event_id = (uint32_t)event_id;
+		filter->offset = (uint32_t)offset;
+		filter->size = size;
+		filter->kind = kind;
+		filter->op = op;
+	}
+
+	return true;
+}
+
+static
+bool
+session_parse_payload_filters (
+	const ep_char8_t *provider_name,
+	const ep_char8_t *filter_data,
+	EventPipeSessionPayloadFilter *filters,
+	uint32_t *filters_len)
+{
+	EP_ASSERT (filters_len != NULL);
+
+	if (!provider_name || !filter_data)
+		return true;
+
+	// Filter data is a list of key=value pairs separated by ';', values can be quoted to contain '=' and ';'.
+	const ep_char8_t *current = filter_data;
+	while (*current != '\0') {
+		const ep_char8_t *key = current;
+		while (*current != '\0' && *current != '=' && *current != ';')
+			current++;
+
+		size_t key_len = (size_t)(current - key);
+		const ep_char8_t *value = NULL;
+		size_t value_len = 0;
+
+		if (*current == '=') {
+			current++;
+			if (*current == '"') {
+				value = ++current;
+				while (*current != '\0' && *current != '"')
+					current++;
+				value_len = (size_t)(current - value);
+			} else {
+				value = current;
+			}
+
+			while (*current != '\0' && *current != ';')
+				current++;
+
+			if (value_len == 0)
+				value_len = (size_t)(current - value);
+		}
+
+		if (*current == ';')
+			current++;
+
+		if (value == NULL || key_len != strlen (EP_SESSION_PAYLOAD_FILTER_KEY) || strncmp (key, EP_SESSION_PAYLOAD_FILTER_KEY, key_len) != 0)
+			continue;
+
+		const ep_char8_t *value_end = value + value_len;
+		while (value < value_end) {
+			const ep_char8_t *predicate_end = value;
+			while (predicate_end < value_end && *predicate_end != ',')
+				predicate_end++;
+
+			size_t predicate_len = (size_t)(predicate_end - value);
+			if (predicate_len == 0 || predicate_len >= EP_SESSION_PAYLOAD_FILTER_MAX_LEN)
+				return false;
+
+			ep_char8_t predicate [EP_SESSION_PAYLOAD_FILTER_MAX_LEN];
+			memcpy (predicate, value, predicate_len);
+			predicate [predicate_len] = '\0';
+
+			if (!session_parse_payload_filter (provider_name, predicate, filters ? &filters [*filters_len] : NULL))
+				return false;
+
+			(*filters_len)++;
+			value = predicate_end < value_end ? predicate_end + 1 : predicate_end;
+		}
+	}
+
+	return true;
+}
+
+static
+bool
+session_alloc_payload_filters (
+	EventPipeSession *session,
+	const EventPipeProviderConfiguration *providers,
+	uint32_t providers_len)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->payload_filters == NULL);
+
+	ep_requires_lock_held ();
+
+	// First pass validates the predicates and counts them, second pass fills in the filters.
+	uint32_t filters_len = 0;
+	for (uint32_t i = 0; i < providers_len; ++i) {
+		if (!session_parse_payload_filters (ep_provider_config_get_provider_name (&providers [i]), ep_provider_config_get_filter_data (&providers [i]), NULL, &filters_len))
+			return false;
+	}
+
+	if (filters_len == 0)
+		return true;
+
+	session->payload_filters = ep_rt_object_array_alloc (EventPipeSessionPayloadFilter, filters_len);
+	ep_return_false_if_nok (session->payload_filters != NULL);
+
+	for (uint32_t i = 0; i < providers_len; ++i) {
+		if (!session_parse_payload_filters (ep_provider_config_get_provider_name (&providers [i]), ep_provider_config_get_filter_data (&providers [i]), session->payload_filters, &session->payload_filters_len))
+			return false;
+	}
+
+	EP_ASSERT (session->payload_filters_len == filters_len);
+	return true;
+}
+
+static
+void
+session_free_payload_filters (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+
+	for (uint32_t i = 0; i < session->payload_filters_len; ++i)
+		ep_rt_utf8_string_free (session->payload_filters [i].provider_name);
+
+	ep_rt_object_array_free (session->payload_filters);
+	session->payload_filters = NULL;
+	session->payload_filters_len = 0;
+}
+
+static
+bool
+session_payload_filter_match (
+	const EventPipeSessionPayloadFilter *filter,
+	const EventPipeEventPayload *payload)
+{
+	EP_ASSERT (filter != NULL);
+	EP_ASSERT (payload != NULL);
+
+	// An event too small to contain the field does not match.
+	uint8_t bytes [8];
+	if (!ep_event_payload_try_copy_range (payload, filter->offset, bytes, filter->size))
+		return false;
+
+	int32_t compare = 0;
+	switch (filter->kind) {
+	case EP_PAYLOAD_FILTER_KIND_UNSIGNED:
+	{
+		uint64_t value = 0;
+		switch (filter->size) {
+		case 1: { value = bytes [0]; break; }
+		case 2: { uint16_t v; memcpy (&v, bytes, sizeof (v)); value = ep_rt_val_uint16_t (v); break; }
+		case 4: { uint32_t v; memcpy (&v, bytes, sizeof (v)); value = ep_rt_val_uint32_t (v); break; }
+		default: { uint64_t v; memcpy (&v, bytes, sizeof (v)); value = ep_rt_val_uint64_t (v); break; }
+		}
+		compare = (value < filter->value.u) ? -1 : (value > filter->value.u) ? 1 : 0;
+		break;
+	}
+	case EP_PAYLOAD_FILTER_KIND_SIGNED:
+	{
+		int64_t value = 0;
+		switch (filter->size) {
+		case 1: { value = (int8_t)bytes [0]; break; }
+		case 2: { int16_t v; memcpy (&v, bytes, sizeof (v)); value = ep_rt_val_int16_t (v); break; }
+		case 4: { int32_t v; memcpy (&v, bytes, sizeof (v)); value = ep_rt_val_int32_t (v); break; }
+		default: { int64_t v; memcpy (&v, bytes, sizeof (v)); value = ep_rt_val_int64_t (v); break; }
+		}
+		compare = (value < filter->value.i) ? -1 : (value > filter->value.i) ? 1 : 0;
+		break;
+	}
+	case EP_PAYLOAD_FILTER_KIND_FLOAT:
+	{
+		double value;
+		if (filter->size == 4) {
+			uint32_t v;
+			float f;
+			memcpy (&v, bytes, sizeof (v));
+			v = ep_rt_val_uint32_t (v);
+			memcpy (&f, &v, sizeof (f));
+			value = f;
+		} else {
+			uint64_t v;
+			memcpy (&v, bytes, sizeof (v));
+			v = ep_rt_val_uint64_t (v);
+			memcpy (&value, &v, sizeof (value));
+		}
+
+		// NaN only satisfies !=.
+		if (value != value || filter->value.f != filter->value.f)
+			return filter->op == EP_PAYLOAD_FILTER_OP_NE;
+
+		compare = (value < filter->value.f) ? -1 : (value > filter->value.f) ? 1 : 0;
+		break;
+	}
+	}
+
+	switch (filter->op) {
+	case EP_PAYLOAD_FILTER_OP_EQ:
+		return compare == 0;
+	case EP_PAYLOAD_FILTER_OP_NE:
+		return compare != 0;
+	case EP_PAYLOAD_FILTER_OP_LT:
+		return compare < 0;
+	case EP_PAYLOAD_FILTER_OP_LE:
+		return compare <= 0;
+	case EP_PAYLOAD_FILTER_OP_GT:
+		return compare > 0;
+	case EP_PAYLOAD_FILTER_OP_GE:
+		return compare >= 0;
+	}
+
+	return false;
+}
+
+static
+bool
+session_payload_filters_match (
+	const EventPipeSession *session,
+	const EventPipeEvent *ep_event,
+	const EventPipeEventPayload *payload)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (ep_event != NULL);
+
+	if (payload == NULL)
+		return true;
+
+	uint32_t event_id = ep_event_get_event_id (ep_event);
+	const ep_char8_t *provider_name = NULL;
+
+	for (uint32_t i = 0; i < session->payload_filters_len; ++i) {
+		const EventPipeSessionPayloadFilter *filter = &session->payload_filters [i];
+		if (filter->event_id != event_id)
+			continue;
+
+		if (provider_name == NULL)
+			provider_name = ep_provider_get_provider_name (ep_event_get_provider (ep_event));
+
+		if (ep_rt_utf8_string_compare (filter->provider_name, provider_name) != 0)
+			continue;
+
+		if (!session_payload_filter_match (filter, payload))
+			return false;
+	}
+
+	return true;
+}
+
 /*
  * EventPipeSession.
  */
@@ -154,6 +605,70 @@ session_disable_streaming_thread (EventPipeSession *session)
 	ep_rt_wait_event_free (rt_thread_shutdown_event);
 }
 
+// Closes the current file and continues the session in a new one, named by inserting the file number
+// before the .nettrace extension. Every file gets its own header, metadata and stacks, so each one can
+// be read on its own. If the new file can't be created the session keeps writing to the current file.
+static
+void
+session_rotate_file (EventPipeSession *session)
+{
+	EP_ASSERT (session != NULL);
+	EP_ASSERT (session->rotation_output_path != NULL);
+
+	const ep_char8_t extension[] = ".nettrace";
+	const size_t extension_len = STRING_LENGTH (extension);
+
+	const ep_char8_t *output_path = session->rotation_output_path;
+	size_t output_path_len = strlen (output_path);
+	size_t base_len = output_path_len;
+	if (output_path_len >= extension_len && ep_rt_utf8_string_compare (output_path + output_path_len - extension_len, extension) == 0)
+		base_len -= extension_len;
+
+	FileStreamWriter *file_stream_writer = NULL;
+	EventPipeFile *file = NULL;
+	EventPipeFile *previous_file = NULL;
+
+	// Room for the separator, the file number and the terminator.
+	size_t file_path_len = output_path_len + 12;
+	ep_char8_t *file_path = ep_rt_utf8_string_alloc (file_path_len);
+	ep_raise_error_if_nok (file_path != NULL);
+
+	ep_rt_utf8_string_snprintf (file_path, file_path_len, "%.*s.%u%s", (int)base_len, output_path, session->rotation_file_count + 1, output_path + base_len);
+
+	file_stream_writer = ep_file_stream_writer_alloc (file_path);
+	ep_raise_error_if_nok (file_stream_writer != NULL);
+
+	file = ep_file_alloc (ep_file_stream_writer_get_stream_writer_ref (file_stream_writer), session->format);
+	ep_raise_error_if_nok (file != NULL);
+	file_stream_writer = NULL;
+
+	ep_raise_error_if_nok (ep_file_initialize_file (file) && !ep_file_has_errors (file));
+
+	previous_file = session->file;
+	session->file = file;
+	session->rotation_file_count++;
+	file = NULL;
+
+	// Carry the per-thread sequence numbers over so readers of the new file don't report dropped events.
+	ep_session_write_sequence_point_unbuffered (session);
+
+	// Writes the end of stream tag and closes the previous file.
+	ep_file_free (previous_file);
+
+ep_on_exit:
+	ep_rt_utf8_string_free (file_path);
+	return;
+
+ep_on_error:
+	ep_file_free (file);
+	ep_file_stream_writer_free (file_stream_writer);
+
+	// Don't retry on every streaming iteration, keep appending to the current file instead.
+	ep_rt_utf8_string_free (session->rotation_output_path);
+	session->rotation_output_path = NULL;
+	ep_exit_error_handler ();
+}
+
 EventPipeSession *
 ep_session_alloc (
 	uint32_t index,
@@ -188,6 +703,8 @@ ep_session_alloc (
 	instance->providers = ep_session_provider_list_alloc (providers, providers_len);
 	ep_raise_error_if_nok (instance->providers != NULL);
 
+	ep_raise_error_if_nok (session_alloc_payload_filters (instance, providers, providers_len));
+
 	instance->index = index;
 	instance->rundown_enabled = 0;
 	instance->session_type = session_type;
@@ -219,6 +736,14 @@ ep_session_alloc (
 			instance->file = ep_file_alloc (ep_file_stream_writer_get_stream_writer_ref (file_stream_writer), format);
 			ep_raise_error_if_nok (instance->file != NULL);
 			file_stream_writer = NULL;
+
+			// Only the streaming thread can switch files while the session is running.
+			uint32_t file_size_mb = session_type == EP_SESSION_TYPE_FILESTREAM ? ep_rt_config_value_get_output_file_size_mb () : 0;
+			if (file_size_mb > 0) {
+				instance->rotation_output_path = ep_rt_utf8_string_dup (output_path);
+				ep_raise_error_if_nok (instance->rotation_output_path != NULL);
+				instance->rotation_file_size = ((uint64_t)file_size_mb) << 20;
+			}
 		}
 		break;
 
@@ -305,9 +830,11 @@ ep_session_free (EventPipeSession *session)
 	ep_rt_wait_event_free (&session->rt_thread_shutdown_event);
 
 	ep_session_provider_list_free (session->providers);
+	session_free_payload_filters (session);
 
 	ep_buffer_manager_free (session->buffer_manager);
 	ep_file_free (session->file);
+	ep_rt_utf8_string_free (session->rotation_output_path);
 
 	ep_session_remove_dangling_session_states (session);
 
@@ -508,7 +1035,14 @@ ep_session_write_all_buffers_to_file (EventPipeSession *session, bool *events_wr
 	// the current timestamp are written into the file.
 	ep_timestamp_t stop_timestamp = ep_perf_timestamp_get ();
 	ep_buffer_manager_write_all_buffers_to_file (session->buffer_manager, session->file, stop_timestamp, events_written);
-	return !ep_file_has_errors (session->file);
+	if (ep_file_has_errors (session->file))
+		return false;
+
+	if (session->rotation_output_path != NULL && ep_session_get_streaming_enabled (session) &&
+		ep_fast_serializer_get_bytes_written (ep_file_get_fast_serializer (session->file)) >= session->rotation_file_size)
+		session_rotate_file (session);
+
+	return true;
 }
 
 bool
@@ -532,6 +1066,10 @@ ep_session_write_event (
 
 	// Filter events specific to "this" session based on precomputed flag on provider/events.
 	if (ep_event_is_enabled_by_mask (ep_event, ep_session_get_mask (session))) {
+		// Evaluated before the event is serialized so that filtered events never take up buffer space.
+		if (session->payload_filters_len != 0 && !session_payload_filters_match (session, ep_event, payload))
+			return false;
+
 		if (session->synchronous_callback) {
 			session->synchronous_callback (
 				ep_event_get_provider (ep_event),
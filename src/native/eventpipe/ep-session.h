@@ -67,6 +67,15 @@ struct _EventPipeSession_Internal {
 	bool enable_stackwalk;
 	// Indicate that session is fully running (streaming thread started).
 	volatile uint32_t started;
+	// Payload predicates parsed from the providers' filter data, immutable for the lifetime of the session.
+	EventPipeSessionPayloadFilter *payload_filters;
+	uint32_t payload_filters_len;
+	// For file stream sessions, the output path used to name rotated files, or NULL when rotation is disabled.
+	ep_char8_t *rotation_output_path;
+	// Size in bytes at which the streaming thread switches to a new file.
+	uint64_t rotation_file_size;
+	// Number of files started by rotation so far.
+	uint32_t rotation_file_count;
 };
 
 #if !defined(EP_INLINE_GETTER_SETTER) && !defined(EP_IMPL_SESSION_GETTER_SETTER)
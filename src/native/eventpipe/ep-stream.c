@@ -172,6 +172,7 @@ ep_fast_serializer_alloc (StreamWriter *stream_writer)
 
 	// Ownership transferred.
 	instance->stream_writer = stream_writer;
+	instance->bytes_written = 0;
 	instance->required_padding = 0;
 	instance->write_error_encountered = false;
 
@@ -211,6 +212,7 @@ ep_fast_serializer_write_buffer (
 
 	uint32_t bytes_written = 0;
 	bool result = ep_stream_writer_write (fast_serializer->stream_writer, buffer, buffer_len, &bytes_written);
+	fast_serializer->bytes_written += bytes_written;
 
 	uint32_t required_padding = fast_serializer->required_padding;
 	required_padding = (FAST_SERIALIZER_ALIGNMENT_SIZE + required_padding - (bytes_written % FAST_SERIALIZER_ALIGNMENT_SIZE)) % FAST_SERIALIZER_ALIGNMENT_SIZE;
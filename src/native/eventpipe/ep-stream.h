@@ -161,6 +161,8 @@ struct _FastSerializer {
 struct _FastSerializer_Internal {
 #endif
 	StreamWriter *stream_writer;
+	// Total number of bytes written through the serializer.
+	uint64_t bytes_written;
 	uint32_t required_padding;
 	bool write_error_encountered;
 };
@@ -172,6 +174,7 @@ struct _FastSerializer {
 #endif
 
 EP_DEFINE_GETTER(FastSerializer *, fast_serializer, StreamWriter *, stream_writer)
+EP_DEFINE_GETTER(FastSerializer *, fast_serializer, uint64_t, bytes_written)
 EP_DEFINE_GETTER(FastSerializer *, fast_serializer, uint32_t, required_padding)
 EP_DEFINE_GETTER(FastSerializer *, fast_serializer, bool, write_error_encountered)
 
@@ -33,6 +33,7 @@ typedef struct _EventPipeProviderCallbackDataQueue EventPipeProviderCallbackData
 typedef struct _EventPipeProviderConfiguration EventPipeProviderConfiguration;
 typedef struct _EventPipeExecutionCheckpoint EventPipeExecutionCheckpoint;
 typedef struct _EventPipeSession EventPipeSession;
+typedef struct _EventPipeSessionPayloadFilter EventPipeSessionPayloadFilter;
 typedef struct _EventPipeSessionProvider EventPipeSessionProvider;
 typedef struct _EventPipeSessionProviderList EventPipeSessionProviderList;
 typedef struct _EventPipeSequencePoint EventPipeSequencePoint;
@@ -1339,3 +1339,59 @@ int32_t GlobalizationNative_GetSortKey(
 
     return result;
 }
+
+/*
+Function:
+GetSortKeys
+
+Writes the sort keys of count strings back to back into sortKeys, using a single collator lookup,
+and stores the length of each key in cbSortKeyLengths. Stops at the first key that does not fit.
+
+Returns the number of sort keys written. When not even the first key fits, cbSortKeyLengths[0]
+receives the length it needs.
+*/
+int32_t GlobalizationNative_GetSortKeys(
+                        SortHandle* pSortHandle,
+                        const UChar** lpStrs,
+                        const int32_t* cwStrLengths,
+                        int32_t count,
+                        uint8_t* sortKeys,
+                        int32_t cbSortKeysLength,
+                        int32_t* cbSortKeyLengths,
+                        int32_t options)
+{
+    assert(lpStrs != NULL || count == 0);
+    assert(cwStrLengths != NULL || count == 0);
+    assert(cbSortKeyLengths != NULL || count == 0);
+
+    UErrorCode err = U_ZERO_ERROR;
+    const UCollator* pColl = GetCollatorFromSortHandle(pSortHandle, options, &err);
+
+    if (!U_SUCCESS(err))
+    {
+        return 0;
+    }
+
+    int32_t offset = 0;
+    int32_t i;
+    for (i = 0; i < count; i++)
+    {
+        uint8_t* sortKey = sortKeys != NULL ? sortKeys + offset : NULL;
+        int32_t length = ucol_getSortKey(pColl, lpStrs[i], cwStrLengths[i], sortKey, cbSortKeysLength - offset);
+
+        if (length == 0 || length > cbSortKeysLength - offset)
+        {
+            if (i == 0)
+            {
+                cbSortKeyLengths[0] = length;
+            }
+
+            break;
+        }
+
+        cbSortKeyLengths[i] = length;
+        offset += length;
+    }
+
+    return i;
+}
@@ -65,6 +65,15 @@ PALEXPORT int32_t GlobalizationNative_GetSortKey(SortHandle* pSortHandle,
                                                  uint8_t* sortKey,
                                                  int32_t cbSortKeyLength,
                                                  int32_t options);
+
+PALEXPORT int32_t GlobalizationNative_GetSortKeys(SortHandle* pSortHandle,
+                                                  const UChar** lpStrs,
+                                                  const int32_t* cwStrLengths,
+                                                  int32_t count,
+                                                  uint8_t* sortKeys,
+                                                  int32_t cbSortKeysLength,
+                                                  int32_t* cbSortKeyLengths,
+                                                  int32_t options);
 #if defined(APPLE_HYBRID_GLOBALIZATION)
 PALEXPORT int32_t GlobalizationNative_CompareStringNative(const uint16_t* localeName,
                                                           int32_t lNameLength,
@@ -2,10 +2,12 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 //
 
+#include <assert.h>
 #include <stdint.h>
 
 #include "pal_icushim_internal.h"
 #include "pal_idna.h"
+#include "pal_atomic.h"
 
 #if defined(TARGET_WINDOWS)
 // Windows icu headers doesn't define this member as it is marked as deprecated as of ICU 55.
@@ -43,6 +45,38 @@ static uint32_t GetOptions(uint32_t flags, uint32_t useToAsciiFlags)
     return options;
 }
 
+// UTS #46 instances are immutable and can be shared between threads, so one is kept for every
+// combination of the AllowUnassigned and UseStd3AsciiRules flags and the conversion direction
+// instead of opening and closing one on every call.
+static UIDNA* volatile s_idnaPerOptions[8];
+
+static const UIDNA* GetIdna(uint32_t flags, uint32_t useToAsciiFlags, UErrorCode* pErr)
+{
+    uint32_t index = ((flags & (AllowUnassigned | UseStd3AsciiRules)) << 1) | (useToAsciiFlags ? 1 : 0);
+
+    UIDNA* pIdna = s_idnaPerOptions[index];
+    if (pIdna != NULL)
+    {
+        return pIdna;
+    }
+
+    pIdna = uidna_openUTS46(GetOptions(flags, useToAsciiFlags), pErr);
+    if (U_FAILURE(*pErr))
+    {
+        return NULL;
+    }
+
+    UIDNA* pNull = NULL;
+    if (!pal_atomic_cas_ptr((void* volatile*)&s_idnaPerOptions[index], pIdna, pNull))
+    {
+        uidna_close(pIdna);
+        pIdna = s_idnaPerOptions[index];
+        assert(pIdna != NULL && "pIdna not expected to be null here.");
+    }
+
+    return pIdna;
+}
+
 /*
 Function:
 ToASCII
@@ -60,15 +94,13 @@ int32_t GlobalizationNative_ToAscii(
     UErrorCode err = U_ZERO_ERROR;
     UIDNAInfo info = UIDNA_INFO_INITIALIZER;
 
-    UIDNA* pIdna = uidna_openUTS46(GetOptions(flags, /* useToAsciiFlags */ 1), &err);
+    const UIDNA* pIdna = GetIdna(flags, /* useToAsciiFlags */ 1, &err);
 
     int32_t asciiStrLen = uidna_nameToASCII(pIdna, lpSrc, cwSrcLength, lpDst, cwDstLength, &info, &err);
 
     // To have a consistent behavior with Windows, we mask out the error when having 2 hyphens in the third and fourth place.
     info.errors &= (uint32_t)~UIDNA_ERROR_HYPHEN_3_4;
 
-    uidna_close(pIdna);
-
     return ((U_SUCCESS(err) || (err == U_BUFFER_OVERFLOW_ERROR)) && (info.errors == 0)) ? asciiStrLen : 0;
 }
 
@@ -89,11 +121,9 @@ int32_t GlobalizationNative_ToUnicode(
     UErrorCode err = U_ZERO_ERROR;
     UIDNAInfo info = UIDNA_INFO_INITIALIZER;
 
-    UIDNA* pIdna = uidna_openUTS46(GetOptions(flags, /* useToAsciiFlags */ 0), &err);
+    const UIDNA* pIdna = GetIdna(flags, /* useToAsciiFlags */ 0, &err);
 
     int32_t unicodeStrLen = uidna_nameToUnicode(pIdna, lpSrc, cwSrcLength, lpDst, cwDstLength, &info, &err);
 
-    uidna_close(pIdna);
-
     return ((U_SUCCESS(err) || (err == U_BUFFER_OVERFLOW_ERROR)) && (info.errors == 0)) ? unicodeStrLen : 0;
 }
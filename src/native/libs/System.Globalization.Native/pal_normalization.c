@@ -4,6 +4,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "pal_icushim_internal.h"
 #include "pal_normalization.h"
@@ -26,6 +27,18 @@ static const UNormalizer2* GetNormalizerForForm(NormalizationForm normalizationF
     }
 }
 
+// ASCII text is unchanged by all of the normalization forms, so it doesn't need to go through ICU.
+static bool IsAscii(const UChar* lpStr, int32_t cwStrLength)
+{
+    uint32_t mask = 0;
+    for (int32_t i = 0; i < cwStrLength; i++)
+    {
+        mask |= lpStr[i];
+    }
+
+    return mask < 0x80;
+}
+
 /*
 Function:
 IsNormalized
@@ -44,6 +57,12 @@ int32_t GlobalizationNative_IsNormalized(
 {
     UErrorCode err = U_ZERO_ERROR;
     const UNormalizer2* pNormalizer = GetNormalizerForForm(normalizationForm, &err);
+
+    if (U_SUCCESS(err) && cwStrLength >= 0 && IsAscii(lpStr, cwStrLength))
+    {
+        return 1;
+    }
+
     UBool isNormalized = unorm2_isNormalized(pNormalizer, lpStr, cwStrLength, &err);
 
     if (U_SUCCESS(err))
@@ -73,6 +92,18 @@ int32_t GlobalizationNative_NormalizeString(
 {
     UErrorCode err = U_ZERO_ERROR;
     const UNormalizer2* pNormalizer = GetNormalizerForForm(normalizationForm, &err);
+
+    if (U_SUCCESS(err) && cwSrcLength >= 0 && IsAscii(lpSrc, cwSrcLength))
+    {
+        // Like ICU, report the required length when the destination is too small
+        if (cwSrcLength <= cwDstLength)
+        {
+            memcpy(lpDst, lpSrc, (size_t)cwSrcLength * sizeof(UChar));
+        }
+
+        return cwSrcLength;
+    }
+
     int32_t normalizedLen = unorm2_normalize(pNormalizer, lpSrc, cwSrcLength, lpDst, cwDstLength, &err);
 
     return (U_SUCCESS(err) || (err == U_BUFFER_OVERFLOW_ERROR)) ? normalizedLen : 0;
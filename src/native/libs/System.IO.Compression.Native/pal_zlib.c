@@ -14,6 +14,7 @@
 #include <zlib.h>
 
 c_static_assert(PAL_Z_NOFLUSH == Z_NO_FLUSH);
+c_static_assert(PAL_Z_SYNCFLUSH == Z_SYNC_FLUSH);
 c_static_assert(PAL_Z_FINISH == Z_FINISH);
 
 c_static_assert(PAL_Z_OK == Z_OK);
@@ -144,6 +145,18 @@ int32_t CompressionNative_DeflateEnd(PAL_ZStream* stream)
     return result;
 }
 
+int32_t CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictionaryLength)
+{
+    assert(stream != NULL);
+    assert(dictionary != NULL || dictionaryLength == 0);
+
+    z_stream* zStream = GetCurrentZStream(stream);
+    int32_t result = deflateSetDictionary(zStream, dictionary, dictionaryLength);
+    TransferStateToPalZStream(zStream, stream);
+
+    return result;
+}
+
 int32_t CompressionNative_InflateInit2_(PAL_ZStream* stream, int32_t windowBits)
 {
     assert(stream != NULL);
@@ -189,3 +202,12 @@ uint32_t CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len)
     assert(result <= UINT32_MAX);
     return (uint32_t)result;
 }
+
+uint32_t CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2)
+{
+    assert(len2 >= 0);
+
+    unsigned long result = crc32_combine(crc1, crc2, (z_off64_t)len2);
+    assert(result <= UINT32_MAX);
+    return (uint32_t)result;
+}
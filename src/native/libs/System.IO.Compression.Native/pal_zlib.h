@@ -36,6 +36,7 @@ Allowed flush values for the Deflate and Inflate functions.
 enum PAL_FlushCode
 {
     PAL_Z_NOFLUSH = 0,
+    PAL_Z_SYNCFLUSH = 2,
     PAL_Z_FINISH = 4,
 };
 
@@ -102,6 +103,17 @@ Returns a PAL_ErrorCode indicating success or an error number on failure.
 */
 FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateEnd(PAL_ZStream* stream);
 
+/*
+Initializes the compression dictionary of a raw deflate stream before the first call to Deflate.
+
+Used to compress independent blocks of one large stream in parallel: each block is primed with
+the last 32K of input of the block before it and flushed with PAL_Z_SYNCFLUSH (PAL_Z_FINISH for
+the last block), so that the concatenated outputs form a single valid deflate stream.
+
+Returns a PAL_ErrorCode indicating success or an error number on failure.
+*/
+FUNCTIONEXPORT int32_t FUNCTIONCALLINGCONVENTION CompressionNative_DeflateSetDictionary(PAL_ZStream* stream, uint8_t* dictionary, uint32_t dictionaryLength);
+
 /*
 Initializes the PAL_ZStream so the Inflate function can be invoked on it.
 
@@ -131,3 +143,11 @@ updated CRC-32.
 Returns the updated CRC-32.
 */
 FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Crc32(uint32_t crc, uint8_t* buffer, int32_t len);
+
+/*
+Combine the CRC-32 crc1 of a first sequence of bytes with the CRC-32 crc2 of a second
+sequence of len2 bytes that follows it.
+
+Returns the CRC-32 of the two sequences concatenated.
+*/
+FUNCTIONEXPORT uint32_t FUNCTIONCALLINGCONVENTION CompressionNative_Crc32Combine(uint32_t crc1, uint32_t crc2, int64_t len2);
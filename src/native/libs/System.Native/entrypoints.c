@@ -68,6 +68,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_ShmUnlink)
     DllImportEntry(SystemNative_GetReadDirRBufferSize)
     DllImportEntry(SystemNative_ReadDirR)
+    DllImportEntry(SystemNative_ReadDirEntries)
     DllImportEntry(SystemNative_OpenDir)
     DllImportEntry(SystemNative_CloseDir)
     DllImportEntry(SystemNative_Pipe)
@@ -152,6 +153,7 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetIPv6Address)
     DllImportEntry(SystemNative_GetControlMessageBufferSize)
     DllImportEntry(SystemNative_TryGetIPPacketInformation)
+    DllImportEntry(SystemNative_TryGetUdpGroSegmentSize)
     DllImportEntry(SystemNative_GetIPv4MulticastOption)
     DllImportEntry(SystemNative_SetIPv4MulticastOption)
     DllImportEntry(SystemNative_GetIPv6MulticastOption)
@@ -162,9 +164,11 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_SetSendTimeout)
     DllImportEntry(SystemNative_Receive)
     DllImportEntry(SystemNative_ReceiveMessage)
+    DllImportEntry(SystemNative_ReceiveMessages)
     DllImportEntry(SystemNative_ReceiveSocketError)
     DllImportEntry(SystemNative_Send)
     DllImportEntry(SystemNative_SendMessage)
+    DllImportEntry(SystemNative_SendMessages)
     DllImportEntry(SystemNative_Accept)
     DllImportEntry(SystemNative_Bind)
     DllImportEntry(SystemNative_Connect)
@@ -193,6 +197,9 @@ static const Entry s_sysNative[] =
     DllImportEntry(SystemNative_GetDomainSocketSizes)
     DllImportEntry(SystemNative_GetMaximumAddressSize)
     DllImportEntry(SystemNative_SendFile)
+    DllImportEntry(SystemNative_EnableZeroCopySend)
+    DllImportEntry(SystemNative_ReceiveZeroCopyCompletion)
+    DllImportEntry(SystemNative_Splice)
     DllImportEntry(SystemNative_Disconnect)
     DllImportEntry(SystemNative_InterfaceNameToIndex)
     DllImportEntry(SystemNative_GetTcpGlobalStatistics)
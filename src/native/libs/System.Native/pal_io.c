@@ -102,10 +102,12 @@ extern int     getpeereid(int, uid_t *__restrict__, gid_t *__restrict__);
 #define stat_ stat64
 #define fstat_ fstat64
 #define lstat_ lstat64
+#define fstatat_ fstatat64
 #else /* HAVE_STAT64 */
 #define stat_ stat
 #define fstat_ fstat
 #define lstat_ lstat
+#define fstatat_ fstatat
 #endif  /* HAVE_STAT64 */
 
 // These numeric values are specified by POSIX.
@@ -610,6 +612,108 @@ int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, Dir
     return 0;
 }
 
+// Records are kept 8-byte aligned for the 64-bit members of FileStatus.
+static const size_t directory_record_alignment = 8;
+
+int32_t SystemNative_ReadDirEntries(DIR* dir, uint8_t* buffer, int32_t bufferSize, int32_t flags, int32_t* entryCount)
+{
+    assert(dir != NULL);
+    assert(buffer != NULL);
+    assert(entryCount != NULL);
+    assert(((size_t)buffer & (directory_record_alignment - 1)) == 0);
+
+    *entryCount = 0;
+
+    if ((flags & ~PAL_READDIR_STAT) != 0)
+    {
+        return EINVAL;
+    }
+
+#if HAVE_FSTATAT
+    int dirFd = (flags & PAL_READDIR_STAT) != 0 ? dirfd(dir) : -1;
+    if ((flags & PAL_READDIR_STAT) != 0 && dirFd == -1)
+    {
+        return errno;
+    }
+#endif
+
+    size_t offset = 0;
+    while (true)
+    {
+        // Remember the position so that an entry that does not fit is returned by the next call.
+        // The caller owns the DIR for the duration of the call, so readdir is used rather than readdir_r;
+        // the C library reads the directory in large getdents chunks underneath.
+        long position = telldir(dir);
+
+        errno = 0;
+        struct dirent* entry = readdir(dir);
+        if (entry == NULL)
+        {
+            if (errno != 0)
+            {
+                if (*entryCount == 0)
+                {
+                    return errno;
+                }
+
+                // Report the entries read so far; the next call retries the failed read
+                seekdir(dir, position);
+                return 0;
+            }
+
+            return *entryCount > 0 ? 0 : -1; // shim convention for end-of-stream
+        }
+
+        DirectoryEntry converted;
+        ConvertDirent(entry, &converted);
+        size_t nameLength = converted.NameLength >= 0 ? (size_t)converted.NameLength : strlen(entry->d_name);
+
+        size_t recordLength = sizeof(DirectoryEntryRecord) + nameLength + 1;
+        recordLength = (recordLength + directory_record_alignment - 1) & ~(directory_record_alignment - 1);
+        if (recordLength > (size_t)bufferSize - offset)
+        {
+            if (*entryCount == 0)
+            {
+                return ERANGE;
+            }
+
+            seekdir(dir, position);
+            return 0;
+        }
+
+        DirectoryEntryRecord* record = (DirectoryEntryRecord*)(buffer + offset);
+        memset(record, 0, sizeof(*record));
+        record->RecordLength = (int32_t)recordLength;
+        record->NameLength = (int32_t)nameLength;
+        record->InodeType = converted.InodeType;
+        record->StatusError = -1;
+        memcpy(buffer + offset + sizeof(DirectoryEntryRecord), entry->d_name, nameLength);
+        buffer[offset + sizeof(DirectoryEntryRecord) + nameLength] = '\0';
+
+#if HAVE_FSTATAT
+        if (dirFd != -1)
+        {
+            struct stat_ result;
+            int ret;
+            while ((ret = fstatat_(dirFd, entry->d_name, &result, AT_SYMLINK_NOFOLLOW)) < 0 && errno == EINTR);
+
+            if (ret == 0)
+            {
+                ConvertFileStatus(&result, &record->Status);
+                record->StatusError = 0;
+            }
+            else
+            {
+                record->StatusError = errno;
+            }
+        }
+#endif
+
+        offset += recordLength;
+        (*entryCount)++;
+    }
+}
+
 DIR* SystemNative_OpenDir(const char* path)
 {
     DIR *result;
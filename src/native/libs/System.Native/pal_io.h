@@ -300,6 +300,27 @@ typedef struct
     int32_t InodeType; // The inode type as described in the NodeType enum
 } DirectoryEntry;
 
+/**
+ * Flags for SystemNative_ReadDirEntries.
+ */
+typedef enum
+{
+    PAL_READDIR_STAT = 0x1, // fill in the lstat(2) result of each entry
+} ReadDirEntriesFlags;
+
+/**
+ * Header of each entry written by SystemNative_ReadDirEntries. The header is followed by the
+ * null-terminated name of the entry and padding up to RecordLength.
+ */
+typedef struct
+{
+    int32_t RecordLength; // Offset of the next record from the start of this one
+    int32_t NameLength;   // Length (in chars) of the inode name, excluding the terminating null
+    int32_t InodeType;    // The inode type as described in the NodeType enum
+    int32_t StatusError;  // 0 when Status is valid, the errno of the failed lstat, or -1 if not requested
+    FileStatus Status;
+} DirectoryEntryRecord;
+
 /**
 * Constants passed in the mask argument of INotifyAddWatch which identify inotify events.
 */
@@ -409,6 +430,16 @@ PALEXPORT int32_t SystemNative_GetReadDirRBufferSize(void);
  */
 PALEXPORT int32_t SystemNative_ReadDirR(DIR* dir, uint8_t* buffer, int32_t bufferSize, DirectoryEntry* outputEntry);
 
+/**
+ * Reads as many entries from the directory stream as fit into the 8-byte aligned buffer, as a sequence
+ * of DirectoryEntryRecord. With PAL_READDIR_STAT, each record also holds the lstat(2) result of the entry,
+ * so enumerating a directory with attributes takes one call per buffer rather than several per entry.
+ *
+ * Returns 0 when entries are retrieved; returns -1 when end-of-stream is reached; returns an error code on failure,
+ * including ERANGE when the buffer cannot hold a single entry.
+ */
+PALEXPORT int32_t SystemNative_ReadDirEntries(DIR* dir, uint8_t* buffer, int32_t bufferSize, int32_t flags, int32_t* entryCount);
+
 /**
  * Returns a DIR struct containing info about the current path or NULL on failure; sets errno on fail.
  */
@@ -34,6 +34,9 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#if defined(__linux__)
+#include <netinet/udp.h>
+#endif
 #if HAVE_NET_IF_H
 #include <net/if.h>
 #endif
@@ -1121,6 +1124,33 @@ SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isI
 }
 #endif // !CMSG_SPACE
 
+int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize)
+{
+    if (messageHeader == NULL || segmentSize == NULL)
+    {
+        return 0;
+    }
+
+#if defined(CMSG_SPACE) && defined(UDP_GRO)
+    struct msghdr header;
+    ConvertMessageHeaderToMsghdr(&header, messageHeader, -1);
+
+    for (struct cmsghdr* controlMessage = CMSG_FIRSTHDR(&header); controlMessage != NULL && controlMessage->cmsg_len > 0;
+         controlMessage = GET_CMSG_NXTHDR(&header, controlMessage))
+    {
+        if (controlMessage->cmsg_level == IPPROTO_UDP && controlMessage->cmsg_type == UDP_GRO)
+        {
+            int value;
+            memcpy(&value, CMSG_DATA(controlMessage), sizeof(value));
+            *segmentSize = (int32_t)value;
+            return 1;
+        }
+    }
+#endif
+
+    return 0;
+}
+
 static int8_t GetMulticastOptionName(int32_t multicastOption, int8_t isIPv6, int* optionName)
 {
     switch (multicastOption)
@@ -1426,6 +1456,9 @@ static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFla
 #endif
 #ifdef MSG_CTRUNC
                         | SocketFlags_MSG_CTRUNC
+#endif
+#ifdef MSG_ZEROCOPY
+                        | SocketFlags_MSG_ZEROCOPY
 #endif
                         ;
 
@@ -1455,6 +1488,9 @@ static int8_t ConvertSocketFlagsPalToPlatform(int32_t palFlags, int* platformFla
 #endif
 #ifdef MSG_CTRUNC
                     | ((palFlags & SocketFlags_MSG_CTRUNC) == 0 ? 0 : MSG_CTRUNC)
+#endif
+#ifdef MSG_ZEROCOPY
+                    | ((palFlags & SocketFlags_MSG_ZEROCOPY) == 0 ? 0 : MSG_ZEROCOPY)
 #endif
                     ;
     return true;
@@ -1605,6 +1641,104 @@ int32_t SystemNative_ReceiveMessage(intptr_t socket, MessageHeader* messageHeade
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+// Upper bound on the number of messages handled by one SystemNative_ReceiveMessages or SystemNative_SendMessages
+// call, so that the platform headers can live on the stack.
+#define MAX_MESSAGE_BATCH_SIZE 64
+
+static bool IsValidMessageHeaderBatch(const MessageHeader* messageHeaders, const int32_t* messageLengths, int32_t messageCount)
+{
+    if (messageHeaders == NULL || messageLengths == NULL || messageCount <= 0)
+    {
+        return false;
+    }
+
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        if (messageHeaders[i].SocketAddressLen < 0 || messageHeaders[i].ControlBufferLen < 0 || messageHeaders[i].IOVectorCount < 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* messageLengths, int32_t messageCount, int32_t flags, int32_t* received)
+{
+    if (received == NULL || !IsValidMessageHeaderBatch(messageHeaders, messageLengths, messageCount))
+    {
+        return Error_EFAULT;
+    }
+
+    *received = 0;
+
+#if HAVE_RECVMMSG && defined(CMSG_SPACE)
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+#ifdef MSG_WAITFORONE
+    // Don't wait for the whole batch on a blocking socket, only for the first datagram
+    socketFlags |= MSG_WAITFORONE;
+#endif
+
+    struct mmsghdr headers[MAX_MESSAGE_BATCH_SIZE];
+    int32_t count = Min(messageCount, MAX_MESSAGE_BATCH_SIZE);
+    for (int32_t i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = recvmmsg(fd, headers, (unsigned int)count, socketFlags, NULL)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int32_t i = 0; i < res; i++)
+    {
+        MessageHeader* messageHeader = &messageHeaders[i];
+        struct msghdr* header = &headers[i].msg_hdr;
+
+        assert((int32_t)header->msg_namelen <= messageHeader->SocketAddressLen);
+        messageHeader->SocketAddressLen = Min((int32_t)header->msg_namelen, messageHeader->SocketAddressLen);
+
+        assert(header->msg_controllen <= (size_t)messageHeader->ControlBufferLen);
+        messageHeader->ControlBufferLen = Min((int32_t)header->msg_controllen, messageHeader->ControlBufferLen);
+
+        messageHeader->Flags = ConvertSocketFlagsPlatformToPal(header->msg_flags);
+        messageLengths[i] = (int32_t)headers[i].msg_len;
+    }
+
+    *received = res;
+    return Error_SUCCESS;
+#else // HAVE_RECVMMSG && CMSG_SPACE
+    // Only the first message can block, stop at the first one that is not immediately available
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        int64_t length;
+        int32_t error = SystemNative_ReceiveMessage(socket, &messageHeaders[i], i == 0 ? flags : (flags | SocketFlags_MSG_DONTWAIT), &length);
+        if (error != Error_SUCCESS)
+        {
+            return i == 0 ? error : Error_SUCCESS;
+        }
+
+        messageLengths[i] = (int32_t)length;
+        (*received)++;
+    }
+
+    return Error_SUCCESS;
+#endif // HAVE_RECVMMSG && CMSG_SPACE
+}
+
 int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t bufferLen, int32_t flags, int32_t* sent)
 {
     if (buffer == NULL || bufferLen < 0 || sent == NULL)
@@ -1686,6 +1820,66 @@ int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader,
     return SystemNative_ConvertErrorPlatformToPal(errno);
 }
 
+int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* messageLengths, int32_t messageCount, int32_t flags, int32_t* sent)
+{
+    if (sent == NULL || !IsValidMessageHeaderBatch(messageHeaders, messageLengths, messageCount))
+    {
+        return Error_EFAULT;
+    }
+
+    *sent = 0;
+
+#if HAVE_SENDMMSG && defined(CMSG_SPACE)
+    int fd = ToFileDescriptor(socket);
+
+    int socketFlags;
+    if (!ConvertSocketFlagsPalToPlatform(flags, &socketFlags))
+    {
+        return Error_ENOTSUP;
+    }
+
+    struct mmsghdr headers[MAX_MESSAGE_BATCH_SIZE];
+    int32_t count = Min(messageCount, MAX_MESSAGE_BATCH_SIZE);
+    for (int32_t i = 0; i < count; i++)
+    {
+        ConvertMessageHeaderToMsghdr(&headers[i].msg_hdr, &messageHeaders[i], fd);
+        headers[i].msg_len = 0;
+    }
+
+    int res;
+    while ((res = sendmmsg(fd, headers, (unsigned int)count, socketFlags)) < 0 && errno == EINTR);
+
+    if (res < 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    for (int32_t i = 0; i < res; i++)
+    {
+        messageLengths[i] = (int32_t)headers[i].msg_len;
+    }
+
+    *sent = res;
+    return Error_SUCCESS;
+#else // HAVE_SENDMMSG && CMSG_SPACE
+    for (int32_t i = 0; i < messageCount; i++)
+    {
+        int64_t length;
+        int32_t error = SystemNative_SendMessage(socket, &messageHeaders[i], flags, &length);
+        if (error != Error_SUCCESS)
+        {
+            return i == 0 ? error : Error_SUCCESS;
+        }
+
+        messageLengths[i] = (int32_t)length;
+        (*sent)++;
+    }
+
+    return Error_SUCCESS;
+#endif // HAVE_SENDMMSG && CMSG_SPACE
+}
+
 int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket)
 {
     if (socketAddress == NULL || socketAddressLen == NULL || acceptedSocket == NULL || *socketAddressLen < 0)
@@ -2174,6 +2368,18 @@ static bool TryGetPlatformSocketOption(int32_t socketOptionLevel, int32_t socket
             {
                 // case SocketOptionName_SO_UDP_NOCHECKSUM:
 
+#ifdef UDP_SEGMENT
+                case SocketOptionName_SO_UDP_SEGMENT:
+                    *optName = UDP_SEGMENT;
+                    return true;
+#endif
+
+#ifdef UDP_GRO
+                case SocketOptionName_SO_UDP_GRO:
+                    *optName = UDP_GRO;
+                    return true;
+#endif
+
                 // case SocketOptionName_SO_UDP_CHECKSUM_COVERAGE:
 
                 // case SocketOptionName_SO_UDP_UPDATEACCEPTCONTEXT:
@@ -3680,6 +3886,106 @@ error:
 #endif
 }
 
+int32_t SystemNative_EnableZeroCopySend(intptr_t socket)
+{
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+    int value = 1;
+    if (setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &value, sizeof(value)) != 0)
+    {
+        return SystemNative_ConvertErrorPlatformToPal(errno);
+    }
+
+    return Error_SUCCESS;
+#else
+    (void)socket;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* firstSend, uint32_t* lastSend, int32_t* copied)
+{
+    assert(firstSend != NULL);
+    assert(lastSend != NULL);
+    assert(copied != NULL);
+
+#if HAVE_LINUX_ERRQUEUE_H && defined(SO_EE_ORIGIN_ZEROCOPY)
+    int fd = ToFileDescriptor(socket);
+
+    // Other entries in the error queue (e.g. ICMP errors) are also reported through SO_ERROR,
+    // so they are dropped until a completion is found or the queue is empty.
+    while (true)
+    {
+        char buffer[CMSG_SPACE(sizeof(struct sock_extended_err) + sizeof(struct sockaddr_storage))];
+        struct msghdr header;
+        memset(&header, 0, sizeof(header));
+        header.msg_control = buffer;
+        header.msg_controllen = sizeof(buffer);
+
+        ssize_t res;
+        while ((res = recvmsg(fd, &header, MSG_ERRQUEUE | MSG_DONTWAIT)) < 0 && errno == EINTR);
+
+        if (res < 0)
+        {
+            return SystemNative_ConvertErrorPlatformToPal(errno);
+        }
+
+        for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg != NULL; cmsg = GET_CMSG_NXTHDR(&header, cmsg))
+        {
+            if ((cmsg->cmsg_level == SOL_IP && cmsg->cmsg_type == IP_RECVERR) ||
+                (cmsg->cmsg_level == SOL_IPV6 && cmsg->cmsg_type == IPV6_RECVERR))
+            {
+                struct sock_extended_err e;
+                memcpy(&e, CMSG_DATA(cmsg), sizeof(e));
+                if (e.ee_errno == 0 && e.ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+                {
+                    // ee_info and ee_data hold the inclusive range of completed sends
+                    *firstSend = e.ee_info;
+                    *lastSend = e.ee_data;
+                    *copied = (e.ee_code & SO_EE_CODE_ZEROCOPY_COPIED) != 0;
+                    return Error_SUCCESS;
+                }
+            }
+        }
+    }
+#else
+    (void)socket;
+    *firstSend = 0;
+    *lastSend = 0;
+    *copied = 0;
+    return Error_ENOTSUP;
+#endif
+}
+
+int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int32_t nonBlocking, int64_t* spliced)
+{
+    assert(spliced != NULL);
+
+    *spliced = 0;
+
+#if HAVE_SPLICE
+    int infd = ToFileDescriptor(in_fd);
+    int outfd = ToFileDescriptor(out_fd);
+    unsigned int flags = SPLICE_F_MOVE | (nonBlocking != 0 ? SPLICE_F_NONBLOCK : 0);
+
+    ssize_t res;
+    while ((res = splice(infd, NULL, outfd, NULL, (size_t)count, flags)) < 0 && errno == EINTR);
+    if (res != -1)
+    {
+        *spliced = res;
+        return Error_SUCCESS;
+    }
+
+    return SystemNative_ConvertErrorPlatformToPal(errno);
+#else
+    (void)in_fd;
+    (void)out_fd;
+    (void)count;
+    (void)nonBlocking;
+    return Error_ENOTSUP;
+#endif
+}
+
 uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName)
 {
 #if HAVE_NET_IF_H
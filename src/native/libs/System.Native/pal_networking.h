@@ -189,6 +189,8 @@ typedef enum
 
     // Names for SocketOptionLevel_SOL_UDP
     // SocketOptionName_SO_UDP_NOCHECKSUM = 1,
+    SocketOptionName_SO_UDP_SEGMENT = 2, // UDP_SEND_MSG_SIZE on Windows
+    SocketOptionName_SO_UDP_GRO = 3,     // UDP_RECV_MAX_COALESCED_SIZE on Windows
     // SocketOptionName_SO_UDP_CHECKSUM_COVERAGE = 20,
     // SocketOptionName_SO_UDP_UPDATEACCEPTCONTEXT = 0x700b,
     // SocketOptionName_SO_UDP_UPDATECONNECTCONTEXT = 0x7010,
@@ -210,6 +212,7 @@ typedef enum
     SocketFlags_MSG_CTRUNC = 0x0200,    // SocketFlags.ControlDataTruncated
     SocketFlags_MSG_DONTWAIT = 0x1000,  // used privately by Ping
     SocketFlags_MSG_ERRQUEUE = 0x2000,  // used privately by Ping
+    SocketFlags_MSG_ZEROCOPY = 0x4000,  // used privately by zero-copy sends
 } SocketFlags;
 
 /*
@@ -340,6 +343,8 @@ PALEXPORT int32_t SystemNative_GetControlMessageBufferSize(int32_t isIPv4, int32
 
 PALEXPORT int32_t SystemNative_TryGetIPPacketInformation(MessageHeader* messageHeader, int32_t isIPv4, IPPacketInformation* packetInfo);
 
+PALEXPORT int32_t SystemNative_TryGetUdpGroSegmentSize(MessageHeader* messageHeader, int32_t* segmentSize);
+
 PALEXPORT int32_t SystemNative_GetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
 
 PALEXPORT int32_t SystemNative_SetIPv4MulticastOption(intptr_t socket, int32_t multicastOption, IPv4MulticastOption* option);
@@ -366,6 +371,23 @@ PALEXPORT int32_t SystemNative_Send(intptr_t socket, void* buffer, int32_t buffe
 
 PALEXPORT int32_t SystemNative_SendMessage(intptr_t socket, MessageHeader* messageHeader, int32_t flags, int64_t* sent);
 
+/**
+ * Receives up to messageCount datagrams with a single system call where the platform supports it.
+ * Blocks until at least one datagram is available on a blocking socket; messageLengths receives the
+ * length of each datagram and the header fields are updated as by SystemNative_ReceiveMessage.
+ * Fewer than messageCount datagrams may be processed per call.
+ */
+PALEXPORT int32_t SystemNative_ReceiveMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* messageLengths, int32_t messageCount, int32_t flags, int32_t* received);
+
+/**
+ * Sends up to messageCount datagrams with a single system call where the platform supports it.
+ * messageLengths receives the number of bytes sent from each message. Fails only if the first
+ * message could not be sent; otherwise sent is the number of messages that were sent.
+ */
+PALEXPORT int32_t SystemNative_SendMessages(
+    intptr_t socket, MessageHeader* messageHeaders, int32_t* messageLengths, int32_t messageCount, int32_t flags, int32_t* sent);
+
 PALEXPORT int32_t SystemNative_Accept(intptr_t socket, uint8_t* socketAddress, int32_t* socketAddressLen, intptr_t* acceptedSocket);
 
 PALEXPORT int32_t SystemNative_Bind(intptr_t socket, int32_t protocolType, uint8_t* socketAddress, int32_t socketAddressLen);
@@ -427,6 +449,28 @@ PALEXPORT int32_t SystemNative_GetMaximumAddressSize(void);
 
 PALEXPORT int32_t SystemNative_SendFile(intptr_t out_fd, intptr_t in_fd, int64_t offset, int64_t count, int64_t* sent);
 
+/**
+ * Enables SocketFlags_MSG_ZEROCOPY sends on the socket. Returns Error_ENOTSUP where the platform
+ * does not support zero-copy sends.
+ */
+PALEXPORT int32_t SystemNative_EnableZeroCopySend(intptr_t socket);
+
+/**
+ * Dequeues one zero-copy send completion from the socket error queue. The socket reports
+ * SocketEvents_SA_ERROR through the socket event port while completions are pending.
+ * Sends are numbered from 0 in the order they were made; firstSend and lastSend receive the
+ * inclusive range of sends whose buffers can be reused, and copied is set to 1 when the kernel
+ * fell back to copying the data. Returns Error_EAGAIN when no completion is pending.
+ */
+PALEXPORT int32_t SystemNative_ReceiveZeroCopyCompletion(intptr_t socket, uint32_t* firstSend, uint32_t* lastSend, int32_t* copied);
+
+/**
+ * Moves up to count bytes between two descriptors without copying them through user space.
+ * One of the descriptors has to be a pipe; socket-to-socket transfers go through an intermediate
+ * pipe created with SystemNative_Pipe. Returns Error_ENOTSUP where the platform has no splice.
+ */
+PALEXPORT int32_t SystemNative_Splice(intptr_t in_fd, intptr_t out_fd, int64_t count, int32_t nonBlocking, int64_t* spliced);
+
 PALEXPORT int32_t SystemNative_Disconnect(intptr_t socket);
 
 PALEXPORT uint32_t SystemNative_InterfaceNameToIndex(char* interfaceName);
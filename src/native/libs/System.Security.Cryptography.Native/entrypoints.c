@@ -91,6 +91,8 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_ErrPeekError)
     DllImportEntry(CryptoNative_ErrPeekLastError)
     DllImportEntry(CryptoNative_ErrReasonErrorString)
+    DllImportEntry(CryptoNative_EvpAeadDecryptBatch)
+    DllImportEntry(CryptoNative_EvpAeadEncryptBatch)
     DllImportEntry(CryptoNative_EvpAes128Cbc)
     DllImportEntry(CryptoNative_EvpAes128Ccm)
     DllImportEntry(CryptoNative_EvpAes128Cfb128)
@@ -222,6 +224,7 @@ static const Entry s_cryptoNative[] =
     DllImportEntry(CryptoNative_HkdfDeriveKey)
     DllImportEntry(CryptoNative_HkdfExpand)
     DllImportEntry(CryptoNative_HkdfExtract)
+    DllImportEntry(CryptoNative_HmacBatch)
     DllImportEntry(CryptoNative_HmacCopy)
     DllImportEntry(CryptoNative_HmacCreate)
     DllImportEntry(CryptoNative_HmacCurrent)
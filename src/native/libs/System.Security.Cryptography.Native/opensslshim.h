@@ -425,6 +425,7 @@ extern bool g_libSslUses32BitTime;
     FALLBACK_FUNCTION(EVP_CIPHER_CTX_reset) \
     REQUIRED_FUNCTION(EVP_CIPHER_CTX_set_key_length) \
     REQUIRED_FUNCTION(EVP_CIPHER_CTX_set_padding) \
+    LIGHTUP_FUNCTION(EVP_CIPHER_fetch) \
     RENAMED_FUNCTION(EVP_CIPHER_get_nid, EVP_CIPHER_nid) \
     REQUIRED_FUNCTION(EVP_CipherFinal_ex) \
     REQUIRED_FUNCTION(EVP_CipherInit_ex) \
@@ -974,6 +975,7 @@ extern TYPEOF(OPENSSL_gmtime)* OPENSSL_gmtime_ptr;
 #define EVP_CIPHER_CTX_reset EVP_CIPHER_CTX_reset_ptr
 #define EVP_CIPHER_CTX_set_key_length EVP_CIPHER_CTX_set_key_length_ptr
 #define EVP_CIPHER_CTX_set_padding EVP_CIPHER_CTX_set_padding_ptr
+#define EVP_CIPHER_fetch EVP_CIPHER_fetch_ptr
 #define EVP_CIPHER_get_nid EVP_CIPHER_get_nid_ptr
 #define EVP_CipherFinal_ex EVP_CipherFinal_ex_ptr
 #define EVP_CipherInit_ex EVP_CipherInit_ex_ptr
@@ -11,29 +11,78 @@
 #define SUCCESS 1
 
 static const EVP_MD* g_evpFetchMd5 = NULL;
+static const EVP_MD* g_evpFetchSha1 = NULL;
+static const EVP_MD* g_evpFetchSha256 = NULL;
+static const EVP_MD* g_evpFetchSha384 = NULL;
+static const EVP_MD* g_evpFetchSha512 = NULL;
+static const EVP_MD* g_evpFetchSha3_256 = NULL;
+static const EVP_MD* g_evpFetchSha3_384 = NULL;
+static const EVP_MD* g_evpFetchSha3_512 = NULL;
+static const EVP_MD* g_evpFetchShake128 = NULL;
+static const EVP_MD* g_evpFetchShake256 = NULL;
 static pthread_once_t g_evpFetch = PTHREAD_ONCE_INIT;
 
-static void EnsureFetchEvpMdAlgorithms(void)
+static const EVP_MD* FetchEvpMd(const char* algorithm, const char* properties, const EVP_MD* implicitMd)
 {
-    // This is called from a pthread_once - this method should not be called directly.
+    const EVP_MD* md = NULL;
 
 #ifdef NEED_OPENSSL_3_0
+    // An explicitly fetched EVP_MD saves OpenSSL 3 from looking up the implementation in the provider
+    // store, under its lock, every time a digest, HMAC or signature is initialized with it.
     if (API_EXISTS(EVP_MD_fetch))
     {
+        md = EVP_MD_fetch(NULL, algorithm, properties);
         ERR_clear_error();
-
-        // Try to fetch an MD5 implementation that will work regardless if
-        // FIPS is enforced or not.
-        g_evpFetchMd5 = EVP_MD_fetch(NULL, "MD5", "-fips");
     }
+#else
+    (void)algorithm;
+    (void)properties;
 #endif
 
     // No error queue impact.
     // If EVP_MD_fetch is unavailable, use the implicit loader. If it failed, use the implicit loader as a last resort.
-    if (g_evpFetchMd5 == NULL)
+    return md != NULL ? md : implicitMd;
+}
+
+static void EnsureFetchEvpMdAlgorithms(void)
+{
+    // This is called from a pthread_once - this method should not be called directly.
+
+    // Try to fetch an MD5 implementation that will work regardless if
+    // FIPS is enforced or not.
+    g_evpFetchMd5 = FetchEvpMd("MD5", "-fips", EVP_md5());
+
+    g_evpFetchSha1 = FetchEvpMd("SHA1", NULL, EVP_sha1());
+    g_evpFetchSha256 = FetchEvpMd("SHA256", NULL, EVP_sha256());
+    g_evpFetchSha384 = FetchEvpMd("SHA384", NULL, EVP_sha384());
+    g_evpFetchSha512 = FetchEvpMd("SHA512", NULL, EVP_sha512());
+
+#if HAVE_OPENSSL_SHA3
+    if (API_EXISTS(EVP_sha3_256))
+    {
+        g_evpFetchSha3_256 = FetchEvpMd("SHA3-256", NULL, EVP_sha3_256());
+    }
+
+    if (API_EXISTS(EVP_sha3_384))
     {
-        g_evpFetchMd5 = EVP_md5();
+        g_evpFetchSha3_384 = FetchEvpMd("SHA3-384", NULL, EVP_sha3_384());
     }
+
+    if (API_EXISTS(EVP_sha3_512))
+    {
+        g_evpFetchSha3_512 = FetchEvpMd("SHA3-512", NULL, EVP_sha3_512());
+    }
+
+    if (API_EXISTS(EVP_shake128))
+    {
+        g_evpFetchShake128 = FetchEvpMd("SHAKE-128", NULL, EVP_shake128());
+    }
+
+    if (API_EXISTS(EVP_shake256))
+    {
+        g_evpFetchShake256 = FetchEvpMd("SHAKE-256", NULL, EVP_shake256());
+    }
+#endif
 }
 
 EVP_MD_CTX* CryptoNative_EvpMdCtxCreate(const EVP_MD* type)
@@ -299,91 +348,56 @@ const EVP_MD* CryptoNative_EvpMd5(void)
 
 const EVP_MD* CryptoNative_EvpSha1(void)
 {
-    // No error queue impact.
-    return EVP_sha1();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha1;
 }
 
 const EVP_MD* CryptoNative_EvpSha256(void)
 {
-    // No error queue impact.
-    return EVP_sha256();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha256;
 }
 
 const EVP_MD* CryptoNative_EvpSha384(void)
 {
-    // No error queue impact.
-    return EVP_sha384();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha384;
 }
 
 const EVP_MD* CryptoNative_EvpSha512(void)
 {
-    // No error queue impact.
-    return EVP_sha512();
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha512;
 }
 
 const EVP_MD* CryptoNative_EvpSha3_256(void)
 {
-    // No error queue impact.
-#if HAVE_OPENSSL_SHA3
-    if (API_EXISTS(EVP_sha3_256))
-    {
-        return EVP_sha3_256();
-    }
-#endif
-
-    return NULL;
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha3_256;
 }
 
 const EVP_MD* CryptoNative_EvpSha3_384(void)
 {
-    // No error queue impact.
-#if HAVE_OPENSSL_SHA3
-    if (API_EXISTS(EVP_sha3_384))
-    {
-        return EVP_sha3_384();
-    }
-#endif
-
-    return NULL;
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha3_384;
 }
 
 const EVP_MD* CryptoNative_EvpSha3_512(void)
 {
-    // No error queue impact.
-#if HAVE_OPENSSL_SHA3
-    if (API_EXISTS(EVP_sha3_512))
-    {
-        return EVP_sha3_512();
-    }
-#endif
-
-    return NULL;
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchSha3_512;
 }
 
 const EVP_MD* CryptoNative_EvpShake128(void)
 {
-    // No error queue impact.
-#if HAVE_OPENSSL_SHA3
-    if (API_EXISTS(EVP_shake128))
-    {
-        return EVP_shake128();
-    }
-#endif
-
-    return NULL;
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchShake128;
 }
 
 const EVP_MD* CryptoNative_EvpShake256(void)
 {
-    // No error queue impact.
-#if HAVE_OPENSSL_SHA3
-    if (API_EXISTS(EVP_shake256))
-    {
-        return EVP_shake256();
-    }
-#endif
-
-    return NULL;
+    pthread_once(&g_evpFetch, EnsureFetchEvpMdAlgorithms);
+    return g_evpFetchShake256;
 }
 
 int32_t CryptoNative_GetMaxMdSize(void)
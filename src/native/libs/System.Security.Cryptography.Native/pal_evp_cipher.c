@@ -2,12 +2,88 @@
 // The .NET Foundation licenses this file to you under the MIT license.
 
 #include "pal_evp_cipher.h"
+#include "pal_utilities.h"
 
 #include <assert.h>
+#include <pthread.h>
 
 #define SUCCESS 1
 #define KEEP_CURRENT_DIRECTION -1
 
+static const EVP_CIPHER* g_evpFetchAes128Ecb = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Cbc = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Gcm = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Cfb128 = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Cfb8 = NULL;
+static const EVP_CIPHER* g_evpFetchAes128Ccm = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Ecb = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Cfb128 = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Cfb8 = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Cbc = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Gcm = NULL;
+static const EVP_CIPHER* g_evpFetchAes192Ccm = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Ecb = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Cfb128 = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Cfb8 = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Cbc = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Gcm = NULL;
+static const EVP_CIPHER* g_evpFetchAes256Ccm = NULL;
+static const EVP_CIPHER* g_evpFetchChaCha20Poly1305 = NULL;
+static pthread_once_t g_evpCipherFetch = PTHREAD_ONCE_INIT;
+
+static const EVP_CIPHER* FetchEvpCipher(const char* algorithm, const EVP_CIPHER* implicitCipher)
+{
+    const EVP_CIPHER* cipher = NULL;
+
+#ifdef NEED_OPENSSL_3_0
+    // An explicitly fetched EVP_CIPHER saves OpenSSL 3 from looking up the implementation in the
+    // provider store, under its lock, every time a context is created with it.
+    if (API_EXISTS(EVP_CIPHER_fetch))
+    {
+        cipher = EVP_CIPHER_fetch(NULL, algorithm, NULL);
+        ERR_clear_error();
+    }
+#else
+    (void)algorithm;
+#endif
+
+    // No error queue impact.
+    // If EVP_CIPHER_fetch is unavailable or failed, use the implicit loader.
+    return cipher != NULL ? cipher : implicitCipher;
+}
+
+static void EnsureFetchEvpCipherAlgorithms(void)
+{
+    // This is called from a pthread_once - this method should not be called directly.
+
+    // DES, 3DES and RC2 only live in the legacy provider and are left to the implicit loader.
+    g_evpFetchAes128Ecb = FetchEvpCipher("AES-128-ECB", EVP_aes_128_ecb());
+    g_evpFetchAes128Cbc = FetchEvpCipher("AES-128-CBC", EVP_aes_128_cbc());
+    g_evpFetchAes128Gcm = FetchEvpCipher("AES-128-GCM", EVP_aes_128_gcm());
+    g_evpFetchAes128Cfb128 = FetchEvpCipher("AES-128-CFB", EVP_aes_128_cfb128());
+    g_evpFetchAes128Cfb8 = FetchEvpCipher("AES-128-CFB8", EVP_aes_128_cfb8());
+    g_evpFetchAes128Ccm = FetchEvpCipher("AES-128-CCM", EVP_aes_128_ccm());
+    g_evpFetchAes192Ecb = FetchEvpCipher("AES-192-ECB", EVP_aes_192_ecb());
+    g_evpFetchAes192Cfb128 = FetchEvpCipher("AES-192-CFB", EVP_aes_192_cfb128());
+    g_evpFetchAes192Cfb8 = FetchEvpCipher("AES-192-CFB8", EVP_aes_192_cfb8());
+    g_evpFetchAes192Cbc = FetchEvpCipher("AES-192-CBC", EVP_aes_192_cbc());
+    g_evpFetchAes192Gcm = FetchEvpCipher("AES-192-GCM", EVP_aes_192_gcm());
+    g_evpFetchAes192Ccm = FetchEvpCipher("AES-192-CCM", EVP_aes_192_ccm());
+    g_evpFetchAes256Ecb = FetchEvpCipher("AES-256-ECB", EVP_aes_256_ecb());
+    g_evpFetchAes256Cfb128 = FetchEvpCipher("AES-256-CFB", EVP_aes_256_cfb128());
+    g_evpFetchAes256Cfb8 = FetchEvpCipher("AES-256-CFB8", EVP_aes_256_cfb8());
+    g_evpFetchAes256Cbc = FetchEvpCipher("AES-256-CBC", EVP_aes_256_cbc());
+    g_evpFetchAes256Gcm = FetchEvpCipher("AES-256-GCM", EVP_aes_256_gcm());
+    g_evpFetchAes256Ccm = FetchEvpCipher("AES-256-CCM", EVP_aes_256_ccm());
+
+#if HAVE_OPENSSL_CHACHA20POLY1305
+    if (API_EXISTS(EVP_chacha20_poly1305))
+    {
+        g_evpFetchChaCha20Poly1305 = FetchEvpCipher("ChaCha20-Poly1305", EVP_chacha20_poly1305());
+    }
+#endif
+}
+
 EVP_CIPHER_CTX*
 CryptoNative_EvpCipherCreate2(const EVP_CIPHER* type, uint8_t* key, int32_t keyLength, unsigned char* iv, int32_t enc)
 {
@@ -189,6 +265,104 @@ int32_t CryptoNative_EvpCipherFinalEx(EVP_CIPHER_CTX* ctx, uint8_t* outm, int32_
     return ret;
 }
 
+static int32_t AeadProcessRecord(EVP_CIPHER_CTX* ctx, const AeadRecord* record, int32_t tagLength, int32_t enc)
+{
+    assert(record->Nonce != NULL);
+    assert(record->AssociatedData != NULL || record->AssociatedDataLength == 0);
+    assert(record->InputLength >= 0 && (record->Input != NULL || record->InputLength == 0));
+    assert(record->Output != NULL || record->InputLength == 0);
+    assert(record->Tag != NULL);
+
+    int outLength;
+
+    if (!EVP_CipherInit_ex(ctx, NULL, NULL, NULL, record->Nonce, enc))
+    {
+        return 0;
+    }
+
+    if (record->AssociatedDataLength > 0 &&
+        !EVP_CipherUpdate(ctx, NULL, &outLength, record->AssociatedData, record->AssociatedDataLength))
+    {
+        return 0;
+    }
+
+    // Both modes are stream ciphers, so all of the output is produced by the update
+    if (record->InputLength > 0 &&
+        !EVP_CipherUpdate(ctx, record->Output, &outLength, record->Input, record->InputLength))
+    {
+        return 0;
+    }
+
+    // EVP_CTRL_GCM_*_TAG have the same values as EVP_CTRL_AEAD_*_TAG, which ChaCha20-Poly1305 uses
+    if (enc)
+    {
+        return EVP_CipherFinal_ex(ctx, NULL, &outLength) == SUCCESS &&
+               EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, tagLength, record->Tag) == SUCCESS;
+    }
+
+    if (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, tagLength, record->Tag) != SUCCESS)
+    {
+        return 0;
+    }
+
+    return EVP_CipherFinal_ex(ctx, NULL, &outLength) == SUCCESS ? 1 : -1;
+}
+
+int32_t CryptoNative_EvpAeadEncryptBatch(
+    EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t recordCount, int32_t tagLength, int32_t* processed)
+{
+    assert(ctx != NULL);
+    assert(records != NULL || recordCount == 0);
+    assert(processed != NULL);
+
+    ERR_clear_error();
+
+    *processed = 0;
+
+    for (int32_t i = 0; i < recordCount; i++)
+    {
+        if (AeadProcessRecord(ctx, &records[i], tagLength, 1) != SUCCESS)
+        {
+            return 0;
+        }
+
+        (*processed)++;
+    }
+
+    return SUCCESS;
+}
+
+int32_t CryptoNative_EvpAeadDecryptBatch(
+    EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t recordCount, int32_t tagLength, int32_t* results)
+{
+    assert(ctx != NULL);
+    assert(records != NULL || recordCount == 0);
+    assert(results != NULL || recordCount == 0);
+
+    ERR_clear_error();
+
+    for (int32_t i = 0; i < recordCount; i++)
+    {
+        int32_t ret = AeadProcessRecord(ctx, &records[i], tagLength, 0);
+        if (ret == 0)
+        {
+            return 0;
+        }
+
+        results[i] = ret == SUCCESS;
+
+        if (ret != SUCCESS)
+        {
+            // Don't hand out plaintext that failed authentication.
+            // The failed final leaves an error in the queue that does not concern the next record.
+            OPENSSL_cleanse(records[i].Output, Int32ToSizeT(records[i].InputLength));
+            ERR_clear_error();
+        }
+    }
+
+    return SUCCESS;
+}
+
 int32_t CryptoNative_EvpCipherGetGcmTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int32_t tagLength)
 {
     ERR_clear_error();
@@ -241,110 +415,110 @@ int32_t CryptoNative_EvpCipherSetAeadTag(EVP_CIPHER_CTX* ctx, uint8_t* tag, int3
 
 const EVP_CIPHER* CryptoNative_EvpAes128Ecb(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_ecb();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Ecb;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Cbc(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_cbc();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Cbc;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Gcm(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_gcm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Gcm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Cfb128(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_cfb128();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Cfb128;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Cfb8(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_cfb8();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Cfb8;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes128Ccm(void)
 {
-    // No error queue impact.
-    return EVP_aes_128_ccm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes128Ccm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Ecb(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_ecb();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Ecb;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Cfb128(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_cfb128();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Cfb128;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Cfb8(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_cfb8();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Cfb8;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Cbc(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_cbc();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Cbc;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Gcm(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_gcm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Gcm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes192Ccm(void)
 {
-    // No error queue impact.
-    return EVP_aes_192_ccm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes192Ccm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Ecb(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_ecb();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Ecb;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Cfb128(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_cfb128();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Cfb128;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Cfb8(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_cfb8();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Cfb8;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Cbc(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_cbc();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Cbc;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Gcm(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_gcm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Gcm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpAes256Ccm(void)
 {
-    // No error queue impact.
-    return EVP_aes_256_ccm();
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchAes256Ccm;
 }
 
 const EVP_CIPHER* CryptoNative_EvpDesEcb(void)
@@ -417,13 +591,6 @@ const EVP_CIPHER* CryptoNative_EvpRC2Cbc(void)
 
 const EVP_CIPHER* CryptoNative_EvpChaCha20Poly1305(void)
 {
-    // No error queue impact.
-#if HAVE_OPENSSL_CHACHA20POLY1305
-    if (API_EXISTS(EVP_chacha20_poly1305))
-    {
-        return EVP_chacha20_poly1305();
-    }
-#endif
-
-    return NULL;
+    pthread_once(&g_evpCipherFetch, EnsureFetchEvpCipherAlgorithms);
+    return g_evpFetchChaCha20Poly1305;
 }
@@ -5,6 +5,21 @@
 #include "pal_compiler.h"
 #include "opensslshim.h"
 
+/*
+One record of a batched AEAD operation. Input and Output are InputLength bytes long and may be
+the same buffer; Tag is the tagLength bytes passed to the batch function.
+*/
+typedef struct
+{
+    uint8_t* Nonce;
+    uint8_t* AssociatedData;
+    int32_t AssociatedDataLength;
+    int32_t InputLength;
+    uint8_t* Input;
+    uint8_t* Output;
+    uint8_t* Tag;
+} AeadRecord;
+
 PALEXPORT EVP_CIPHER_CTX*
 CryptoNative_EvpCipherCreate2(const EVP_CIPHER* type, uint8_t* key, int32_t keyLength, unsigned char* iv, int32_t enc);
 
@@ -62,6 +77,32 @@ Direct shim to EVP_CipherFinal_ex.
 */
 PALEXPORT int32_t CryptoNative_EvpCipherFinalEx(EVP_CIPHER_CTX* ctx, uint8_t* outm, int32_t* outl);
 
+/*
+Function:
+EvpAeadEncryptBatch
+
+Encrypts recordCount records with an AES-GCM or ChaCha20-Poly1305 context created with its key and
+nonce length already set, re-initializing only the nonce between records. The tag of each record
+is written to AeadRecord.Tag.
+
+Returns 1 on success, 0 on failure. processed receives the number of records that were encrypted.
+*/
+PALEXPORT int32_t CryptoNative_EvpAeadEncryptBatch(
+    EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t recordCount, int32_t tagLength, int32_t* processed);
+
+/*
+Function:
+EvpAeadDecryptBatch
+
+Decrypts and authenticates recordCount records the same way EvpAeadEncryptBatch encrypts them.
+results[i] is set to 1 when record i was authenticated and 0 when its tag did not match, in which
+case its output is cleared.
+
+Returns 1 when every record was processed, 0 on failure.
+*/
+PALEXPORT int32_t CryptoNative_EvpAeadDecryptBatch(
+    EVP_CIPHER_CTX* ctx, AeadRecord* records, int32_t recordCount, int32_t tagLength, int32_t* results);
+
 /*
 Function:
 EvpAesGcmGetTag
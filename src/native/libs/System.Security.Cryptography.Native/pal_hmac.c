@@ -184,3 +184,40 @@ int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
 
     return result == NULL ? 0 : 1;
 }
+
+int32_t CryptoNative_HmacBatch(HMAC_CTX* ctx,
+                               const uint8_t** sources,
+                               const int32_t* sourceSizes,
+                               int32_t count,
+                               uint8_t* macs,
+                               int32_t macSize)
+{
+    assert(ctx != NULL);
+    assert((sources != NULL && sourceSizes != NULL && macs != NULL) || count == 0);
+    assert(count >= 0 && macSize >= 0);
+
+    ERR_clear_error();
+
+    if (count < 0 || macSize < 0)
+    {
+        return 0;
+    }
+
+    int32_t ret = 1;
+    for (int32_t i = 0; i < count && ret; i++)
+    {
+        assert(sources[i] != NULL || sourceSizes[i] == 0);
+        assert(sourceSizes[i] >= 0);
+
+        unsigned int unsignedLen = Int32ToUint32(macSize);
+        ret = sourceSizes[i] >= 0 &&
+              HMAC_Update(ctx, sources[i], Int32ToSizeT(sourceSizes[i])) &&
+              HMAC_Final(ctx, macs + (size_t)i * Int32ToSizeT(macSize), &unsignedLen) &&
+              unsignedLen == Int32ToUint32(macSize);
+
+        // Keep the key and digest for the next message
+        ret = HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) && ret;
+    }
+
+    return ret;
+}
@@ -82,6 +82,19 @@ PALEXPORT int32_t CryptoNative_HmacOneShot(const EVP_MD* type,
                                            uint8_t* md,
                                            int32_t* mdSize);
 
+/**
+ * Computes the HMAC of count messages with the key and digest of ctx, resetting ctx between messages.
+ * The HMAC of message i is written at macs + i * macSize, where macSize is the digest size of ctx.
+ *
+ * Returns 1 for success or 0 for failure. The state of ctx is reset either way.
+ */
+PALEXPORT int32_t CryptoNative_HmacBatch(HMAC_CTX* ctx,
+                                         const uint8_t** sources,
+                                         const int32_t* sourceSizes,
+                                         int32_t count,
+                                         uint8_t* macs,
+                                         int32_t macSize);
+
 /**
  * Clones the context of the HMAC.
  * Returns NULL on failure.
@@ -565,3 +565,57 @@ bool minipal_detect_rosetta(void)
 
     return false;
 }
+
+bool minipal_is_hybrid_cpu(void)
+{
+#if defined(HOST_AMD64) || defined(HOST_X86)
+    int regs[4];
+
+    __cpuid(regs, 0x00000000);
+    if ((uint32_t)regs[0] < 0x07)
+    {
+        return false;
+    }
+
+    __cpuidex(regs, 0x00000007, 0x00000000);
+    return (regs[3] & (1 << 15)) != 0;                                                                          // Hybrid
+#elif defined(HOST_ARM64) && HAVE_SYSCTLBYNAME
+    // Apple silicon reports one performance level per core type
+    int32_t perfLevels = 0;
+    size_t sz = sizeof(perfLevels);
+    return (sysctlbyname("hw.nperflevels", &perfLevels, &sz, NULL, 0) == 0) && (perfLevels > 1);
+#else
+    return false;
+#endif
+}
+
+int minipal_get_current_cpu_core_type(void)
+{
+#if defined(HOST_AMD64) || defined(HOST_X86)
+    if (!minipal_is_hybrid_cpu())
+    {
+        return MinipalCpuCoreType_Unknown;
+    }
+
+    int regs[4];
+    __cpuid(regs, 0x00000000);
+    if ((uint32_t)regs[0] < 0x1A)
+    {
+        return MinipalCpuCoreType_Unknown;
+    }
+
+    // The native model information leaf reports the type of the core executing CPUID
+    __cpuidex(regs, 0x0000001A, 0x00000000);
+    switch (((uint32_t)regs[0] >> 24) & 0xFF)
+    {
+        case 0x40:                                                                                              // Intel Core
+            return MinipalCpuCoreType_Performance;
+        case 0x20:                                                                                              // Intel Atom
+            return MinipalCpuCoreType_Efficiency;
+        default:
+            return MinipalCpuCoreType_Unknown;
+    }
+#else
+    return MinipalCpuCoreType_Unknown;
+#endif
+}
@@ -62,6 +62,14 @@ static_assert((1 << ARM64_ATOMICS_FEATURE_FLAG_BIT) == ARM64IntrinsicConstants_A
 
 #endif // HOST_ARM64
 
+// Type of the core a thread is running on, on processors that mix core types
+enum MinipalCpuCoreType
+{
+    MinipalCpuCoreType_Unknown = 0,
+    MinipalCpuCoreType_Performance = 1,
+    MinipalCpuCoreType_Efficiency = 2,
+};
+
 #ifdef __cplusplus
 extern "C"
 {
@@ -70,6 +78,13 @@ extern "C"
 int minipal_getcpufeatures(void);
 bool minipal_detect_rosetta(void);
 
+// Detect if the processor mixes performance and efficiency cores (e.g. Intel hybrid or Apple silicon)
+bool minipal_is_hybrid_cpu(void);
+
+// Get the MinipalCpuCoreType of the core the calling thread is currently running on. The result is only
+// a snapshot, since the thread may be moved to another core at any time.
+int minipal_get_current_cpu_core_type(void);
+
 #ifdef __cplusplus
 }
 #endif // __cplusplus
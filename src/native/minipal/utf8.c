@@ -5,6 +5,7 @@
 
 #include <errno.h>
 #include <limits.h>
+#include <stdint.h>
 #include <string.h>
 #include <assert.h>
 #include "minipalconfig.h"
@@ -2056,6 +2057,101 @@ static size_t GetByteCount(UTF8Encoding* self, CHAR16_T *chars, size_t count)
     return byteCount;
 }
 
+// Most strings handed to the converters (paths, metadata names, event payloads) are pure ASCII.
+// The helpers below find the length of the leading ASCII run a machine word at a time, so the
+// public entry points only need to run the full decoder/encoder on the remainder.
+
+#define ASCII_MASK_8 ((size_t)0x8080808080808080ULL)
+#define ASCII_MASK_16 ((uint64_t)0xFF80FF80FF80FF80ULL)
+
+// Returns the number of leading ASCII bytes, at most count
+static size_t GetAsciiPrefixLength_Utf8(const unsigned char* bytes, size_t count)
+{
+    size_t i = 0;
+
+    for (; i + sizeof(size_t) <= count; i += sizeof(size_t))
+    {
+        size_t word;
+        memcpy(&word, bytes + i, sizeof(word));
+        if ((word & ASCII_MASK_8) != 0)
+            break;
+    }
+
+    while (i < count && bytes[i] < 0x80)
+        i++;
+
+    return i;
+}
+
+// Returns the number of leading ASCII chars, at most count
+static size_t GetAsciiPrefixLength_Utf16(const CHAR16_T* chars, size_t count, bool swapBytes)
+{
+    size_t i = 0;
+
+    if (!swapBytes)
+    {
+        for (; i + 4 <= count; i += 4)
+        {
+            uint64_t word;
+            memcpy(&word, chars + i, sizeof(word));
+            if ((word & ASCII_MASK_16) != 0)
+                break;
+        }
+        while (i < count && chars[i] < 0x80)
+            i++;
+    }
+    else
+    {
+        // a byte swapped ASCII char has its value in the high byte and a zero low byte
+        while (i < count && (chars[i] & 0x80FF) == 0)
+            i++;
+    }
+
+    return i;
+}
+
+// Widens count ASCII bytes into chars
+static void WidenAscii(const unsigned char* bytes, CHAR16_T* chars, size_t count, bool swapBytes)
+{
+    if (!swapBytes)
+    {
+        for (size_t i = 0; i < count; i++)
+            chars[i] = (CHAR16_T)bytes[i];
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            chars[i] = (CHAR16_T)(bytes[i] << 8);
+    }
+}
+
+// Narrows count ASCII chars into bytes
+static void NarrowAscii(const CHAR16_T* chars, unsigned char* bytes, size_t count, bool swapBytes)
+{
+    if (!swapBytes)
+    {
+        for (size_t i = 0; i < count; i++)
+            bytes[i] = (unsigned char)chars[i];
+    }
+    else
+    {
+        for (size_t i = 0; i < count; i++)
+            bytes[i] = (unsigned char)(chars[i] >> 8);
+    }
+}
+
+// The UTF-16 side is stored byte swapped relative to the host only on big endian hosts
+// that were asked to treat it as little endian
+static bool IsUtf16ByteSwapped(unsigned int flags)
+{
+#if BIGENDIAN
+    return (flags & MINIPAL_TREAT_AS_LITTLE_ENDIAN) != 0;
+#else
+    (void)flags; // unused
+    return false;
+#endif
+}
+
 size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength, unsigned int flags)
 {
     errno = 0;
@@ -2072,7 +2168,12 @@ size_t minipal_get_length_utf8_to_utf16(const char* source, size_t sourceLength,
 #endif
     };
 
-    return GetCharCount(&enc, (unsigned char*)source, sourceLength);
+    size_t asciiLength = GetAsciiPrefixLength_Utf8((const unsigned char*)source, sourceLength);
+    if (asciiLength == sourceLength)
+        return asciiLength;
+
+    size_t ret = GetCharCount(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength);
+    return errno ? 0 : asciiLength + ret;
 }
 
 size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength, unsigned int flags)
@@ -2092,11 +2193,12 @@ size_t minipal_get_length_utf16_to_utf8(const CHAR16_T* source, size_t sourceLen
 #endif
     };
 
-#if !BIGENDIAN
-    (void)flags; // unused
-#endif
+    size_t asciiLength = GetAsciiPrefixLength_Utf16(source, sourceLength, IsUtf16ByteSwapped(flags));
+    if (asciiLength == sourceLength)
+        return asciiLength;
 
-    return GetByteCount(&enc, (CHAR16_T*)source, sourceLength);
+    size_t ret = GetByteCount(&enc, (CHAR16_T*)source + asciiLength, sourceLength - asciiLength);
+    return errno ? 0 : asciiLength + ret;
 }
 
 size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CHAR16_T* destination, size_t destinationLength, unsigned int flags)
@@ -2116,7 +2218,21 @@ size_t minipal_convert_utf8_to_utf16(const char* source, size_t sourceLength, CH
 #endif
     };
 
-    ret = GetChars(&enc, (unsigned char*)source, sourceLength, destination, destinationLength);
+    bool swapBytes = IsUtf16ByteSwapped(flags);
+    size_t asciiLength = GetAsciiPrefixLength_Utf8((const unsigned char*)source, sourceLength < destinationLength ? sourceLength : destinationLength);
+    if (asciiLength == sourceLength)
+    {
+        WidenAscii((const unsigned char*)source, destination, asciiLength, swapBytes);
+        return asciiLength;
+    }
+
+    // Leave the last ASCII char to the converter so that it never starts with nothing to write,
+    // which it reports as an insufficient buffer
+    if (asciiLength != 0)
+        asciiLength--;
+    WidenAscii((const unsigned char*)source, destination, asciiLength, swapBytes);
+
+    ret = asciiLength + GetChars(&enc, (unsigned char*)source + asciiLength, sourceLength - asciiLength, destination + asciiLength, destinationLength - asciiLength);
     if (errno) ret = 0;
 
     return ret;
@@ -2140,11 +2256,21 @@ size_t minipal_convert_utf16_to_utf8(const CHAR16_T* source, size_t sourceLength
 #endif
     };
 
-#if !BIGENDIAN
-    (void)flags; // unused
-#endif
+    bool swapBytes = IsUtf16ByteSwapped(flags);
+    size_t asciiLength = GetAsciiPrefixLength_Utf16(source, sourceLength < destinationLength ? sourceLength : destinationLength, swapBytes);
+    if (asciiLength == sourceLength)
+    {
+        NarrowAscii(source, (unsigned char*)destination, asciiLength, swapBytes);
+        return asciiLength;
+    }
+
+    // Leave the last ASCII char to the converter so that it never starts with nothing to write,
+    // which it reports as an insufficient buffer
+    if (asciiLength != 0)
+        asciiLength--;
+    NarrowAscii(source, (unsigned char*)destination, asciiLength, swapBytes);
 
-    ret = GetBytes(&enc, (CHAR16_T*)source, sourceLength, (unsigned char*)destination, destinationLength);
+    ret = asciiLength + GetBytes(&enc, (CHAR16_T*)source + asciiLength, sourceLength - asciiLength, (unsigned char*)destination + asciiLength, destinationLength - asciiLength);
     if (errno) ret = 0;
 
     return ret;
@@ -0,0 +1,72 @@
+// Licensed to the .NET Foundation under one or more agreements.
+// The .NET Foundation licenses this file to you under the MIT license.
+
+using System;
+using System.Runtime.CompilerServices;
+using System.Runtime.Intrinsics;
+using Xunit;
+
+// Keeps constants live across register pressure so that LSRA spills them. With
+// JitEnableConstantRemat codegen recreates them at the reload instead of reading
+// them back from a spill temp; the results must be the same either way.
+public class ConstantRemat
+{
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long Id(long x) => x;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static double Id(double x) => x;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static string Id(string x) => x;
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static long LongConstants(long a, long b, long c, long d)
+    {
+        return (a * 0x1122334455667788 + Id(b) * 0x0102030405060708) ^
+               (c * 0x7FEDCBA987654321 + Id(d) * 0x1234567890ABCDEF) ^
+               (Id(a + b) * 0x1122334455667788 + Id(c + d) * 0x7FEDCBA987654321);
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static double DoubleConstants(double a, double b, double c)
+    {
+        return (a * 1.25 + Id(b) * 3.75) - (c * 1.25 + Id(a + c) * 3.75) + Id(b * 1.25) * 3.75;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static Vector128<int> VectorConstants(Vector128<int> a, Vector128<int> b, long x)
+    {
+        Vector128<int> c1 = Vector128.Create(1, 2, 3, 4);
+        Vector128<int> c2 = Vector128.Create(-5, 6, -7, 8);
+        return (a + c1) * (b + c2) + Vector128.Create((int)Id(x)) * c1 + c2;
+    }
+
+    [MethodImpl(MethodImplOptions.NoInlining)]
+    private static string StringConstants(string a, string b)
+    {
+        return string.Concat("first", Id(a), "second", Id(b), "first" + Id("second"));
+    }
+
+    [Fact]
+    public static void TestEntryPoint()
+    {
+        Assert.Equal(
+            unchecked((3 * 0x1122334455667788 + 5 * 0x0102030405060708) ^
+                      (7 * 0x7FEDCBA987654321 + 11 * 0x1234567890ABCDEF) ^
+                      (8 * 0x1122334455667788 + 18 * 0x7FEDCBA987654321)),
+            LongConstants(3, 5, 7, 11));
+
+        Assert.Equal(
+            (2.0 * 1.25 + 4.0 * 3.75) - (8.0 * 1.25 + 10.0 * 3.75) + (4.0 * 1.25) * 3.75,
+            DoubleConstants(2.0, 4.0, 8.0));
+
+        Vector128<int> a = Vector128.Create(10, 20, 30, 40);
+        Vector128<int> b = Vector128.Create(1, -1, 2, -2);
+        Vector128<int> c1 = Vector128.Create(1, 2, 3, 4);
+        Vector128<int> c2 = Vector128.Create(-5, 6, -7, 8);
+        Assert.Equal((a + c1) * (b + c2) + Vector128.Create(9) * c1 + c2, VectorConstants(a, b, 9));
+
+        Assert.Equal("firstAsecondBfirstsecond", StringConstants("A", "B"));
+    }
+}